@@ -0,0 +1,94 @@
+/**
+ * \file CompactLineBench.cpp
+ * \brief Compare GeodesicLine and CompactGeodesicLine
+ *
+ * Usage: CompactLineBench [nlines [nquery [nrepeat]]]
+ *
+ * Construct nlines lines (default 100000) as GeodesicLine and as
+ * CompactGeodesicLine objects and report the memory used.  Then time nquery
+ * (default 1000000) Position calls, where each randomly selected line is
+ * queried nrepeat (default 1) times in succession.
+ **********************************************************************/
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+#include <GeographicLib/Geodesic.hpp>
+#include <GeographicLib/GeodesicLine.hpp>
+#include <GeographicLib/CompactGeodesicLine.hpp>
+#include <GeographicLib/Utility.hpp>
+
+using namespace std;
+using namespace GeographicLib;
+typedef Math::real real;
+
+template<class Line>
+static double timeit(const vector<Line>& lines, const vector<int>& ind,
+                     const vector<real>& dist, int nrepeat, real& sum) {
+  auto t0 = chrono::steady_clock::now();
+  for (size_t i = 0; i < ind.size(); ++i) {
+    const Line& l = lines[ind[i]];
+    for (int j = 0; j < nrepeat; ++j) {
+      real lat, lon;
+      l.Position(dist[i] + j * 1000, lat, lon);
+      sum += lat + lon;
+    }
+  }
+  auto t1 = chrono::steady_clock::now();
+  return chrono::duration<double>(t1 - t0).count();
+}
+
+int main(int argc, const char* const argv[]) {
+  try {
+    int nlines = argc > 1 ? Utility::val<int>(string(argv[1])) : 100000,
+      nquery = argc > 2 ? Utility::val<int>(string(argv[2])) : 1000000,
+      nrepeat = argc > 3 ? Utility::val<int>(string(argv[3])) : 1;
+    const Geodesic& g = Geodesic::WGS84();
+    mt19937 r(42);
+    uniform_real_distribution<double> U;
+    vector<GeodesicLine> full;
+    vector<CompactGeodesicLine> compact;
+    full.reserve(nlines); compact.reserve(nlines);
+    auto t0 = chrono::steady_clock::now();
+    for (int i = 0; i < nlines; ++i) {
+      real lat = real(180 * U(r) - 90), lon = real(360 * U(r) - 180),
+        azi = real(360 * U(r) - 180);
+      full.emplace_back(g, lat, lon, azi);
+    }
+    auto t1 = chrono::steady_clock::now();
+    for (int i = 0; i < nlines; ++i)
+      compact.emplace_back(g, full[i].Latitude(), full[i].Longitude(),
+                           full[i].Azimuth());
+    auto t2 = chrono::steady_clock::now();
+    int nq = nquery / nrepeat;
+    vector<int> ind(nq);
+    vector<real> dist(nq);
+    for (int i = 0; i < nq; ++i) {
+      ind[i] = int(U(r) * nlines) % nlines;
+      dist[i] = real(1e7 * U(r));
+    }
+    real sum = 0;
+    double tf = timeit(full, ind, dist, nrepeat, sum),
+      tc = timeit(compact, ind, dist, nrepeat, sum);
+    double nqd = double(nq) * nrepeat;
+    cout << "Memory: GeodesicLine " << sizeof(GeodesicLine) * double(nlines)
+         << " bytes, CompactGeodesicLine "
+         << sizeof(CompactGeodesicLine) * double(nlines) << " bytes\n"
+         << "Construction: GeodesicLine "
+         << chrono::duration<double>(t1 - t0).count() * 1e9 / nlines
+         << " ns, CompactGeodesicLine "
+         << chrono::duration<double>(t2 - t1).count() * 1e9 / nlines
+         << " ns\n"
+         << "Position (" << nrepeat << " successive queries per line): "
+         << "GeodesicLine " << tf * 1e9 / nqd
+         << " ns, CompactGeodesicLine " << tc * 1e9 / nqd << " ns\n";
+    // Print sum so that the calculations aren't optimized away
+    if (!isfinite(sum)) cout << sum << "\n";
+  }
+  catch (const exception& e) {
+    cerr << "Caught exception: " << e.what() << "\n";
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,94 @@
+/**
+ * \file ExactBench.cpp
+ * \brief Time GeodesicExact and count its memory allocations
+ *
+ * Usage: ExactBench [nthreads [count]]
+ *
+ * Each thread solves count direct and count inverse problems (with all the
+ * outputs including the area) and the time per solution and the number of
+ * allocations per solution are reported.  Running with several threads
+ * shows the effect of contention in the memory allocator.
+ **********************************************************************/
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <thread>
+#include <vector>
+#include <GeographicLib/GeodesicExact.hpp>
+#include <GeographicLib/Utility.hpp>
+
+// The number of allocations made by the current thread
+static thread_local long nalloc = 0;
+
+void* operator new(std::size_t n) {
+  ++nalloc;
+  void* p = std::malloc(n ? n : 1);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+using namespace std;
+using namespace GeographicLib;
+typedef Math::real real;
+
+// Return the number of allocations in k
+static real work(const GeodesicExact& g, int count, bool direct, long& k) {
+  long k0 = nalloc;
+  real s = 0;
+  for (int i = 0; i < count; ++i) {
+    real lat1 = real(i % 89), lat2 = real(i % 61) - 30,
+      lon2 = real(i % 179) + 1, azi1 = real(i % 359),
+      s12 = real(i % 97 + 1) * 100000,
+      lat, lon, azi1a, azi2, m12, M12, M21, S12, ds12;
+    if (direct)
+      g.GenDirect(lat1, 0, azi1, false, s12, GeodesicExact::ALL,
+                  lat, lon, azi2, ds12, m12, M12, M21, S12);
+    else
+      g.GenInverse(lat1, 0, lat2, lon2, GeodesicExact::ALL,
+                   ds12, azi1a, azi2, m12, M12, M21, S12);
+    s += S12;
+  }
+  k = nalloc - k0;
+  return s;
+}
+
+int main(int argc, const char* const argv[]) {
+  try {
+    int nthreads = argc > 1 ? Utility::val<int>(string(argv[1])) : 1,
+      count = argc > 2 ? Utility::val<int>(string(argv[2])) : 100000;
+    const GeodesicExact& g = GeodesicExact::WGS84();
+    for (int direct = 0; direct < 2; ++direct) {
+      vector<real> sum(nthreads);
+      vector<long> nallocs(nthreads);
+      auto run = [&g, &sum, &nallocs, count, direct](int k) -> void {
+        long k0;
+        // Warm up, so that the thread's scratch space is set up
+        work(g, 10, direct != 0, k0);
+        sum[k] = work(g, count, direct != 0, nallocs[k]);
+      };
+      auto t0 = chrono::steady_clock::now();
+      vector<thread> threads;
+      for (int k = 1; k < nthreads; ++k)
+        threads.emplace_back(run, k);
+      run(0);
+      for (auto& t : threads) t.join();
+      auto t1 = chrono::steady_clock::now();
+      long n1 = 0;
+      for (long k : nallocs) n1 += k;
+      double nsol = double(count) * nthreads;
+      cout << (direct ? "Direct " : "Inverse ") << nthreads << " threads: "
+           << chrono::duration<double>(t1 - t0).count() * 1e9 / nsol
+           << " ns per solution (wall clock), "
+           << double(n1) / nsol << " allocations per solution\n";
+    }
+  }
+  catch (const exception& e) {
+    cerr << "Caught exception: " << e.what() << "\n";
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,108 @@
+/**
+ * \file GeoCoordsBench.cpp
+ * \brief Time GeoCoords for each combination of input and output
+ *
+ * Usage: GeoCoordsBench [num]
+ *
+ * Reset a GeoCoords object from num (default 200000) random positions given
+ * as numeric geographic coordinates and as strings (geographic coordinates,
+ * MGRS, and UTM/UPS), and request one output for each.  The time per point is reported when only
+ * the requested output is computed ("on demand") and when the full round
+ * trip is forced first by calling GeoCoords::Convergence ("full"), which
+ * was the cost of every conversion before the coordinates were computed on
+ * demand.
+ **********************************************************************/
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include <GeographicLib/GeoCoords.hpp>
+#include <GeographicLib/Utility.hpp>
+
+using namespace std;
+using namespace GeographicLib;
+typedef Math::real real;
+
+static double seconds(chrono::steady_clock::time_point t0) {
+  return chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+}
+
+// The requested outputs
+enum { LATITUDE, GEOREP, MGRSREP, UTMREP, CONVERGENCE, NOUTPUT };
+static const char* const outname[] =
+  { "Latitude", "GeoRepresentation", "MGRSRepresentation",
+    "UTMUPSRepresentation", "Convergence" };
+
+// Add output out of p to the checksum sum.
+static void output(const GeoCoords& p, int out, double& sum) {
+  switch (out) {
+  case LATITUDE:    sum += double(p.Latitude()); break;
+  case GEOREP:      sum += double(p.GeoRepresentation(3).size()); break;
+  case MGRSREP:     sum += double(p.MGRSRepresentation(3).size()); break;
+  case UTMREP:      sum += double(p.UTMUPSRepresentation(3).size()); break;
+  case CONVERGENCE: sum += double(p.Convergence()); break;
+  }
+}
+
+// Time the conversion of the inputs s (or lat, lon if s is empty) to output
+// out.  Return the time per point in ns; sum accumulates a checksum to keep
+// the optimizer honest.
+static double timeit(const vector<string>& s,
+                     const vector<real>& lat, const vector<real>& lon,
+                     int out, bool full, double& sum) {
+  GeoCoords p;
+  size_t num = s.empty() ? lat.size() : s.size();
+  auto t0 = chrono::steady_clock::now();
+  for (size_t i = 0; i < num; ++i) {
+    if (s.empty())
+      p.Reset(lat[i], lon[i]);
+    else
+      p.Reset(s[i]);
+    if (full) sum += double(p.Convergence());
+    output(p, out, sum);
+  }
+  return seconds(t0) * 1e9 / double(num);
+}
+
+int main(int argc, const char* const argv[]) {
+  try {
+    size_t num = argc > 1 ? Utility::val<size_t>(string(argv[1])) : 200000;
+    mt19937 r(42);
+    uniform_real_distribution<double> U;
+    vector<string> none, geo(num), mgrs(num), utm(num);
+    vector<real> lat(num), lon(num);
+    for (size_t i = 0; i < num; ++i) {
+      lat[i] = real(asin(2 * U(r) - 1) / Math::degree());
+      lon[i] = real(360 * U(r) - 180);
+      GeoCoords p(lat[i], lon[i]);
+      geo[i] = p.GeoRepresentation(5);
+      mgrs[i] = p.MGRSRepresentation(3);
+      utm[i] = p.UTMUPSRepresentation(3);
+    }
+    const vector<string>* input[] = { &none, &geo, &mgrs, &utm };
+    const char* const inname[] = { "lat, lon", "geographic", "MGRS",
+                                   "UTM/UPS" };
+    double sum = 0;
+    cout << "Time per point (ns)\n"
+         << left << setw(12) << "input" << setw(22) << "output" << right
+         << setw(12) << "on demand" << setw(12) << "full"
+         << setw(12) << "saving" << "\n" << fixed << setprecision(0);
+    for (int in = 0; in < 4; ++in)
+      for (int out = 0; out < NOUTPUT; ++out) {
+        double tlazy = timeit(*input[in], lat, lon, out, false, sum),
+          tfull = timeit(*input[in], lat, lon, out, true, sum);
+        cout << left << setw(12) << inname[in] << setw(22) << outname[out]
+             << right << setw(12) << tlazy << setw(12) << tfull
+             << setw(11) << 100 * (1 - tlazy / tfull) << "%\n";
+      }
+    cout << "Checksum " << setprecision(3) << sum << "\n";
+  }
+  catch (const exception& e) {
+    cerr << "Caught exception: " << e.what() << "\n";
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,75 @@
+/**
+ * \file JacobiConformalBench.cpp
+ * \brief Time the scalar and array versions of JacobiConformal
+ *
+ * Usage: JacobiConformalBench [a b c [num [nthreads]]]
+ *
+ * Project num (default 1000000) random points with the scalar and array
+ * versions of JacobiConformal::x and JacobiConformal::y, and with the array
+ * versions using nthreads (default 0, i.e., all available) threads.  The
+ * default semi-axes (a, b, c) = (286.3, 278.6, 223.2), in km, are those of
+ * the asteroid Vesta.  The time per point and the maximum difference (in
+ * degrees) between the scalar and array results are reported.
+ **********************************************************************/
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+#include <GeographicLib/JacobiConformal.hpp>
+#include <GeographicLib/Utility.hpp>
+
+using namespace std;
+using namespace GeographicLib;
+typedef Math::real real;
+
+static double seconds(chrono::steady_clock::time_point t0) {
+  return chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+}
+
+int main(int argc, const char* const argv[]) {
+  try {
+    real a = argc > 3 ? Utility::val<real>(string(argv[1])) : real(286.3),
+      b = argc > 3 ? Utility::val<real>(string(argv[2])) : real(278.6),
+      c = argc > 3 ? Utility::val<real>(string(argv[3])) : real(223.2);
+    size_t num = argc > 4 ? Utility::val<size_t>(string(argv[4])) : 1000000;
+    int nthreads = argc > 5 ? Utility::val<int>(string(argv[5])) : 0;
+    auto t0 = chrono::steady_clock::now();
+    JacobiConformal jc(a, b, c);
+    double tinit = seconds(t0);
+    mt19937 r(42);
+    uniform_real_distribution<double> U;
+    vector<real> omg(num), bet(num), x(num), y(num), xs(num), ys(num);
+    for (size_t i = 0; i < num; ++i) {
+      omg[i] = real(360 * U(r) - 180); bet[i] = real(360 * U(r) - 180);
+    }
+    t0 = chrono::steady_clock::now();
+    for (size_t i = 0; i < num; ++i) {
+      xs[i] = jc.x(omg[i]); ys[i] = jc.y(bet[i]);
+    }
+    double tscalar = seconds(t0);
+    t0 = chrono::steady_clock::now();
+    jc.x(num, omg.data(), x.data());
+    jc.y(num, bet.data(), y.data());
+    double tarray = seconds(t0);
+    real err = 0;
+    for (size_t i = 0; i < num; ++i)
+      err = fmax(err, fmax(fabs(x[i] - xs[i]), fabs(y[i] - ys[i])));
+    Executor exec(nthreads);
+    t0 = chrono::steady_clock::now();
+    jc.x(exec, num, omg.data(), x.data());
+    jc.y(exec, num, bet.data(), y.data());
+    double tparallel = seconds(t0);
+    cout << "Constructor: " << tinit * 1e6 << " us\n"
+         << "Scalar: " << tscalar * 1e9 / num << " ns per point\n"
+         << "Array: " << tarray * 1e9 / num << " ns per point\n"
+         << "Array with " << exec.Threads() << " threads: "
+         << tparallel * 1e9 / num << " ns per point\n"
+         << "Max difference array vs scalar: " << err << " deg\n";
+  }
+  catch (const exception& e) {
+    cerr << "Caught exception: " << e.what() << "\n";
+    return 1;
+  }
+  return 0;
+}
@@ -1,6 +1,8 @@
 // Write out a gtx file of geoid heights above the ellipsoid.  For egm2008 at
 // 1' resolution this takes about 10 mins on a 8-processor Intel 3.0 GHz
-// machine using OpenMP.
+// machine.  The latitudes in each batch are computed in parallel using an
+// Executor; an optional 4th argument gives the number of threads (default:
+// all the available threads).
 //
 // For the format of gtx files, see
 // https://vdatum.noaa.gov/docs/gtx_info.html#dev_gtx_binary
@@ -20,16 +22,7 @@
 #include <string>
 #include <algorithm>
 
-#if defined(_OPENMP)
-#define HAVE_OPENMP 1
-#else
-#define HAVE_OPENMP 0
-#endif
-
-#if HAVE_OPENMP
-#  include <omp.h>
-#endif
-
+#include <GeographicLib/Executor.hpp>
 #include <GeographicLib/GravityModel.hpp>
 #include <GeographicLib/GravityCircle.hpp>
 #include <GeographicLib/Utility.hpp>
@@ -38,13 +31,14 @@ using namespace std;
 using namespace GeographicLib;
 
 int main(int argc, const char* const argv[]) {
-  // Hardwired for 3 args:
+  // Hardwired for 3 or 4 args:
   // 1 = the gravity model (e.g., egm2008)
   // 2 = intervals per degree
   // 3 = output GTX file
-  if (argc != 4) {
+  // 4 = number of threads (optional)
+  if (!(argc == 4 || argc == 5)) {
     cerr << "Usage: " << argv[0]
-         << " gravity-model intervals-per-degree output.gtx\n";
+         << " gravity-model intervals-per-degree output.gtx [threads]\n";
     return 1;
   }
   try {
@@ -54,6 +48,8 @@ int main(int argc, const char* const argv[]) {
     // Number of intervals per degree
     int ndeg = Utility::val<int>(string(argv[2]));
     string filename(argv[3]);
+    // One latitude per chunk
+    Executor exec(argc == 5 ? Utility::val<int>(string(argv[4])) : 0, 1);
     GravityModel g(model);
     int
       nlat = 180 * ndeg + 1,
@@ -80,21 +76,22 @@ int main(int argc, const char* const argv[]) {
     for (int ilat0 = 0; ilat0 < nlat; ilat0 += nbatch) { // Loop over batches
       int nlat0 = min(nlat, ilat0 + nbatch);
 
-#if HAVE_OPENMP
-#  pragma omp parallel for
-#endif
-      for (int ilat = ilat0; ilat < nlat0; ++ilat) { // Loop over latitudes
-        Utility::set_digits(ndigits);                // Set the precision
-        Math::real
-          lat = latorg + (ilat / ndeg) + delta * (ilat - ndeg * (ilat / ndeg)),
-          h = 0;
-        GravityCircle c(g.Circle(lat, h, GravityModel::GEOID_HEIGHT));
-        for (int ilon = 0; ilon < nlon; ++ilon) { // Loop over longitudes
-          Math::real lon = lonorg
-            + (ilon / ndeg) + delta * (ilon - ndeg * (ilon / ndeg));
-          N[ilat - ilat0][ilon] = float(c.GeoidHeight(lon));
-        } // longitude loop
-      }   // latitude loop -- end of parallel section
+      exec.For(nlat0 - ilat0, [&](size_t i0, size_t i1) -> void {
+        Utility::set_digits(ndigits);              // Set the precision
+        for (int ilat = ilat0 + int(i0); ilat < ilat0 + int(i1); ++ilat) {
+          // Loop over latitudes
+          Math::real
+            lat = latorg + (ilat / ndeg)
+            + delta * (ilat - ndeg * (ilat / ndeg)),
+            h = 0;
+          GravityCircle c(g.Circle(lat, h, GravityModel::GEOID_HEIGHT));
+          for (int ilon = 0; ilon < nlon; ++ilon) { // Loop over longitudes
+            Math::real lon = lonorg
+              + (ilon / ndeg) + delta * (ilon - ndeg * (ilon / ndeg));
+            N[ilat - ilat0][ilon] = float(c.GeoidHeight(lon));
+          } // longitude loop
+        }   // latitude loop
+      });   // end of parallel section
 
       for (int ilat = ilat0; ilat < nlat0; ++ilat) // write out data
         Utility::writearray<float, float, true>(file, N[ilat - ilat0]);
@@ -0,0 +1,58 @@
+// Example of using the GeographicLib::Arrow class
+
+#include <iostream>
+#include <exception>
+#include <vector>
+#include <GeographicLib/Arrow.hpp>
+#include <GeographicLib/Geodesic.hpp>
+
+using namespace std;
+using namespace GeographicLib;
+
+// Normally the input comes from an Arrow producer (e.g., pyarrow's
+// RecordBatch._export_to_c); here it is assembled by hand.
+static void norelease(ArrowArray* a) { a->release = nullptr; }
+static void norelease(ArrowSchema* s) { s->release = nullptr; }
+
+int main() {
+  try {
+    const Geodesic& geod = Geodesic::WGS84();
+    // JFK, LHR, and SIN to NRT
+    vector<double>
+      lat1{40.6, 51.6, 1.4}, lon1{-73.8, -0.5, 104.0},
+      lat2{35.8, 35.8, 35.8}, lon2{140.4, 140.4, 140.4};
+    const char* names[] = {"lat1", "lon1", "lat2", "lon2"};
+    const double* data[] = {lat1.data(), lon1.data(), lat2.data(), lon2.data()};
+    const void* buffers[4][2];
+    ArrowArray fields[4], *pfields[4];
+    ArrowSchema schemas[4], *pschemas[4];
+    for (int k = 0; k < 4; ++k) {
+      buffers[k][0] = nullptr; buffers[k][1] = data[k];
+      fields[k] = ArrowArray{3, 0, 0, 2, 0, buffers[k], nullptr, nullptr,
+                             norelease, nullptr};
+      schemas[k] = ArrowSchema{"g", names[k], nullptr, 0, 0, nullptr, nullptr,
+                               norelease, nullptr};
+      pfields[k] = &fields[k]; pschemas[k] = &schemas[k];
+    }
+    const void* sbuffers[1] = {nullptr};
+    ArrowArray array{3, 0, 0, 1, 4, sbuffers, pfields, nullptr,
+                     norelease, nullptr};
+    ArrowSchema schema{"+s", "", nullptr, 0, 4, pschemas, nullptr,
+                       norelease, nullptr};
+    // Solve the inverse problems; the result has fields s12, azi1, azi2
+    ArrowSchema outschema;
+    ArrowArray outarray;
+    Arrow::Inverse(geod, &schema, &array, &outschema, &outarray);
+    const double* s12 =
+      static_cast<const double*>(outarray.children[0]->buffers[1]);
+    for (int64_t i = 0; i < outarray.length; ++i)
+      cout << s12[i] / 1000 << "\n"; // distances in km
+    // The consumer releases the output
+    outarray.release(&outarray);
+    outschema.release(&outschema);
+  }
+  catch (const exception& e) {
+    cerr << "Caught exception: " << e.what() << "\n";
+    return 1;
+  }
+}
@@ -0,0 +1,46 @@
+// Example of using the GeographicLib::CompactGeodesicLine class
+
+#include <iostream>
+#include <iomanip>
+#include <exception>
+#include <vector>
+#include <GeographicLib/Geodesic.hpp>
+#include <GeographicLib/GeodesicLine.hpp>
+#include <GeographicLib/CompactGeodesicLine.hpp>
+
+using namespace std;
+using namespace GeographicLib;
+
+int main() {
+  try {
+    const Geodesic& geod = Geodesic::WGS84();
+    // Store the routes from JFK to a number of destinations
+    double lat1 = 40.640, lon1 = -73.779; // JFK
+    double dest[][2] = {
+      {  1.359, 103.989},           // SIN
+      { 51.470,  -0.454},           // LHR
+      {-33.946, 151.177},           // SYD
+    };
+    vector<CompactGeodesicLine> routes;
+    vector<double> dist;
+    for (auto& d : dest) {
+      GeodesicLine line = geod.InverseLine(lat1, lon1, d[0], d[1]);
+      routes.push_back(CompactGeodesicLine(geod, line));
+      dist.push_back(line.Distance());
+    }
+    cout << "Size of GeodesicLine " << sizeof(GeodesicLine)
+         << " bytes; size of CompactGeodesicLine "
+         << sizeof(CompactGeodesicLine) << " bytes\n";
+    // Print the midpoints of the routes
+    cout << fixed << setprecision(3);
+    for (size_t i = 0; i < routes.size(); ++i) {
+      double lat, lon;
+      routes[i].Position(dist[i] / 2, lat, lon);
+      cout << lat << " " << lon << "\n";
+    }
+  }
+  catch (const exception& e) {
+    cerr << "Caught exception: " << e.what() << "\n";
+    return 1;
+  }
+}
@@ -0,0 +1,40 @@
+// Example of using the GeographicLib::CrossTrack class
+
+#include <iostream>
+#include <exception>
+#include <vector>
+#include <GeographicLib/CrossTrack.hpp>
+
+using namespace std;
+using namespace GeographicLib;
+
+int main() {
+  try {
+    CrossTrack ct(Geodesic::WGS84());
+    {
+      // Distance from Reykjavik to the segment JFK to LHR
+      double along, xtrack,
+        d = ct.Distance(40.6, -73.8, 51.6, -0.5, 64.1, -21.9, along, xtrack);
+      cout << d / 1000 << " " << along / 1000 << " " << xtrack / 1000 << "\n";
+    }
+    {
+      // Find the nearest legs of a route (JFK, LHR, DXB, SIN) to some
+      // airports (KEF, IST, DEL)
+      vector<double>
+        lat{40.6, 51.6, 25.3, 1.4}, lon{-73.8, -0.5, 55.4, 104.0},
+        qlat{64.0, 41.3, 28.6}, qlon{-22.6, 28.8, 77.1};
+      ct.Reset(lat.size() - 1, lat.data(), lon.data(),
+               lat.data() + 1, lon.data() + 1);
+      vector<int> seg(qlat.size());
+      vector<double> dist(qlat.size());
+      ct.Nearest(Executor(), qlat.size(), qlat.data(), qlon.data(),
+                 seg.data(), dist.data());
+      for (size_t i = 0; i < qlat.size(); ++i)
+        cout << seg[i] << " " << dist[i] / 1000 << "\n";
+    }
+  }
+  catch (const exception& e) {
+    cerr << "Caught exception: " << e.what() << "\n";
+    return 1;
+  }
+}
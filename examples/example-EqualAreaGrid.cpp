@@ -0,0 +1,38 @@
+// Example of using the GeographicLib::EqualAreaGrid class
+
+#include <iostream>
+#include <exception>
+#include <vector>
+#include <GeographicLib/EqualAreaGrid.hpp>
+
+using namespace std;
+using namespace GeographicLib;
+
+int main() {
+  try {
+    // Cells with sides of about 1 degree on the WGS84 ellipsoid
+    EqualAreaGrid grid(Constants::WGS84_a(), Constants::WGS84_f(), 180);
+    cout << grid.NumCells() << " cells of area "
+         << grid.Area(grid.NumCells() / 2) / 1e6 << " km^2\n";
+    {
+      // Which cell contains JFK?
+      int c = grid.Cell(40.6, -73.8);
+      double lat0, lat1, lon0, lon1;
+      grid.Bounds(c, lat0, lat1, lon0, lon1);
+      cout << c << " " << lat0 << " " << lat1 << " "
+           << lon0 << " " << lon1 << "\n";
+    }
+    {
+      // Count some points using several threads
+      vector<double> lat{40.6, 40.7, 51.6, -33.9}, lon{-73.8, -73.9, -0.5, 151.2};
+      vector<unsigned long long> counts;
+      grid.Histogram(Executor(), lat.size(), lat.data(), lon.data(), counts);
+      for (size_t c = 0; c < counts.size(); ++c)
+        if (counts[c]) cout << c << " " << counts[c] << "\n";
+    }
+  }
+  catch (const exception& e) {
+    cerr << "Caught exception: " << e.what() << "\n";
+    return 1;
+  }
+}
@@ -0,0 +1,54 @@
+// Example of using the GeographicLib::Executor class
+
+#include <iostream>
+#include <exception>
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <GeographicLib/Executor.hpp>
+#include <GeographicLib/OSGB.hpp>
+
+using namespace std;
+using namespace GeographicLib;
+
+int main() {
+  try {
+    // Use all the available threads
+    Executor exec;
+    size_t num = 1000000;
+    vector<double> lat(num), lon(num), x(num), y(num);
+    for (size_t i = 0; i < num; ++i) {
+      lat[i] = 50 + 8 * double(i) / num;
+      lon[i] = -5 + 6 * double(i) / num;
+    }
+    // Convert the points in parallel
+    OSGB::Forward(exec, num, lat.data(), lon.data(), x.data(), y.data());
+    // Process a range using an arbitrary function
+    double sum = 0;
+    mutex m;
+    exec.For(num, [&](size_t i0, size_t i1) -> void {
+      double s = 0;
+      for (size_t i = i0; i < i1; ++i) s += x[i];
+      lock_guard<mutex> lock(m);
+      sum += s;
+    });
+    cout << exec.Threads() << " " << sum / num << "\n";
+    // An Executor using a user-supplied scheduler; here the scheduler
+    // starts a thread for each of 4 parts of the range.  A real application
+    // would hand the range to its own thread pool (TBB, asio, etc.).
+    Executor exec4([](size_t n, size_t grain,
+                      const Executor::work& f) -> void {
+                     size_t m = min(size_t(4), (n + grain - 1) / grain);
+                     vector<thread> threads;
+                     for (size_t k = 0; k < m; ++k)
+                       threads.emplace_back(f, k * n / m, (k + 1) * n / m);
+                     for (auto& t : threads) t.join();
+                   }, 4);
+    OSGB::Forward(exec4, num, lat.data(), lon.data(), x.data(), y.data());
+    cout << exec4.Threads() << " " << x[num/2] << " " << y[num/2] << "\n";
+  }
+  catch (const exception& e) {
+    cerr << "Caught exception: " << e.what() << "\n";
+    return 1;
+  }
+}
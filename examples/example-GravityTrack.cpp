@@ -0,0 +1,41 @@
+// Example of using the GeographicLib::GravityTrack class
+// This requires that the egm96 gravity model be installed; see
+// https://geographiclib.sourceforge.io/C++/doc/gravity.html#gravityinst
+
+#include <iostream>
+#include <exception>
+#include <GeographicLib/GravityModel.hpp>
+#include <GeographicLib/GravityTrack.hpp>
+
+using namespace std;
+using namespace GeographicLib;
+
+int main() {
+  try {
+    GravityModel grav("egm96");
+    // A ship track starting in the Bay of Biscay heading north west
+    double lat0 = 45.5, lon0 = -5.2, h = 0;
+    {
+      // Slow method of evaluating the geoid height along a track
+      for (int i = 0; i <= 10; ++i) {
+        double lat = lat0 + i * 0.001, lon = lon0 - i * 0.001;
+        cout << lat << " " << lon << " "
+             << grav.GeoidHeight(lat, lon) << "\n";
+      }
+    }
+    {
+      // Fast method of evaluating the geoid height along a track using
+      // GravityTrack with a relative accuracy of 1e-7.
+      GravityTrack track(grav, h, 1e-7);
+      for (int i = 0; i <= 10; ++i) {
+        double lat = lat0 + i * 0.001, lon = lon0 - i * 0.001;
+        cout << lat << " " << lon << " "
+             << track.GeoidHeight(lat, lon) << "\n";
+      }
+    }
+  }
+  catch (const exception& e) {
+    cerr << "Caught exception: " << e.what() << "\n";
+    return 1;
+  }
+}
@@ -0,0 +1,26 @@
+// Example of using the GeographicLib::Helmert class
+
+#include <iostream>
+#include <iomanip>
+#include <exception>
+#include <GeographicLib/Helmert.hpp>
+
+using namespace std;
+using namespace GeographicLib;
+
+int main() {
+  try {
+    // WGS 72 to WGS 84 (position vector convention)
+    Helmert wgs72to84(0, 0, 4.5, 0, 0, 0.554, 0.219);
+    double X = 3657660.66, Y = 255768.55, Z = 5201382.11, X1, Y1, Z1;
+    wgs72to84.Forward(X, Y, Z, X1, Y1, Z1);
+    cout << fixed << setprecision(2)
+         << X1 << " " << Y1 << " " << Z1 << "\n";
+    wgs72to84.Reverse(X1, Y1, Z1, X, Y, Z);
+    cout << X << " " << Y << " " << Z << "\n";
+  }
+  catch (const exception& e) {
+    cerr << "Caught exception: " << e.what() << "\n";
+    return 1;
+  }
+}
@@ -3,8 +3,9 @@
 #include <iostream>
 #include <iomanip>
 #include <exception>
+#include <vector>
 #include <GeographicLib/Utility.hpp>
-#include "JacobiConformal.hpp"
+#include <GeographicLib/JacobiConformal.hpp>
 
 using namespace std;
 using namespace GeographicLib;
@@ -24,7 +25,7 @@ int main() {
     //    a/(a-b) = 91449 +/- 60
     // which gives: a = 6378171.36, b = 6378101.61, c = 6356751.84
     Math::real a = 6378137+35, b = 6378137-35, c = 6356752;
-    experimental::JacobiConformal jc(a, b, c, a-b, b-c);
+    JacobiConformal jc(a, b, c, a-b, b-c);
     cout  << fixed << setprecision(1)
           << "Ellipsoid parameters: a = "
           << a << ", b = " << b << ", c = " << c << "\n"
@@ -35,6 +36,15 @@ int main() {
       Math::real omg = i, bet = i;
       cout << i << " " << jc.x(omg) << " " << jc.y(bet) << "\n";
     }
+    // Project many points at once (using 4 threads)
+    vector<Math::real> ang, x(19), y(19);
+    for (int i = 0; i <= 90; i += 5) ang.push_back(i);
+    Executor exec(4);
+    jc.x(exec, ang.size(), ang.data(), x.data());
+    jc.y(exec, ang.size(), ang.data(), y.data());
+    cout << "The same using the array versions:\n";
+    for (size_t i = 0; i < ang.size(); ++i)
+      cout << int(ang[i]) << " " << x[i] << " " << y[i] << "\n";
   }
   catch (const exception& e) {
     cerr << "Caught exception: " << e.what() << "\n";
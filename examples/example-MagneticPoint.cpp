@@ -0,0 +1,43 @@
+// Example of using the GeographicLib::MagneticPoint class
+// This requires that the wmm2020 magnetic model be installed; see
+// https://geographiclib.sourceforge.io/C++/doc/magnetic.html#magneticinst
+
+#include <iostream>
+#include <exception>
+#include <GeographicLib/MagneticModel.hpp>
+#include <GeographicLib/MagneticPoint.hpp>
+
+using namespace std;
+using namespace GeographicLib;
+
+int main() {
+  try {
+    MagneticModel mag("wmm2020");
+    double lat = 27.99, lon = 86.93, h = 8820; // Mt Everest
+    {
+      // Slow method of evaluating the values at several times at a fixed
+      // point.
+      for (int i = 0; i <= 10; ++i) {
+        double t = 2020 + i * 0.5;
+        double Bx, By, Bz;
+        mag(t, lat, lon, h, Bx, By, Bz);
+        cout << t << " " << Bx << " " << By << " " << Bz << "\n";
+      }
+    }
+    {
+      // Fast method of evaluating the values at several times at a fixed
+      // point using MagneticPoint.
+      MagneticPoint pt = mag.Point(lat, lon, h);
+      for (int i = 0; i <= 10; ++i) {
+        double t = 2020 + i * 0.5;
+        double Bx, By, Bz;
+        pt(t, Bx, By, Bz);
+        cout << t << " " << Bx << " " << By << " " << Bz << "\n";
+      }
+    }
+  }
+  catch (const exception& e) {
+    cerr << "Caught exception: " << e.what() << "\n";
+    return 1;
+  }
+}
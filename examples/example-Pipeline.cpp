@@ -0,0 +1,38 @@
+// Example of using the GeographicLib::Pipeline class
+
+#include <iostream>
+#include <iomanip>
+#include <exception>
+#include <vector>
+#include <GeographicLib/Pipeline.hpp>
+#include <GeographicLib/Geocentric.hpp>
+#include <GeographicLib/Helmert.hpp>
+
+using namespace std;
+using namespace GeographicLib;
+
+int main() {
+  try {
+    // Convert WGS 72 geodetic coordinates to UTM on WGS 84.  To convert the
+    // heights to heights above the geoid, add the step GeoidHeight(geoid)
+    // before ToUTMUPS().
+    Geocentric wgs72(6378135, 1/298.26), wgs84(Geocentric::WGS84());
+    Helmert wgs72to84(0, 0, 4.5, 0, 0, 0.554, 0.219);
+    Pipeline p(Pipeline::GEODETIC);
+    p.ToGeocentric(wgs72).Shift(wgs72to84).ToGeodetic(wgs84).ToUTMUPS();
+    vector<double> lat{40.6, 51.6, -33.9}, lon{-73.8, -0.5, 151.2},
+      h{10, 20, 30}, x(lat.size()), y(lat.size()), z(lat.size());
+    vector<int> zone(lat.size());
+    bool northp[3];
+    p.Run(Executor(), lat.size(), lat.data(), lon.data(), h.data(),
+          x.data(), y.data(), z.data(), zone.data(), northp);
+    cout << fixed << setprecision(2);
+    for (size_t i = 0; i < lat.size(); ++i)
+      cout << zone[i] << (northp[i] ? "n " : "s ")
+           << x[i] << " " << y[i] << " " << z[i] << "\n";
+  }
+  catch (const exception& e) {
+    cerr << "Caught exception: " << e.what() << "\n";
+    return 1;
+  }
+}
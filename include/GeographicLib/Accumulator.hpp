@@ -135,6 +135,16 @@ namespace GeographicLib {
      * @param[in] y set \e sum -= \e y.
      **********************************************************************/
     Accumulator& operator-=(T y) { Add(-y); return *this; }
+    /**
+     * Add another accumulator to the accumulator.
+     *
+     * @param[in] a set \e sum += \e a.
+     *
+     * This allows partial sums computed separately (e.g., in different
+     * threads) to be combined.
+     **********************************************************************/
+    Accumulator& operator+=(const Accumulator& a)
+    { Add(a._t); Add(a._s); return *this; }
     /**
      * Multiply accumulator by an integer.  To avoid loss of accuracy, use only
      * integers such that \e n &times; \e T is exactly representable as a \e T
@@ -0,0 +1,293 @@
+/**
+ * \file Arrow.hpp
+ * \brief Header for GeographicLib::Arrow class
+ *
+ * Copyright (c) Charles Karney (2026) <karney@alum.mit.edu> and licensed
+ * under the MIT/X11 License.  For more information, see
+ * https://geographiclib.sourceforge.io/
+ **********************************************************************/
+
+#if !defined(GEOGRAPHICLIB_ARROW_HPP)
+#define GEOGRAPHICLIB_ARROW_HPP 1
+
+#include <cstdint>
+#include <GeographicLib/Constants.hpp>
+#include <GeographicLib/Executor.hpp>
+
+// The Arrow C data interface; see
+// https://arrow.apache.org/docs/format/CDataInterface.html
+// These definitions are part of the Arrow ABI and are guarded by the macro
+// specified by Arrow so that they can coexist with the Arrow headers.
+#if !defined(ARROW_C_DATA_INTERFACE)
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+extern "C" {
+
+  /// \cond SKIP
+  struct ArrowSchema {
+    // Array type description
+    const char* format;
+    const char* name;
+    const char* metadata;
+    int64_t flags;
+    int64_t n_children;
+    struct ArrowSchema** children;
+    struct ArrowSchema* dictionary;
+
+    // Release callback
+    void (*release)(struct ArrowSchema*);
+    // Opaque producer-specific data
+    void* private_data;
+  };
+
+  struct ArrowArray {
+    // Array data description
+    int64_t length;
+    int64_t null_count;
+    int64_t offset;
+    int64_t n_buffers;
+    int64_t n_children;
+    const void** buffers;
+    struct ArrowArray** children;
+    struct ArrowArray* dictionary;
+
+    // Release callback
+    void (*release)(struct ArrowArray*);
+    // Opaque producer-specific data
+    void* private_data;
+  };
+  /// \endcond
+
+}  // extern "C"
+
+#endif  // ARROW_C_DATA_INTERFACE
+
+namespace GeographicLib {
+
+  class Geodesic;
+  class Geoid;
+
+  /**
+   * \brief Batch operations on Apache Arrow data
+   *
+   * These functions let the batch versions of Geodesic::Direct,
+   * Geodesic::Inverse, UTMUPS::Forward, UTMUPS::Reverse, Geoid::operator(),
+   * and PolygonAreaT::AddPoints operate on data supplied using the <a
+   * href="https://arrow.apache.org/docs/format/CDataInterface.html"> Arrow C
+   * data interface</a>.  This is a plain C ABI, so no Arrow library is
+   * needed.
+   *
+   * The input is a struct array (format "+s", e.g., an exported record
+   * batch) whose fields are identified by name; other fields are ignored.
+   * Floating point fields may be float64 ("g") or float32 ("f").  If the
+   * type of a field matches Math::real and there are no nulls, the
+   * field's buffer is used in place without copying.  Otherwise it is
+   * converted to Math::real with nulls replaced by NaNs.  The caller retains
+   * ownership of the input.
+   *
+   * The output is a newly allocated struct array; the floating point
+   * fields are float64.  A row of the output is null if the corresponding
+   * row of the input (or any of the fields used) is null.  The caller must
+   * call the \e release callbacks of the output array and schema when
+   * done with them.  The results are computed directly into the output
+   * buffers.
+   *
+   * Each function takes an optional leading Executor argument which
+   * specifies how the work is split between threads.
+   *
+   * If the input doesn't have the expected layout, a GeographicErr
+   * exception is thrown and the output is not set.  Errors from the
+   * underlying batch functions are likewise reported by exceptions.
+   *
+   * Example of use:
+   * \include example-Arrow.cpp
+   **********************************************************************/
+  class GEOGRAPHICLIB_EXPORT Arrow {
+  public:
+
+    /**
+     * Solve the direct geodesic problem for Arrow data.
+     *
+     * @param[in] exec the Executor used to split the work between threads.
+     * @param[in] g the Geodesic object.
+     * @param[in] schema the schema of the input.
+     * @param[in] array the input, a struct array with fields \e lat1, \e
+     *   lon1, \e azi1, and \e s12.
+     * @param[out] outschema the schema of the output.
+     * @param[out] outarray the output, a struct array with fields \e lat2,
+     *   \e lon2, and \e azi2.
+     * @exception GeographicErr if the input is malformed.
+     **********************************************************************/
+    static void Direct(const Executor& exec, const Geodesic& g,
+                       const ArrowSchema* schema, const ArrowArray* array,
+                       ArrowSchema* outschema, ArrowArray* outarray);
+
+    /**
+     * Solve the inverse geodesic problem for Arrow data.
+     *
+     * @param[in] exec the Executor used to split the work between threads.
+     * @param[in] g the Geodesic object.
+     * @param[in] schema the schema of the input.
+     * @param[in] array the input, a struct array with fields \e lat1, \e
+     *   lon1, \e lat2, and \e lon2.
+     * @param[out] outschema the schema of the output.
+     * @param[out] outarray the output, a struct array with fields \e s12,
+     *   \e azi1, and \e azi2.
+     * @exception GeographicErr if the input is malformed.
+     **********************************************************************/
+    static void Inverse(const Executor& exec, const Geodesic& g,
+                        const ArrowSchema* schema, const ArrowArray* array,
+                        ArrowSchema* outschema, ArrowArray* outarray);
+
+    /**
+     * Convert geographic coordinates in Arrow data to UTM/UPS.
+     *
+     * @param[in] exec the Executor used to split the work between threads.
+     * @param[in] schema the schema of the input.
+     * @param[in] array the input, a struct array with fields \e lat and \e
+     *   lon.
+     * @param[out] outschema the schema of the output.
+     * @param[out] outarray the output, a struct array with fields \e zone
+     *   (int32), \e northp (boolean), \e x, \e y, \e gamma, and \e k.
+     * @param[in] setzone zone override applied to all the points
+     *   (optional).
+     * @exception GeographicErr if the input is malformed or if a point
+     *   can't be converted (see UTMUPS::Forward).
+     **********************************************************************/
+    static void UTMUPSForward(const Executor& exec,
+                              const ArrowSchema* schema,
+                              const ArrowArray* array,
+                              ArrowSchema* outschema, ArrowArray* outarray,
+                              int setzone = -1);
+
+    /**
+     * Convert UTM/UPS coordinates in Arrow data to geographic.
+     *
+     * @param[in] exec the Executor used to split the work between threads.
+     * @param[in] schema the schema of the input.
+     * @param[in] array the input, a struct array with fields \e zone
+     *   (int32), \e northp (boolean), \e x, and \e y.
+     * @param[out] outschema the schema of the output.
+     * @param[out] outarray the output, a struct array with fields \e lat,
+     *   \e lon, \e gamma, and \e k.
+     * @exception GeographicErr if the input is malformed or if a point
+     *   can't be converted (see UTMUPS::Reverse).
+     **********************************************************************/
+    static void UTMUPSReverse(const Executor& exec,
+                              const ArrowSchema* schema,
+                              const ArrowArray* array,
+                              ArrowSchema* outschema, ArrowArray* outarray);
+
+    /**
+     * Evaluate the geoid height for Arrow data.
+     *
+     * @param[in] exec the Executor used to split the work between threads.
+     * @param[in] geoid the Geoid object.
+     * @param[in] schema the schema of the input.
+     * @param[in] array the input, a struct array with fields \e lat and \e
+     *   lon.
+     * @param[out] outschema the schema of the output.
+     * @param[out] outarray the output, a struct array with the field \e h.
+     * @exception GeographicErr if the input is malformed or if there's a
+     *   problem reading the geoid data.
+     *
+     * The work is only split between threads if \e geoid is thread-safe;
+     * see Geoid::operator()(const Executor&, size_t, const real[],
+     * const real[], real[]) const.
+     **********************************************************************/
+    static void GeoidHeight(const Executor& exec, const Geoid& geoid,
+                            const ArrowSchema* schema, const ArrowArray* array,
+                            ArrowSchema* outschema, ArrowArray* outarray);
+
+    /**
+     * Compute the perimeters and areas of polygons given as Arrow data.
+     *
+     * @param[in] exec the Executor used to split the work between threads.
+     * @param[in] g the Geodesic object.
+     * @param[in] polyline if true compute the lengths of polylines instead.
+     * @param[in] schema the schema of the input.
+     * @param[in] array the input, a list array (format "+l" or "+L") of
+     *   struct arrays with fields \e lat and \e lon; each element of the
+     *   list gives the vertices of one polygon.
+     * @param[out] outschema the schema of the output.
+     * @param[out] outarray the output, a struct array with fields \e num
+     *   (int32), \e perimeter, and \e area; the area is NaN for polylines.
+     * @exception GeographicErr if the input is malformed.
+     *
+     * The vertices of each polygon are passed to PolygonAreaT::AddPoints and
+     * the results are then given by PolygonAreaT::Compute with \e reverse =
+     * false and \e sign = true.  The polygons are processed in parallel.
+     **********************************************************************/
+    static void PolygonAreas(const Executor& exec, const Geodesic& g,
+                             bool polyline,
+                             const ArrowSchema* schema,
+                             const ArrowArray* array,
+                             ArrowSchema* outschema, ArrowArray* outarray);
+
+    /**
+     * Arrow::Direct without an Executor.
+     **********************************************************************/
+    static void Direct(const Geodesic& g,
+                       const ArrowSchema* schema, const ArrowArray* array,
+                       ArrowSchema* outschema, ArrowArray* outarray) {
+      Direct(Executor::Serial(), g, schema, array, outschema, outarray);
+    }
+
+    /**
+     * Arrow::Inverse without an Executor.
+     **********************************************************************/
+    static void Inverse(const Geodesic& g,
+                        const ArrowSchema* schema, const ArrowArray* array,
+                        ArrowSchema* outschema, ArrowArray* outarray) {
+      Inverse(Executor::Serial(), g, schema, array, outschema, outarray);
+    }
+
+    /**
+     * Arrow::UTMUPSForward without an Executor.
+     **********************************************************************/
+    static void UTMUPSForward(const ArrowSchema* schema,
+                              const ArrowArray* array,
+                              ArrowSchema* outschema, ArrowArray* outarray,
+                              int setzone = -1) {
+      UTMUPSForward(Executor::Serial(), schema, array, outschema, outarray,
+                    setzone);
+    }
+
+    /**
+     * Arrow::UTMUPSReverse without an Executor.
+     **********************************************************************/
+    static void UTMUPSReverse(const ArrowSchema* schema,
+                              const ArrowArray* array,
+                              ArrowSchema* outschema, ArrowArray* outarray) {
+      UTMUPSReverse(Executor::Serial(), schema, array, outschema, outarray);
+    }
+
+    /**
+     * Arrow::GeoidHeight without an Executor.
+     **********************************************************************/
+    static void GeoidHeight(const Geoid& geoid,
+                            const ArrowSchema* schema, const ArrowArray* array,
+                            ArrowSchema* outschema, ArrowArray* outarray) {
+      GeoidHeight(Executor::Serial(), geoid, schema, array,
+                  outschema, outarray);
+    }
+
+    /**
+     * Arrow::PolygonAreas without an Executor.
+     **********************************************************************/
+    static void PolygonAreas(const Geodesic& g, bool polyline,
+                             const ArrowSchema* schema,
+                             const ArrowArray* array,
+                             ArrowSchema* outschema, ArrowArray* outarray) {
+      PolygonAreas(Executor::Serial(), g, polyline, schema, array,
+                   outschema, outarray);
+    }
+  };
+
+} // namespace GeographicLib
+
+#endif  // GEOGRAPHICLIB_ARROW_HPP
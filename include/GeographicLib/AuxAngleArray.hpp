@@ -0,0 +1,201 @@
+/**
+ * \file AuxAngleArray.hpp
+ * \brief Header for the GeographicLib::AuxAngleArray class
+ *
+ * Copyright (c) Charles Karney (2026) <karney@alum.mit.edu> and licensed
+ * under the MIT/X11 License.  For more information, see
+ * https://geographiclib.sourceforge.io/
+ **********************************************************************/
+
+#if !defined(GEOGRAPHICLIB_AUXANGLEARRAY_HPP)
+#define GEOGRAPHICLIB_AUXANGLEARRAY_HPP 1
+
+#include <cstddef>
+#include <vector>
+#include <GeographicLib/AuxAngle.hpp>
+
+#if defined(_MSC_VER)
+// Squelch warnings about dll vs vector
+#  pragma warning (push)
+#  pragma warning (disable: 4251)
+#endif
+
+namespace GeographicLib {
+
+  /**
+   * \brief An array of AuxAngle objects
+   *
+   * This holds a set of angles represented as in AuxAngle, with the \e y and
+   * \e x components stored in separate arrays ("structure of arrays").  The
+   * member functions are the array analogs of those of AuxAngle and operate
+   * element by element on the whole array; the results are identical to
+   * applying the AuxAngle functions to each element.  The loops over the
+   * arrays are simple enough that the compiler can vectorize those parts
+   * which don't involve calls to the math library.
+   *
+   * AuxLatitude::Convert accepts AuxAngleArray arguments so that a set of
+   * latitudes can be converted without constructing an AuxAngle object for
+   * each element.  The static function AuxAngleArray::normalize and
+   * AuxLatitude::Convert also have versions which act on arrays of the
+   * components supplied by the caller; these don't allocate any memory.
+   **********************************************************************/
+  class GEOGRAPHICLIB_EXPORT AuxAngleArray {
+  private:
+    typedef Math::real real;
+    std::vector<real> _y, _x;
+    void check(const AuxAngleArray& p) const;
+  public:
+    /**
+     * Constructor for an array of identical angles.
+     *
+     * @param[in] num the number of angles.
+     * @param[in] y the \e y coordinate of each angle [default 0].
+     * @param[in] x the \e x coordinate of each angle [default 1].
+     **********************************************************************/
+    explicit AuxAngleArray(size_t num = 0, real y = 0, real x = 1)
+      : _y(num, y), _x(num, x) {}
+    /**
+     * Constructor for an array of angles given by their components.
+     *
+     * @param[in] num the number of angles.
+     * @param[in] y the array of \e y coordinates.
+     * @param[in] x the array of \e x coordinates.
+     **********************************************************************/
+    AuxAngleArray(size_t num, const real y[], const real x[])
+      : _y(y, y + num), _x(x, x + num) {}
+    /**
+     * @return the number of angles in the array.
+     **********************************************************************/
+    size_t size() const { return _y.size(); }
+    /**
+     * Change the number of angles in the array.
+     *
+     * @param[in] num the new number of angles.
+     * @param[in] y the \e y coordinate of any added angles [default 0].
+     * @param[in] x the \e x coordinate of any added angles [default 1].
+     **********************************************************************/
+    void resize(size_t num, real y = 0, real x = 1)
+    { _y.resize(num, y); _x.resize(num, x); }
+    /**
+     * @return a pointer to the array of \e y components.
+     **********************************************************************/
+    const real* y() const { return _y.data(); }
+    /**
+     * @return a pointer to the array of \e x components.
+     **********************************************************************/
+    const real* x() const { return _x.data(); }
+    /**
+     * @return a pointer to the array of \e y components.  This allows the
+     *   components to be altered.
+     **********************************************************************/
+    real* y() { return _y.data(); }
+    /**
+     * @return a pointer to the array of \e x components.  This allows the
+     *   components to be altered.
+     **********************************************************************/
+    real* x() { return _x.data(); }
+    /**
+     * @param[in] i the index of an angle.
+     * @return angle \e i as an AuxAngle.
+     **********************************************************************/
+    AuxAngle operator[](size_t i) const { return AuxAngle(_y[i], _x[i]); }
+    /**
+     * Set an element of the array.
+     *
+     * @param[in] i the index of an angle.
+     * @param[in] a the new value of angle \e i.
+     **********************************************************************/
+    void set(size_t i, const AuxAngle& a) { _y[i] = a.y(); _x[i] = a.x(); }
+    /**
+     * @param[out] d the angles converted to degrees.
+     **********************************************************************/
+    void degrees(real d[]) const;
+    /**
+     * @param[out] r the angles converted to radians.
+     **********************************************************************/
+    void radians(real r[]) const;
+    /**
+     * @param[out] psi the lambertians of the angles.
+     **********************************************************************/
+    void lam(real psi[]) const;
+    /**
+     * @param[out] t the tangents of the angles.
+     **********************************************************************/
+    void tan(real t[]) const;
+    /**
+     * @return a new AuxAngleArray with each angle normalized as with
+     *   AuxAngle::normalized.
+     **********************************************************************/
+    AuxAngleArray normalized() const;
+    /**
+     * Normalize the angles in place.
+     **********************************************************************/
+    void normalize() { normalize(size(), y(), x(), y(), x()); }
+    /**
+     * Set the quadrants for the angles.
+     *
+     * @param[in] p the AuxAngleArray from which the quadrant information is
+     *   taken.
+     * @exception GeographicErr if the sizes of \e p and *this differ.
+     * @return the new AuxAngleArray with each angle in the same quadrant as
+     *   the corresponding element of \e p.
+     **********************************************************************/
+    AuxAngleArray copyquadrant(const AuxAngleArray& p) const;
+    /**
+     * Add an AuxAngleArray element by element.
+     *
+     * @param[in] p the AuxAngleArray to be added.
+     * @exception GeographicErr if the sizes of \e p and *this differ.
+     * @return a reference to the new AuxAngleArray.
+     *
+     * See AuxAngle::operator+=.
+     **********************************************************************/
+    AuxAngleArray& operator+=(const AuxAngleArray& p);
+    /**
+     * Construct and return an AuxAngleArray specified as angles in degrees.
+     *
+     * @param[in] num the number of angles.
+     * @param[in] d the array of angles measured in degrees.
+     * @return the corresponding AuxAngleArray.
+     **********************************************************************/
+    static AuxAngleArray degrees(size_t num, const real d[]);
+    /**
+     * Construct and return an AuxAngleArray specified as angles in radians.
+     *
+     * @param[in] num the number of angles.
+     * @param[in] r the array of angles measured in radians.
+     * @return the corresponding AuxAngleArray.
+     **********************************************************************/
+    static AuxAngleArray radians(size_t num, const real r[]);
+    /**
+     * Construct and return an AuxAngleArray specified by the lambertians of
+     * the angles.
+     *
+     * @param[in] num the number of angles.
+     * @param[in] psi the array of lambertians.
+     * @return the corresponding AuxAngleArray.
+     **********************************************************************/
+    static AuxAngleArray lam(size_t num, const real psi[]);
+    /**
+     * Normalize angles given as arrays of their components.
+     *
+     * @param[in] num the number of angles.
+     * @param[in] y the \e y components of the angles.
+     * @param[in] x the \e x components of the angles.
+     * @param[out] yn the \e y components of the normalized angles.
+     * @param[out] xn the \e x components of the normalized angles.
+     *
+     * The normalization is the same as AuxAngle::normalized.  \e yn and \e xn
+     * may be the same as \e y and \e x.
+     **********************************************************************/
+    static void normalize(size_t num, const real y[], const real x[],
+                          real yn[], real xn[]);
+  };
+
+} // namespace GeographicLib
+
+#if defined(_MSC_VER)
+#  pragma warning (pop)
+#endif
+
+#endif  // GEOGRAPHICLIB_AUXANGLEARRAY_HPP
@@ -21,6 +21,7 @@
 #include <utility>
 #include <GeographicLib/Math.hpp>
 #include <GeographicLib/AuxAngle.hpp>
+#include <GeographicLib/AuxAngleArray.hpp>
 
 #if !defined(GEOGRAPHICLIB_AUXLATITUDE_ORDER)
 /**
@@ -235,6 +236,45 @@ namespace GeographicLib {
      **********************************************************************/
     Math::real Convert(int auxin, int auxout, real zeta, bool exact = false)
       const;
+    /**
+     * Convert an array of auxiliary latitudes.
+     *
+     * @param[in] auxin an AuxLatitude::aux indicating the type of
+     *   auxiliary latitude \e zeta.
+     * @param[in] auxout an AuxLatitude::aux indicating the type of
+     *   auxiliary latitude \e eta.
+     * @param[in] zeta the input auxiliary latitudes as an AuxAngleArray.
+     * @param[out] eta the output auxiliary latitudes as an AuxAngleArray.
+     * @param[in] exact if true use the exact equations instead of the Taylor
+     *   series [default false].
+     *
+     * The results are the same as calling AuxLatitude::Convert for each
+     * element of \e zeta.  \e eta is resized to match \e zeta and it may be
+     * the same object as \e zeta.
+     **********************************************************************/
+    void Convert(int auxin, int auxout, const AuxAngleArray& zeta,
+                 AuxAngleArray& eta, bool exact = false) const;
+    /**
+     * Convert an array of auxiliary latitudes given by their components.
+     *
+     * @param[in] num the number of latitudes.
+     * @param[in] auxin an AuxLatitude::aux indicating the type of
+     *   auxiliary latitude \e zeta.
+     * @param[in] auxout an AuxLatitude::aux indicating the type of
+     *   auxiliary latitude \e eta.
+     * @param[in] zetay the \e y components of the input latitudes \e zeta.
+     * @param[in] zetax the \e x components of the input latitudes \e zeta.
+     * @param[out] etay the \e y components of the output latitudes \e eta.
+     * @param[out] etax the \e x components of the output latitudes \e eta.
+     * @param[in] exact if true use the exact equations instead of the Taylor
+     *   series [default false].
+     *
+     * \e etay and \e etax may be the same as \e zetay and \e zetax.  This
+     * version doesn't allocate any memory.
+     **********************************************************************/
+    void Convert(size_t num, int auxin, int auxout,
+                 const real zetay[], const real zetax[],
+                 real etay[], real etax[], bool exact = false) const;
     /**
      * Convert geographic latitude to an auxiliary latitude \e eta.
      *
@@ -307,6 +347,23 @@ namespace GeographicLib {
     // if !sinp then subst sine->cosine.
     static Math::real Clenshaw(bool sinp, real szeta, real czeta,
                          const real c[], int K);
+    /**
+     * Use Clenshaw to sum a Fouier series for an array of angles.
+     *
+     * @param[in] num the number of angles.
+     * @param[in] sinp if true sum the sine series, else sum the cosine series.
+     * @param[in] szeta the array of sin(\e zeta).
+     * @param[in] czeta the array of cos(\e zeta).
+     * @param[in] c the array of coefficients.
+     * @param[in] K the number of coefficients.
+     * @param[out] F the array of Clenshaw sums.
+     *
+     * The results are the same as calling the scalar version of
+     * AuxLatitude::Clenshaw for each angle.
+     **********************************************************************/
+    static void Clenshaw(size_t num, bool sinp,
+                         const real szeta[], const real czeta[],
+                         const real c[], int K, real F[]);
     /**
      * The order of the series expansions.  This is set at compile time to
      * either 4, 6, or 8, by the preprocessor macro
@@ -0,0 +1,243 @@
+/**
+ * \file CompactGeodesicLine.hpp
+ * \brief Header for GeographicLib::CompactGeodesicLine class
+ *
+ * Copyright (c) Charles Karney (2026) <karney@alum.mit.edu> and licensed
+ * under the MIT/X11 License.  For more information, see
+ * https://geographiclib.sourceforge.io/
+ **********************************************************************/
+
+#if !defined(GEOGRAPHICLIB_COMPACTGEODESICLINE_HPP)
+#define GEOGRAPHICLIB_COMPACTGEODESICLINE_HPP 1
+
+#include <GeographicLib/Geodesic.hpp>
+#include <GeographicLib/GeodesicLine.hpp>
+
+namespace GeographicLib {
+
+  /**
+   * \brief A geodesic line with a small memory footprint
+   *
+   * A GeodesicLine object holds the coefficients of the series used to
+   * compute positions on the geodesic (together with a GeodesicLineExact
+   * object for the exact case) and so occupies about 1000 bytes.  A
+   * CompactGeodesicLine object stores only the starting point and azimuth
+   * of the geodesic, the invariants \e salp0 and \e calp0 (the sine and
+   * cosine of the azimuth at the equator), the capabilities, and a pointer
+   * to the Geodesic object; this amounts to 72 bytes with doubles.  This
+   * is useful for applications which keep many lines in memory.
+   *
+   * The full GeodesicLine object is reconstructed when a position is
+   * requested.  A small cache of GeodesicLine objects is maintained for
+   * each thread:
+   * - if the cache contains the line, this is used without any additional
+   *   computation;
+   * - otherwise, if the cache contains a line with the same ellipsoid,
+   *   capabilities, \e salp0, and \e calp0 (and hence the same series
+   *   coefficients, which depend on \e k<sup>2</sup> = \e e&prime;<sup>2</sup>
+   *   cos<sup>2</sup>\e alp0), only the quantities depending on the
+   *   starting point are recomputed;
+   * - otherwise the line is constructed afresh, replacing one of the lines
+   *   in the cache.
+   * .
+   * Thus, a sequence of Position calls on the same line costs almost the
+   * same as with a GeodesicLine object.  The results are identical to
+   * those given by GeodesicLine.
+   *
+   * The Geodesic object passed to the constructor must outlive the
+   * CompactGeodesicLine object.  The member functions are const and may
+   * be called concurrently from several threads.
+   *
+   * Example of use:
+   * \include example-CompactGeodesicLine.cpp
+   **********************************************************************/
+
+  class GEOGRAPHICLIB_EXPORT CompactGeodesicLine {
+  private:
+    typedef Math::real real;
+    const Geodesic* _g;
+    real _lat1, _lon1, _azi1, _salp1, _calp1, _salp0, _calp0;
+    unsigned _caps;
+
+    // Return a GeodesicLine equivalent to this object from the cache for the
+    // current thread.
+    const GeodesicLine& Cached() const;
+  public:
+
+    /** \name Constructors
+     **********************************************************************/
+    ///@{
+
+    /**
+     * Constructor for a compact geodesic line starting at latitude \e lat1,
+     * longitude \e lon1, and azimuth \e azi1 (all in degrees).
+     *
+     * @param[in] g A Geodesic object used to compute the necessary
+     *   information about the CompactGeodesicLine.
+     * @param[in] lat1 latitude of point 1 (degrees).
+     * @param[in] lon1 longitude of point 1 (degrees).
+     * @param[in] azi1 azimuth at point 1 (degrees).
+     * @param[in] caps bitor'ed combination of GeodesicLine::mask values
+     *   specifying the capabilities the CompactGeodesicLine object should
+     *   possess, i.e., which quantities can be returned in calls to
+     *   CompactGeodesicLine::Position.
+     *
+     * The meaning of the parameters is the same as for the corresponding
+     * GeodesicLine constructor.
+     **********************************************************************/
+    CompactGeodesicLine(const Geodesic& g, real lat1, real lon1, real azi1,
+                        unsigned caps = GeodesicLine::ALL);
+
+    /**
+     * Constructor for a compact geodesic line from a GeodesicLine.
+     *
+     * @param[in] g the Geodesic object used to construct \e line.
+     * @param[in] line the GeodesicLine object.
+     * @exception GeographicErr if \e line is not initialized or if \e g
+     *   doesn't match the ellipsoid of \e line.
+     *
+     * This allows the lines returned by Geodesic::InverseLine, etc., to be
+     * stored compactly.  Point 3 of \e line is not retained.
+     **********************************************************************/
+    CompactGeodesicLine(const Geodesic& g, const GeodesicLine& line);
+
+    /**
+     * A default constructor.  Position returns NaNs for the resulting
+     * object.
+     **********************************************************************/
+    CompactGeodesicLine() : _g(nullptr), _caps(0U) {}
+    ///@}
+
+    /** \name Computing positions
+     **********************************************************************/
+    ///@{
+
+    /**
+     * The general position function.
+     *
+     * @param[in] arcmode boolean flag determining the meaning of the second
+     *   parameter.
+     * @param[in] s12_a12 if \e arcmode is false, this is the distance between
+     *   point 1 and point 2 (meters); otherwise it is the arc length between
+     *   point 1 and point 2 (degrees); it can be negative.
+     * @param[in] outmask a bitor'ed combination of GeodesicLine::mask values
+     *   specifying which of the following parameters should be set.
+     * @param[out] lat2 latitude of point 2 (degrees).
+     * @param[out] lon2 longitude of point 2 (degrees).
+     * @param[out] azi2 (forward) azimuth at point 2 (degrees).
+     * @param[out] s12 distance from point 1 to point 2 (meters).
+     * @param[out] m12 reduced length of geodesic (meters).
+     * @param[out] M12 geodesic scale of point 2 relative to point 1
+     *   (dimensionless).
+     * @param[out] M21 geodesic scale of point 1 relative to point 2
+     *   (dimensionless).
+     * @param[out] S12 area under the geodesic (meters<sup>2</sup>).
+     * @return \e a12 arc length from point 1 to point 2 (degrees).
+     *
+     * See GeodesicLine::GenPosition for details.
+     **********************************************************************/
+    Math::real GenPosition(bool arcmode, real s12_a12, unsigned outmask,
+                           real& lat2, real& lon2, real& azi2,
+                           real& s12, real& m12, real& M12, real& M21,
+                           real& S12) const;
+
+    /**
+     * Compute the position of point 2 which is a distance \e s12 (meters)
+     * from point 1.
+     *
+     * @param[in] s12 distance from point 1 to point 2 (meters).
+     * @param[out] lat2 latitude of point 2 (degrees).
+     * @param[out] lon2 longitude of point 2 (degrees).
+     * @param[out] azi2 (forward) azimuth at point 2 (degrees).
+     * @return \e a12 arc length from point 1 to point 2 (degrees).
+     *
+     * See GeodesicLine::Position for details.
+     **********************************************************************/
+    Math::real Position(real s12, real& lat2, real& lon2, real& azi2) const {
+      real t;
+      return GenPosition(false, s12,
+                         GeodesicLine::LATITUDE | GeodesicLine::LONGITUDE |
+                         GeodesicLine::AZIMUTH,
+                         lat2, lon2, azi2, t, t, t, t, t);
+    }
+
+    /**
+     * See the documentation for CompactGeodesicLine::Position.
+     **********************************************************************/
+    Math::real Position(real s12, real& lat2, real& lon2) const {
+      real t;
+      return GenPosition(false, s12,
+                         GeodesicLine::LATITUDE | GeodesicLine::LONGITUDE,
+                         lat2, lon2, t, t, t, t, t, t);
+    }
+
+    /**
+     * Compute the position of point 2 which is an arc length \e a12
+     * (degrees) from point 1.
+     *
+     * @param[in] a12 arc length from point 1 to point 2 (degrees).
+     * @param[out] lat2 latitude of point 2 (degrees).
+     * @param[out] lon2 longitude of point 2 (degrees).
+     * @param[out] azi2 (forward) azimuth at point 2 (degrees).
+     *
+     * See GeodesicLine::ArcPosition for details.
+     **********************************************************************/
+    void ArcPosition(real a12, real& lat2, real& lon2, real& azi2) const {
+      real t;
+      GenPosition(true, a12,
+                  GeodesicLine::LATITUDE | GeodesicLine::LONGITUDE |
+                  GeodesicLine::AZIMUTH,
+                  lat2, lon2, azi2, t, t, t, t, t);
+    }
+
+    /**
+     * @return the equivalent GeodesicLine object.
+     **********************************************************************/
+    GeodesicLine Line() const;
+    ///@}
+
+    /** \name Inspector functions
+     **********************************************************************/
+    ///@{
+
+    /**
+     * @return true if the object has been initialized.
+     **********************************************************************/
+    bool Init() const { return _caps != 0U; }
+
+    /**
+     * @return \e lat1 the latitude of point 1 (degrees).
+     **********************************************************************/
+    Math::real Latitude() const
+    { return Init() ? _lat1 : Math::NaN(); }
+
+    /**
+     * @return \e lon1 the longitude of point 1 (degrees).
+     **********************************************************************/
+    Math::real Longitude() const
+    { return Init() ? _lon1 : Math::NaN(); }
+
+    /**
+     * @return \e azi1 the azimuth (degrees) of the geodesic line at point 1.
+     **********************************************************************/
+    Math::real Azimuth() const
+    { return Init() ? _azi1 : Math::NaN(); }
+
+    /**
+     * @return \e azi0 the azimuth (degrees) of the geodesic line as it
+     *   crosses the equator in a northward direction.
+     **********************************************************************/
+    Math::real EquatorialAzimuth() const
+    { return Init() ? Math::atan2d(_salp0, _calp0) : Math::NaN(); }
+
+    /**
+     * @return \e caps the computational capabilities that this object was
+     *   constructed with.  LATITUDE and AZIMUTH are always included.
+     **********************************************************************/
+    unsigned Capabilities() const { return _caps; }
+    ///@}
+  };
+
+} // namespace GeographicLib
+
+#endif  // GEOGRAPHICLIB_COMPACTGEODESICLINE_HPP
@@ -0,0 +1,357 @@
+/**
+ * \file CrossTrack.hpp
+ * \brief Header for GeographicLib::CrossTrack class
+ *
+ * Copyright (c) Charles Karney (2026) <karney@alum.mit.edu> and licensed under
+ * the MIT/X11 License.  For more information, see
+ * https://geographiclib.sourceforge.io/
+ **********************************************************************/
+
+#if !defined(GEOGRAPHICLIB_CROSSTRACK_HPP)
+#define GEOGRAPHICLIB_CROSSTRACK_HPP 1
+
+#include <vector>
+#include <GeographicLib/Math.hpp>
+#include <GeographicLib/Geodesic.hpp>
+#include <GeographicLib/GeodesicLine.hpp>
+#include <GeographicLib/Geocentric.hpp>
+#include <GeographicLib/Executor.hpp>
+
+#if defined(_MSC_VER)
+// Squelch warnings about dll vs vector
+#  pragma warning (push)
+#  pragma warning (disable: 4251)
+#endif
+
+namespace GeographicLib {
+
+  /**
+   * \brief Distances from points to geodesic segments
+   *
+   * Find the shortest distance from a point \e P to a geodesic segment \e AB
+   * together with the along-track and cross-track distances of \e P
+   * relative to the geodesic.  The foot of the perpendicular from \e P to
+   * the geodesic through \e A and \e B is found by the iteration given by
+   * Baselga and Martinez-Llario (2018) (the "point-to-line" problem
+   * companion to the intersection problem solved by Intersect), in which
+   * each step solves a right spherical triangle.  Here the spherical
+   * triangle is scaled using the reduced length and the geodesic scale of
+   * the geodesic from the current estimate of the foot to \e P so that the
+   * step is exact to first order on the ellipsoid; as a result, the
+   * iteration converges at least quadratically (usually in 2 or 3 steps).
+   *
+   * Polylines, e.g., GPS tracks, can be simplified with a tolerance given
+   * as a distance (CrossTrack::Simplify) or an area
+   * (CrossTrack::SimplifyArea) using geodesics instead of straight lines
+   * in some projection.
+   *
+   * In addition, an index over a set of segments can be built with
+   * CrossTrack::Reset and used to find the nearest segment to each of many
+   * query points with CrossTrack::Nearest.  The index is a tree of
+   * bounding spheres in geocentric coordinates, so that segments which
+   * can't be the nearest are rejected without solving any geodesic
+   * problems.  The search is exact (the result is the same as checking
+   * every segment) and the index is immutable once it's been built, so
+   * queries can be done in parallel by several threads.
+   *
+   * The algorithm is accurate for points \e P within about 10000 km of the
+   * segment; further away, the distance function may have several local
+   * minima on the ellipsoid and the distance returned is then the one
+   * nearest the midpoint of the segment.  The ellipsoid should not be too
+   * eccentric, |<i>f</i>| &lt; 1/50, say.
+   *
+   * This is based on
+   * - S. Baselga and J. C. Martinez-Llario,
+   *   <a href="https://doi.org/10.1007/s11200-017-1020-z">
+   *   Intersection and point-to-line solutions for geodesics
+   *   on the ellipsoid</a>,
+   *   Stud. Geophys. Geod. <b>62</b>, 353--363 (2018);
+   *   DOI: <a href="https://doi.org/10.1007/s11200-017-1020-z">
+   *   10.1007/s11200-017-1020-z</a>.
+   *
+   * Example of use:
+   * \include example-CrossTrack.cpp
+   **********************************************************************/
+
+  class GEOGRAPHICLIB_EXPORT CrossTrack {
+  private:
+    typedef Math::real real;
+  public:
+    /**
+     * The minimum capabilities for GeodesicLine objects which are passed to
+     * this class.
+     **********************************************************************/
+    static const unsigned LineCaps = Geodesic::LATITUDE | Geodesic::LONGITUDE |
+      Geodesic::AZIMUTH | Geodesic::DISTANCE_IN;
+  private:
+    static const int numit_ = 20;
+    // Max number of segments in a leaf of the tree
+    static const int bucket_ = 4;
+    const Geodesic _geod;
+    const Geocentric _earth;
+    real _R,                    // authalic radius
+      _tol;                     // convergence for the foot
+    // A node in the tree of bounding spheres.  The node covers segments
+    // _order[lo..hi); if it's not a leaf its children are at index + 1 and
+    // index + skip.
+    struct Node {
+      real c[3], r;             // center and radius of bounding sphere
+      int lo, hi, skip;
+    };
+    std::vector<GeodesicLine> _lines;
+    // The endpoints of the segments, latA, lonA, latB, lonB
+    std::vector<real> _ends;
+    // Bounding spheres for the segments: midpoint and half the length
+    std::vector<real> _sph;
+    std::vector<int> _order;
+    std::vector<Node> _tree;
+    int build(int lo, int hi);
+    // The area of the geodesic triangle with vertices i, j, k
+    real triarea(const real lat[], const real lon[],
+                 size_t i, size_t j, size_t k) const;
+    // Distance to the segment given by line with endpoints A and B
+    real segdist(const GeodesicLine& line,
+                 real latA, real lonA, real latB, real lonB,
+                 real lat, real lon, real& along, real& xtrack) const;
+    static real chord(const real p[], const real q[]) {
+      using std::hypot;
+      return hypot(hypot(p[0] - q[0], p[1] - q[1]), p[2] - q[2]);
+    }
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param[in] geod the Geodesic object to use for geodesic calculations.
+     *   By default this uses the WGS84 ellipsoid.
+     **********************************************************************/
+    explicit CrossTrack(const Geodesic& geod = Geodesic::WGS84());
+
+    /** \name Distance to a single segment.
+     **********************************************************************/
+    ///@{
+    /**
+     * Find the distance from a point to a geodesic segment given by its
+     * endpoints.
+     *
+     * @param[in] latA latitude of the start of the segment (degrees).
+     * @param[in] lonA longitude of the start of the segment (degrees).
+     * @param[in] latB latitude of the end of the segment (degrees).
+     * @param[in] lonB longitude of the end of the segment (degrees).
+     * @param[in] lat latitude of the point \e P (degrees).
+     * @param[in] lon longitude of the point \e P (degrees).
+     * @param[out] along the along-track distance, the distance from \e A to
+     *   the foot of the perpendicular from \e P to the geodesic (meters).
+     * @param[out] xtrack the cross-track distance, the distance from the
+     *   foot to \e P (meters); this is positive if \e P lies to the right of
+     *   the geodesic going from \e A to \e B.
+     * @return the shortest distance from \e P to the segment (meters).
+     *
+     * If 0 &le; \e along &le; \e s<sub>\e AB</sub>, the returned distance is
+     * |\e xtrack|; otherwise it's the distance to the nearer endpoint.
+     **********************************************************************/
+    Math::real Distance(real latA, real lonA, real latB, real lonB,
+                        real lat, real lon,
+                        real& along, real& xtrack) const;
+
+    /**
+     * Find the distance from a point to a geodesic segment given by a
+     * GeodesicLine.
+     *
+     * @param[in] line the segment; this must have been created with
+     *   Geodesic::InverseLine (or with its distance set with
+     *   GeodesicLine::SetDistance) and with at least the capabilities
+     *   CrossTrack::LineCaps.
+     * @param[in] lat latitude of the point \e P (degrees).
+     * @param[in] lon longitude of the point \e P (degrees).
+     * @param[out] along the along-track distance (meters).
+     * @param[out] xtrack the cross-track distance (meters).
+     * @return the shortest distance from \e P to the segment (meters).
+     **********************************************************************/
+    Math::real Distance(const GeodesicLine& line, real lat, real lon,
+                        real& along, real& xtrack) const;
+    ///@}
+
+    /** \name Searching a set of segments.
+     **********************************************************************/
+    ///@{
+    /**
+     * Build the index for a set of segments.
+     *
+     * @param[in] num the number of segments.
+     * @param[in] latA array of latitudes of the starts of the segments
+     *   (degrees).
+     * @param[in] lonA array of longitudes of the starts of the segments
+     *   (degrees).
+     * @param[in] latB array of latitudes of the ends of the segments
+     *   (degrees).
+     * @param[in] lonB array of longitudes of the ends of the segments
+     *   (degrees).
+     *
+     * Any existing index is replaced.  For a polyline with vertices
+     * <i>v</i><sub>0</sub>, <i>v</i><sub>1</sub>, &hellip;, pass the
+     * vertices less the last as \e A and the vertices less the first as \e
+     * B.
+     **********************************************************************/
+    void Reset(size_t num, const real latA[], const real lonA[],
+               const real latB[], const real lonB[]);
+
+    /**
+     * @return the number of segments in the index.
+     **********************************************************************/
+    size_t NumSegments() const { return _lines.size(); }
+
+    /**
+     * Find the nearest segment in the index to a point.
+     *
+     * @param[in] lat latitude of the point \e P (degrees).
+     * @param[in] lon longitude of the point \e P (degrees).
+     * @param[out] dist the distance from \e P to the nearest segment
+     *   (meters).
+     * @param[out] along the along-track distance relative to the nearest
+     *   segment (meters).
+     * @param[out] xtrack the cross-track distance relative to the nearest
+     *   segment (meters).
+     * @return the index of the nearest segment (&minus;1 if the index is
+     *   empty or if \e P is invalid).
+     *
+     * If several segments are at the same distance, the one with the
+     * smallest index is returned.
+     **********************************************************************/
+    int Nearest(real lat, real lon,
+                real& dist, real& along, real& xtrack) const;
+
+    /**
+     * Find the nearest segments in the index to arrays of points.
+     *
+     * @param[in] num the number of points.
+     * @param[in] lat array of latitudes of the points (degrees).
+     * @param[in] lon array of longitudes of the points (degrees).
+     * @param[out] seg array of the indices of the nearest segments.
+     * @param[out] dist array of distances to the nearest segments (meters).
+     * @param[out] along array of along-track distances (meters); this may be
+     *   null.
+     * @param[out] xtrack array of cross-track distances (meters); this may
+     *   be null.
+     *
+     * This is equivalent to calling the scalar version of
+     * CrossTrack::Nearest for each point.
+     **********************************************************************/
+    void Nearest(size_t num, const real lat[], const real lon[],
+                 int seg[], real dist[],
+                 real along[] = nullptr, real xtrack[] = nullptr) const;
+
+    /**
+     * Find the nearest segments in the index to arrays of points using
+     * several threads.
+     *
+     * @param[in] exec the Executor used to split the work between threads.
+     * @param[in] num the number of points.
+     * @param[in] lat array of latitudes of the points (degrees).
+     * @param[in] lon array of longitudes of the points (degrees).
+     * @param[out] seg array of the indices of the nearest segments.
+     * @param[out] dist array of distances to the nearest segments (meters).
+     * @param[out] along array of along-track distances (meters); this may be
+     *   null.
+     * @param[out] xtrack array of cross-track distances (meters); this may
+     *   be null.
+     **********************************************************************/
+    void Nearest(const Executor& exec,
+                 size_t num, const real lat[], const real lon[],
+                 int seg[], real dist[],
+                 real along[] = nullptr, real xtrack[] = nullptr) const {
+      exec.For(num, [this, lat, lon, seg, dist, along, xtrack]
+                    (size_t i0, size_t i1) -> void {
+        Nearest(i1 - i0, lat + i0, lon + i0, seg + i0, dist + i0,
+                along ? along + i0 : nullptr,
+                xtrack ? xtrack + i0 : nullptr);
+      });
+    }
+    ///@}
+
+    /** \name Simplifying polylines.
+     **********************************************************************/
+    ///@{
+    /**
+     * Simplify a polyline with the Douglas-Peucker algorithm using several
+     * threads.
+     *
+     * @param[in] exec the Executor used to split the work between threads.
+     * @param[in] num the number of vertices.
+     * @param[in] lat array of latitudes of the vertices (degrees).
+     * @param[in] lon array of longitudes of the vertices (degrees).
+     * @param[in] tol the tolerance (meters).
+     * @param[out] keep array specifying which vertices are kept.
+     * @return the number of vertices kept.
+     *
+     * The first and last vertices are always kept.  The vertices between
+     * two kept vertices \e A and \e B are discarded if they all lie within
+     * a distance \e tol of the geodesic segment \e AB (as given by
+     * CrossTrack::Distance); otherwise the furthest vertex is kept and the
+     * two halves are treated in the same way.  Instead of recursion, the
+     * ranges of vertices still to be examined are held in a list which is
+     * processed in rounds; the distances for all the vertices in a round
+     * are computed in parallel.  The result doesn't depend on how the work
+     * is split.
+     **********************************************************************/
+    size_t Simplify(const Executor& exec,
+                    size_t num, const real lat[], const real lon[],
+                    real tol, bool keep[]) const;
+
+    /**
+     * Simplify a polyline with the Visvalingam-Whyatt algorithm using
+     * several threads.
+     *
+     * @param[in] exec the Executor used to split the work between threads.
+     * @param[in] num the number of vertices.
+     * @param[in] lat array of latitudes of the vertices (degrees).
+     * @param[in] lon array of longitudes of the vertices (degrees).
+     * @param[in] area the area threshold (meters<sup>2</sup>).
+     * @param[out] keep array specifying which vertices are kept.
+     * @return the number of vertices kept.
+     *
+     * The "effective area" of a vertex is the area of the geodesic triangle
+     * it forms with its neighbors.  The vertex with the smallest effective
+     * area is repeatedly discarded (and the effective areas of its neighbors
+     * recomputed) until all the remaining effective areas are at least \e
+     * area.  The first and last vertices are always kept.  Only the initial
+     * effective areas are computed in parallel.
+     **********************************************************************/
+    size_t SimplifyArea(const Executor& exec,
+                        size_t num, const real lat[], const real lon[],
+                        real area, bool keep[]) const;
+
+    /**
+     * CrossTrack::Simplify without an Executor.
+     **********************************************************************/
+    size_t Simplify(size_t num, const real lat[], const real lon[],
+                    real tol, bool keep[]) const {
+      return Simplify(Executor::Serial(), num, lat, lon, tol, keep);
+    }
+
+    /**
+     * CrossTrack::SimplifyArea without an Executor.
+     **********************************************************************/
+    size_t SimplifyArea(size_t num, const real lat[], const real lon[],
+                        real area, bool keep[]) const {
+      return SimplifyArea(Executor::Serial(), num, lat, lon, area, keep);
+    }
+    ///@}
+
+    /** \name Inspector functions
+     **********************************************************************/
+    ///@{
+    /**
+     * @return the Geodesic object used in the calculations.
+     **********************************************************************/
+    const Geodesic& GeodesicObject() const { return _geod; }
+    ///@}
+  };
+
+} // namespace GeographicLib
+
+#if defined(_MSC_VER)
+#  pragma warning (pop)
+#endif
+
+#endif  // GEOGRAPHICLIB_CROSSTRACK_HPP
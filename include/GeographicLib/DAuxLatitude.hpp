@@ -127,6 +127,29 @@ namespace GeographicLib {
                                 real szeta1, real czeta1,
                                 real szeta2, real czeta2,
                                 const real c[], int K);
+    /**
+     * The divided difference of AuxLatitude::Clenshaw for many pairs of
+     * angles.
+     *
+     * @param[in] num the number of pairs.
+     * @param[in] sinp if true sum the sine series, else sum the cosine series.
+     * @param[in] Delta array of either 1 \e or (zeta2 - zeta1) in radians.
+     * @param[in] szeta1 array of sin(\e zeta1).
+     * @param[in] czeta1 array of cos(\e zeta1).
+     * @param[in] szeta2 array of sin(\e zeta2).
+     * @param[in] czeta2 array of cos(\e zeta2).
+     * @param[in] c the array of coefficients.
+     * @param[in] K the number of coefficients.
+     * @param[out] D array of the divided differences.
+     *
+     * The pairs are processed in blocks with the loops over the pairs
+     * innermost so that they can be vectorized.  The results are identical
+     * to those of the scalar version.
+     **********************************************************************/
+    static void DClenshaw(size_t num, bool sinp, const real Delta[],
+                          const real szeta1[], const real czeta1[],
+                          const real szeta2[], const real czeta2[],
+                          const real c[], int K, real D[]);
     /**
      * The divided difference of the isometric latitude with respect to the
      * conformal latitude.
@@ -170,6 +193,102 @@ namespace GeographicLib {
           (isinf(y) ? copysign(real(1), y) :
            Dasinh(h(x), h(y)) * Dh(x, y) / Dasinh(x, y))));
     }
+
+    /** \name Array versions
+     *
+     * These compute the divided differences for \e num pairs of angles.
+     * The angles are given in structure-of-arrays form: the angle \e zeta
+     * is specified by the two arrays of its components \e y and \e x as
+     * stored by AuxAngle (so that \e zeta = atan2(\e y, \e x)).  The
+     * results are identical to those of the scalar versions.  For DConvert,
+     * the Fourier sums are evaluated for blocks of pairs together using the
+     * array version of DClenshaw.
+     **********************************************************************/
+    ///@{
+    /**
+     * The divided differences of one auxiliary latitude with respect to
+     * another for arrays of pairs.
+     *
+     * @param[in] num the number of pairs.
+     * @param[in] auxin an AuxLatitude::aux indicating the type of
+     *   auxiliary latitude \e zeta.
+     * @param[in] auxout an AuxLatitude::aux indicating the type of
+     *   auxiliary latitude \e eta.
+     * @param[in] y1 array of the \e y components of \e zeta1.
+     * @param[in] x1 array of the \e x components of \e zeta1.
+     * @param[in] y2 array of the \e y components of \e zeta2.
+     * @param[in] x2 array of the \e x components of \e zeta2.
+     * @param[out] D array of the divided differences (\e eta2 &minus; \e
+     *   eta1) / (\e zeta2 &minus; \e zeta1).
+     **********************************************************************/
+    void DConvert(size_t num, int auxin, int auxout,
+                  const real y1[], const real x1[],
+                  const real y2[], const real x2[], real D[]) const;
+    /**
+     * The divided differences of the parametric latitude with respect to the
+     * geographic latitude for arrays of pairs.
+     *
+     * @param[in] num the number of pairs.
+     * @param[in] y1 array of the \e y components of \e phi1.
+     * @param[in] x1 array of the \e x components of \e phi1.
+     * @param[in] y2 array of the \e y components of \e phi2.
+     * @param[in] x2 array of the \e x components of \e phi2.
+     * @param[out] D array of the divided differences.
+     **********************************************************************/
+    void DParametric(size_t num, const real y1[], const real x1[],
+                     const real y2[], const real x2[], real D[]) const;
+    /**
+     * The divided differences of the rectifying latitude with respect to the
+     * geographic latitude for arrays of pairs.
+     *
+     * @param[in] num the number of pairs.
+     * @param[in] y1 array of the \e y components of \e phi1.
+     * @param[in] x1 array of the \e x components of \e phi1.
+     * @param[in] y2 array of the \e y components of \e phi2.
+     * @param[in] x2 array of the \e x components of \e phi2.
+     * @param[out] D array of the divided differences.
+     **********************************************************************/
+    void DRectifying(size_t num, const real y1[], const real x1[],
+                     const real y2[], const real x2[], real D[]) const;
+    /**
+     * The divided differences of the isometric latitude with respect to the
+     * geographic latitude for arrays of pairs.
+     *
+     * @param[in] num the number of pairs.
+     * @param[in] y1 array of the \e y components of \e phi1.
+     * @param[in] x1 array of the \e x components of \e phi1.
+     * @param[in] y2 array of the \e y components of \e phi2.
+     * @param[in] x2 array of the \e x components of \e phi2.
+     * @param[out] D array of the divided differences.
+     **********************************************************************/
+    void DIsometric(size_t num, const real y1[], const real x1[],
+                    const real y2[], const real x2[], real D[]) const;
+    /**
+     * The divided differences of the isometric latitude with respect to the
+     * conformal latitude for arrays of pairs.
+     *
+     * @param[in] num the number of pairs.
+     * @param[in] x array of tan(\e chi1).
+     * @param[in] y array of tan(\e chi2).
+     * @param[out] D array of the divided differences.
+     **********************************************************************/
+    static void Dlam(size_t num, const real x[], const real y[], real D[]) {
+      for (size_t i = 0; i < num; ++i) D[i] = Dlam(x[i], y[i]);
+    }
+    /**
+     * The divided differences of the spherical rhumb area term with respect
+     * to the isometric latitude for arrays of pairs.
+     *
+     * @param[in] num the number of pairs.
+     * @param[in] x array of tan(\e chi1).
+     * @param[in] y array of tan(\e chi2).
+     * @param[out] D array of the divided differences.
+     **********************************************************************/
+    static void Dp0Dpsi(size_t num, const real x[], const real y[],
+                        real D[]) {
+      for (size_t i = 0; i < num; ++i) D[i] = Dp0Dpsi(x[i], y[i]);
+    }
+    ///@}
   protected:                    // so TestAux can access these functions
     /// \cond SKIP
     // (sn(y) - sn(x)) / (y - x)
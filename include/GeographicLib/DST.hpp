@@ -12,6 +12,7 @@
 
 #include <GeographicLib/Constants.hpp>
 
+#include <cstddef>
 #include <functional>
 #include <memory>
 
@@ -170,6 +171,72 @@ namespace GeographicLib {
     static real GEOGRAPHICLIB_EXPORT integral(real sinx, real cosx,
                                               real siny, real cosy,
                                               const real F[], int N);
+
+    /** \name Evaluating the Fourier sum at many angles
+     *
+     * These evaluate the sums for a single set of coefficients at \e num
+     * angles.  The angles are processed in blocks and the Clenshaw
+     * recurrence is carried out for all the angles in a block together, so
+     * the loops over the angles can be vectorized by the compiler.  The
+     * results are identical to calling the scalar versions for each angle.
+     * The output array may be the same as one of the input arrays.
+     **********************************************************************/
+    ///@{
+
+    /**
+     * Evaluate the Fourier sum at many angles.
+     *
+     * @param[in] num the number of angles.
+     * @param[in] sinx array of sin&sigma;.
+     * @param[in] cosx array of cos&sigma;.
+     * @param[in] F the array of Fourier coefficients.
+     * @param[in] N the number of Fourier coefficients.
+     * @param[out] y array of the values of the Fourier sum.
+     **********************************************************************/
+    static void GEOGRAPHICLIB_EXPORT eval(size_t num,
+                                          const real sinx[], const real cosx[],
+                                          const real F[], int N, real y[]);
+
+    /**
+     * Evaluate the integral of the Fourier sum at many angles.
+     *
+     * @param[in] num the number of angles.
+     * @param[in] sinx array of sin&sigma;.
+     * @param[in] cosx array of cos&sigma;.
+     * @param[in] F the array of Fourier coefficients.
+     * @param[in] N the number of Fourier coefficients.
+     * @param[out] I array of the values of the integral.
+     *
+     * The constant of integration is chosen so that the integral is zero at
+     * \f$ \sigma = \frac12\pi \f$.
+     **********************************************************************/
+    static void GEOGRAPHICLIB_EXPORT integral(size_t num,
+                                              const real sinx[],
+                                              const real cosx[],
+                                              const real F[], int N,
+                                              real I[]);
+
+    /**
+     * Evaluate many definite integrals of the Fourier sum.
+     *
+     * @param[in] num the number of integrals.
+     * @param[in] sinx array of sin&sigma;<sub>1</sub>.
+     * @param[in] cosx array of cos&sigma;<sub>1</sub>.
+     * @param[in] siny array of sin&sigma;<sub>2</sub>.
+     * @param[in] cosy array of cos&sigma;<sub>2</sub>.
+     * @param[in] F the array of Fourier coefficients.
+     * @param[in] N the number of Fourier coefficients.
+     * @param[out] I array of the values of the integrals between
+     *   &sigma;<sub>1</sub> and &sigma;<sub>2</sub>.
+     **********************************************************************/
+    static void GEOGRAPHICLIB_EXPORT integral(size_t num,
+                                              const real sinx[],
+                                              const real cosx[],
+                                              const real siny[],
+                                              const real cosy[],
+                                              const real F[], int N,
+                                              real I[]);
+    ///@}
   };
 
 } // namespace GeographicLib
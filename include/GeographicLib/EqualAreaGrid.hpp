@@ -0,0 +1,270 @@
+/**
+ * \file EqualAreaGrid.hpp
+ * \brief Header for GeographicLib::EqualAreaGrid class
+ *
+ * Copyright (c) Charles Karney (2026) <karney@alum.mit.edu> and licensed under
+ * the MIT/X11 License.  For more information, see
+ * https://geographiclib.sourceforge.io/
+ **********************************************************************/
+
+#if !defined(GEOGRAPHICLIB_EQUALAREAGRID_HPP)
+#define GEOGRAPHICLIB_EQUALAREAGRID_HPP 1
+
+#include <vector>
+#include <GeographicLib/Constants.hpp>
+#include <GeographicLib/AuxLatitude.hpp>
+#include <GeographicLib/Executor.hpp>
+
+#if defined(_MSC_VER)
+// Squelch warnings about dll vs vector
+#  pragma warning (push)
+#  pragma warning (disable: 4251)
+#endif
+
+namespace GeographicLib {
+
+  /**
+   * \brief An equal-area grid on the ellipsoid
+   *
+   * The ellipsoid is divided into \e nbands bands bounded by parallels which
+   * are equally spaced in authalic latitude &xi;.  Band \e j (counting from
+   * the south pole) is divided into <i>n</i><sub><i>j</i></sub> cells by
+   * equally spaced meridians starting at &minus;180&deg;, with
+   * <i>n</i><sub><i>j</i></sub> chosen so that the cells are as nearly
+   * square as possible.  Because the authalic latitude maps the ellipsoid
+   * onto a sphere with the same area, all the cells in a band have
+   * exactly the same area and the areas of the cells in different bands
+   * differ only because <i>n</i><sub><i>j</i></sub> is an integer (the
+   * polar bands consist of 3 cells meeting at the pole so these are about
+   * 5% larger than the average).  The cells are numbered
+   * consecutively, band by band, starting with the south pole.
+   *
+   * Points are assigned to cells by comparing their geographic latitudes
+   * with the band boundaries (computed with the exact conversion from
+   * authalic latitude), so that the assignment is consistent with the cell
+   * boundaries given by EqualAreaGrid::Bounds.  The series conversion to
+   * authalic latitude is only used to find the band quickly.  A point on a
+   * boundary belongs to the cell to the north or east.
+   *
+   * The batch versions of EqualAreaGrid::Cell process the points in blocks
+   * using the array versions of AuxLatitude::Convert and Math::atan2d.
+   * EqualAreaGrid::Histogram counts the points in each cell; with several
+   * threads, each thread accumulates a partial histogram and these are
+   * summed at the end.
+   *
+   * Example of use:
+   * \include example-EqualAreaGrid.cpp
+   **********************************************************************/
+
+  class GEOGRAPHICLIB_EXPORT EqualAreaGrid {
+  private:
+    typedef Math::real real;
+    AuxLatitude _aux;
+    int _nbands;
+    real _dxi,                  // band width in authalic latitude (degrees)
+      _R2;                      // authalic radius squared
+    // The geographic latitudes of the band boundaries, the number of cells in
+    // each band, the index of the first cell in each band, and the area of
+    // the cells in each band.
+    std::vector<real> _lat;
+    std::vector<int> _ncells, _start;
+    std::vector<real> _area;
+    int band(real lat, real xi) const;
+    int cell(int j, real lon) const;
+    void checkcell(int cell) const;
+  public:
+
+    /**
+     * Constructor for an equal-area grid.
+     *
+     * @param[in] a equatorial radius (meters).
+     * @param[in] f flattening of ellipsoid.  Setting \e f = 0 gives a sphere.
+     *   Negative \e f gives a prolate ellipsoid.
+     * @param[in] nbands the number of bands of latitude.
+     * @exception GeographicErr if \e a or (1 &minus; \e f) \e a is not
+     *   positive, if \e nbands is not positive, or if the total number of
+     *   cells exceeds the maximum int.
+     *
+     * The cells are approximately squares with sides 180&deg;/\e nbands of
+     * authalic latitude.  For example, \e nbands = 180 gives about 41000
+     * cells with areas of about 12400 km<sup>2</sup> on the WGS84
+     * ellipsoid.
+     **********************************************************************/
+    EqualAreaGrid(real a, real f, int nbands);
+
+    /** \name Assigning points to cells.
+     **********************************************************************/
+    ///@{
+    /**
+     * Find the cell containing a point.
+     *
+     * @param[in] lat the latitude of the point (degrees).
+     * @param[in] lon the longitude of the point (degrees).
+     * @return the index of the cell, or &minus;1 if \e lat is not in
+     *   [&minus;90&deg;, 90&deg;] or \e lon is not finite.
+     **********************************************************************/
+    int Cell(real lat, real lon) const;
+
+    /**
+     * Find the cells containing arrays of points.
+     *
+     * @param[in] num the number of points.
+     * @param[in] lat array of latitudes of the points (degrees).
+     * @param[in] lon array of longitudes of the points (degrees).
+     * @param[out] cell array of indices of the cells.
+     *
+     * This is equivalent to calling the scalar version of
+     * EqualAreaGrid::Cell for each point.
+     **********************************************************************/
+    void Cell(size_t num, const real lat[], const real lon[],
+              int cell[]) const;
+
+    /**
+     * Find the cells containing arrays of points using several threads.
+     *
+     * @param[in] exec the Executor used to split the work between threads.
+     * @param[in] num the number of points.
+     * @param[in] lat array of latitudes of the points (degrees).
+     * @param[in] lon array of longitudes of the points (degrees).
+     * @param[out] cell array of indices of the cells.
+     **********************************************************************/
+    void Cell(const Executor& exec,
+              size_t num, const real lat[], const real lon[],
+              int cell[]) const {
+      exec.For(num, [this, lat, lon, cell](size_t i0, size_t i1) -> void {
+        Cell(i1 - i0, lat + i0, lon + i0, cell + i0);
+      });
+    }
+
+    /**
+     * Count the points in each cell using several threads.
+     *
+     * @param[in] exec the Executor used to split the work between threads.
+     * @param[in] num the number of points.
+     * @param[in] lat array of latitudes of the points (degrees).
+     * @param[in] lon array of longitudes of the points (degrees).
+     * @param[in,out] counts the histogram; the counts for the points are
+     *   added to this.
+     * @return the number of points counted (points for which
+     *   EqualAreaGrid::Cell returns &minus;1 are skipped).
+     *
+     * If the size of \e counts is not NumCells(), it's resized and set to
+     * zero first.  This allows a large data set to be processed in batches.
+     * Each thread doing the work accumulates a partial histogram of size
+     * NumCells() and the partial histograms are summed in parallel at the
+     * end.
+     **********************************************************************/
+    size_t Histogram(const Executor& exec,
+                     size_t num, const real lat[], const real lon[],
+                     std::vector<unsigned long long>& counts) const;
+
+    /**
+     * EqualAreaGrid::Histogram without an Executor.
+     **********************************************************************/
+    size_t Histogram(size_t num, const real lat[], const real lon[],
+                     std::vector<unsigned long long>& counts) const {
+      return Histogram(Executor::Serial(), num, lat, lon, counts);
+    }
+    ///@}
+
+    /** \name Properties of the cells.
+     **********************************************************************/
+    ///@{
+    /**
+     * Find the band and the position in the band of a cell.
+     *
+     * @param[in] cell the index of the cell.
+     * @param[out] band the band containing the cell, 0 for the southernmost
+     *   band.
+     * @param[out] k the index of the cell within the band, 0 for the cell
+     *   starting at &minus;180&deg;.
+     * @exception GeographicErr if \e cell is out of range.
+     **********************************************************************/
+    void Position(int cell, int& band, int& k) const;
+
+    /**
+     * The boundaries of a cell.
+     *
+     * @param[in] cell the index of the cell.
+     * @param[out] lat0 the latitude of the southern edge (degrees).
+     * @param[out] lat1 the latitude of the northern edge (degrees).
+     * @param[out] lon0 the longitude of the western edge (degrees).
+     * @param[out] lon1 the longitude of the eastern edge (degrees); this is
+     *   greater than \e lon0.
+     * @exception GeographicErr if \e cell is out of range.
+     **********************************************************************/
+    void Bounds(int cell, real& lat0, real& lat1,
+                real& lon0, real& lon1) const;
+
+    /**
+     * The boundary of a cell as a polygon.
+     *
+     * @param[in] cell the index of the cell.
+     * @param[in] n the number of geodesic segments used to approximate each
+     *   edge along a parallel.
+     * @param[out] lat the latitudes of the vertices (degrees).
+     * @param[out] lon the longitudes of the vertices (degrees).
+     * @exception GeographicErr if \e cell is out of range or \e n is not
+     *   positive.
+     *
+     * The vertices are given counterclockwise starting at the southwest
+     * corner; the edges along meridians are geodesics and are not
+     * subdivided.  The edge at the pole of a polar cell degenerates to a
+     * single vertex.  PolygonAreaT applied to the vertices gives an area
+     * which approaches EqualAreaGrid::Area as \e n increases; the relative
+     * error is about 0.01/<i>n</i><sup>2</sup> for the polar cells and much
+     * smaller for the others.
+     **********************************************************************/
+    void Boundary(int cell, int n,
+                  std::vector<real>& lat, std::vector<real>& lon) const;
+
+    /**
+     * The area of a cell.
+     *
+     * @param[in] cell the index of the cell.
+     * @return the area (meters<sup>2</sup>).
+     * @exception GeographicErr if \e cell is out of range.
+     **********************************************************************/
+    Math::real Area(int cell) const;
+    ///@}
+
+    /** \name Inspector functions
+     **********************************************************************/
+    ///@{
+    /**
+     * @return the number of bands.
+     **********************************************************************/
+    int NumBands() const { return _nbands; }
+
+    /**
+     * @return the total number of cells.
+     **********************************************************************/
+    int NumCells() const { return _start.back(); }
+
+    /**
+     * @param[in] band the index of a band.
+     * @return the number of cells in the band (0 if \e band is out of
+     *   range).
+     **********************************************************************/
+    int BandCells(int band) const
+    { return band >= 0 && band < _nbands ? _ncells[band] : 0; }
+
+    /**
+     * @return \e a the equatorial radius of the ellipsoid (meters).
+     **********************************************************************/
+    Math::real EquatorialRadius() const { return _aux.EquatorialRadius(); }
+
+    /**
+     * @return \e f the flattening of the ellipsoid.
+     **********************************************************************/
+    Math::real Flattening() const { return _aux.Flattening(); }
+    ///@}
+  };
+
+} // namespace GeographicLib
+
+#if defined(_MSC_VER)
+#  pragma warning (pop)
+#endif
+
+#endif  // GEOGRAPHICLIB_EQUALAREAGRID_HPP
@@ -0,0 +1,181 @@
+/**
+ * \file Executor.hpp
+ * \brief Header for GeographicLib::Executor class
+ *
+ * Copyright (c) Charles Karney (2026) <karney@alum.mit.edu> and licensed
+ * under the MIT/X11 License.  For more information, see
+ * https://geographiclib.sourceforge.io/
+ **********************************************************************/
+
+#if !defined(GEOGRAPHICLIB_EXECUTOR_HPP)
+#define GEOGRAPHICLIB_EXECUTOR_HPP 1
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <GeographicLib/Constants.hpp>
+
+#if defined(_MSC_VER)
+// Squelch warnings about dll vs shared_ptr and function
+#  pragma warning (push)
+#  pragma warning (disable: 4251)
+#endif
+
+namespace GeographicLib {
+
+  /**
+   * \brief Run batch operations in parallel
+   *
+   * The batch (array) versions of the member functions of various classes
+   * can optionally be given an Executor as their first argument.  This
+   * splits the array into contiguous chunks which are processed
+   * concurrently.  The results are identical to those of the serial
+   * version.
+   *
+   * The scalar member functions of the classes in GeographicLib are all
+   * thread-safe (they are either static or const member functions of
+   * objects which are not modified after construction), so the chunks can
+   * be processed without synchronization.
+   *
+   * By default, an Executor owns a pool of threads which is created by the
+   * constructor and reused for each call to For.  The range is initially
+   * divided evenly between the threads; each thread processes its share in
+   * chunks of Grain() elements and, when it runs out of work, steals half
+   * of the remaining share of another thread.  Copies of an Executor share
+   * the same pool.  If the pool is already busy (because For is called
+   * from within a work function or concurrently from another thread), the
+   * work is carried out in the calling thread; this avoids oversubscribing
+   * the processors.
+   *
+   * Alternatively, an application which already has a scheduler (e.g., one
+   * based on TBB, asio, or the parallel algorithms of C++17) can supply an
+   * Executor::scheduler function which is then used for all the parallel
+   * loops in GeographicLib.  For example, with TBB,
+   * \code
+   Executor exec([](size_t num, size_t grain,
+                    const std::function<void(size_t, size_t)>& f) -> void {
+                   tbb::parallel_for(tbb::blocked_range<size_t>(0, num, grain),
+                                     [&f](const tbb::blocked_range<size_t>& r)
+                                     { f(r.begin(), r.end()); });
+                 });
+   \endcode
+   * and with C++17,
+   * \code
+   Executor exec([](size_t num, size_t grain,
+                    const std::function<void(size_t, size_t)>& f) -> void {
+                   std::vector<size_t> chunks((num + grain - 1) / grain);
+                   std::iota(chunks.begin(), chunks.end(), size_t(0));
+                   std::for_each(std::execution::par,
+                                 chunks.begin(), chunks.end(),
+                                 [=, &f](size_t k)
+                                 { f(k * grain, std::min(num, (k+1) * grain)); });
+                 });
+   \endcode
+   * With asio, the scheduler would post the chunks to a thread pool and
+   * wait for them to complete.
+   *
+   * If the work function throws an exception, the processing of the
+   * remaining chunks is still carried out and then the exception for the
+   * chunk with the lowest starting index is rethrown in the calling thread.
+   *
+   * Example of use:
+   * \include example-Executor.cpp
+   **********************************************************************/
+
+  class GEOGRAPHICLIB_EXPORT Executor {
+  public:
+    /**
+     * The type of the work function for Executor::For.  This is called as \e
+     * f(\e begin, \e end) to process the elements in [\e begin, \e end).
+     **********************************************************************/
+    typedef std::function<void(size_t, size_t)> work;
+    /**
+     * The type of a user-supplied scheduler.  This is called as \e
+     * s(\e num, \e grain, \e f) and must call \e f for a set of disjoint
+     * ranges covering [0, \e num), possibly concurrently, returning only when
+     * all the calls have completed.  The ranges should contain \e grain
+     * elements or more.  \e f doesn't throw exceptions (these are caught and
+     * rethrown by Executor::For).
+     **********************************************************************/
+    typedef std::function<void(size_t, size_t, const work&)> scheduler;
+  private:
+    class Pool;
+    int _nthreads;
+    size_t _grain;
+    std::shared_ptr<Pool> _pool;
+    scheduler _sched;
+  public:
+
+    /**
+     * Constructor for an Executor using a pool of threads.
+     *
+     * @param[in] nthreads the number of threads to use.  If this is 0 (the
+     *   default), use the number of concurrent threads supported by the
+     *   system.
+     * @param[in] grain the minimum number of elements in a chunk (default
+     *   1024).
+     * @exception GeographicErr if \e nthreads is negative or if \e grain is
+     *   zero.
+     * @exception std::bad_alloc if the memory for the pool can't be
+     *   allocated.
+     *
+     * With \e nthreads = 1, all the work is carried out in the calling
+     * thread.  Otherwise \e nthreads &minus; 1 threads are started; the
+     * calling thread takes part in the work.
+     **********************************************************************/
+    explicit Executor(int nthreads = 0, size_t grain = 1024);
+
+    /**
+     * Constructor for an Executor using a user-supplied scheduler.
+     *
+     * @param[in] sched the scheduler.
+     * @param[in] nthreads the number of threads used by the scheduler.  If
+     *   this is 0 (the default), use the number of concurrent threads
+     *   supported by the system.  This is only used to set Threads().
+     * @param[in] grain the minimum number of elements in a chunk (default
+     *   1024).
+     * @exception GeographicErr if \e sched is empty, if \e nthreads is
+     *   negative, or if \e grain is zero.
+     **********************************************************************/
+    explicit Executor(const scheduler& sched,
+                      int nthreads = 0, size_t grain = 1024);
+
+    /**
+     * Process the range [0, \e num) in parallel.
+     *
+     * @param[in] num the number of elements.
+     * @param[in] f the work function; this is called as \e f(\e begin, \e
+     *   end) to process the elements in [\e begin, \e end).
+     *
+     * The range is divided into chunks which each contain at least Grain()
+     * elements (except if \e num < Grain()).  The way the range is split
+     * depends on the timing of the threads; so \e f should only be used for
+     * operations which are independent of the splitting.  If \e num is
+     * less than 2 Grain(), \e f is called once in the calling thread.
+     **********************************************************************/
+    void For(size_t num, const work& f) const;
+
+    /**
+     * @return the number of threads.
+     **********************************************************************/
+    int Threads() const { return _nthreads; }
+
+    /**
+     * @return the minimum number of elements in a chunk.
+     **********************************************************************/
+    size_t Grain() const { return _grain; }
+
+    /**
+     * A global instantiation of Executor which does all the work in the
+     * calling thread.
+     **********************************************************************/
+    static const Executor& Serial();
+  };
+
+} // namespace GeographicLib
+
+#if defined(_MSC_VER)
+#  pragma warning (pop)
+#endif
+
+#endif  // GEOGRAPHICLIB_EXECUTOR_HPP
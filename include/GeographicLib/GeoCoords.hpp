@@ -2,7 +2,7 @@
  * \file GeoCoords.hpp
  * \brief Header for GeographicLib::GeoCoords class
  *
- * Copyright (c) Charles Karney (2008-2022) <karney@alum.mit.edu> and licensed
+ * Copyright (c) Charles Karney (2008-2026) <karney@alum.mit.edu> and licensed
  * under the MIT/X11 License.  For more information, see
  * https://geographiclib.sourceforge.io/
  **********************************************************************/
@@ -10,9 +10,17 @@
 #if !defined(GEOGRAPHICLIB_GEOCOORDS_HPP)
 #define GEOGRAPHICLIB_GEOCOORDS_HPP 1
 
+#include <atomic>
+#include <mutex>
 #include <GeographicLib/UTMUPS.hpp>
 #include <GeographicLib/Constants.hpp>
 
+#if defined(_MSC_VER)
+// Squelch warnings about dll vs mutex
+#  pragma warning (push)
+#  pragma warning (disable: 4251)
+#endif
+
 namespace GeographicLib {
 
   /**
@@ -32,6 +40,17 @@ namespace GeographicLib {
    * The mutable state consists of the UTM or UPS coordinates for a alternate
    * zone.  A method SetAltZone is provided to set the alternate UPS/UTM zone.
    *
+   * When the position is given as geographic coordinates (with the standard
+   * UTM/UPS zone) or as an MGRS string, only the cheap parts of the
+   * conversion are done by the constructor or by Reset.  The other
+   * coordinates are computed on demand the first time they're needed.  Thus
+   * Latitude() for an MGRS input or MGRSRepresentation() for a geographic
+   * input doesn't cost a full round trip.  Errors in the input are still
+   * detected by Reset.  The on-demand computation is protected by a mutex,
+   * so it is safe for several threads to call the const member functions of
+   * a GeoCoords object concurrently, except for SetAltZone, which alters
+   * the alternate zone.
+   *
    * Methods are provided to return the geographic coordinates, the input UTM
    * or UPS coordinates (and associated meridian convergence and scale), or
    * alternate UTM or UPS coordinates (and their associated meridian
@@ -49,19 +68,34 @@ namespace GeographicLib {
   class GEOGRAPHICLIB_EXPORT GeoCoords {
   private:
     typedef Math::real real;
-    real _lat, _long, _easting, _northing, _gamma, _k;
+    // Either (_lat, _long) or (_easting, _northing) is set by Reset,
+    // according to _geoinput.  The rest are set by Complete.
+    mutable real _lat, _long, _easting, _northing, _gamma, _k;
     bool _northp;
     int _zone;                  // See UTMUPS::zonespec
+    bool _geoinput;
+    mutable std::atomic<bool> _complete;
+    mutable std::mutex _lock;
+    // If _altsame, the alternate zone is the input zone and the _alt_
+    // coordinates aren't used.
+    mutable bool _altsame;
     mutable real _alt_easting, _alt_northing, _alt_gamma, _alt_k;
     mutable int _alt_zone;
 
     void CopyToAlt() const {
-      _alt_easting = _easting;
-      _alt_northing = _northing;
-      _alt_gamma = _gamma;
-      _alt_k = _k;
+      _altsame = true;
       _alt_zone = _zone;
     }
+    // Compute the remaining coordinates if necessary
+    void Complete() const {
+      if (!_complete.load(std::memory_order_acquire)) DoComplete();
+    }
+    void DoComplete() const;
+    // Ensure that the geographic, resp. UTM/UPS, coordinates are set
+    void CompleteGeo() const { if (!_geoinput) Complete(); }
+    void CompleteUTMUPS() const { if (_geoinput) Complete(); }
+    // Set the geographic coordinates for the standard zone on demand
+    void SetGeo(real latitude, real longitude);
     static void UTMUPSString(int zone, bool northp,
                              real easting, real northing,
                              int prec, bool abbrev, std::string& utm);
@@ -83,8 +117,25 @@ namespace GeographicLib {
       , _k(Math::NaN())
       , _northp(false)
       , _zone(UTMUPS::INVALID)
+      , _geoinput(true)
+      , _complete(true)
     { CopyToAlt(); }
 
+    /**
+     * Copy constructor.
+     *
+     * @param[in] p the GeoCoords object to copy.
+     **********************************************************************/
+    GeoCoords(const GeoCoords& p) : _complete(true) { *this = p; }
+
+    /**
+     * Assignment operator.
+     *
+     * @param[in] p the GeoCoords object to copy.
+     * @return a reference to *this.
+     **********************************************************************/
+    GeoCoords& operator=(const GeoCoords& p);
+
     /**
      * Construct from a string.
      *
@@ -178,6 +229,7 @@ namespace GeographicLib {
      **********************************************************************/
     explicit GeoCoords(const std::string& s,
                        bool centerp = true, bool longfirst = false)
+      : _complete(true)
     { Reset(s, centerp, longfirst); }
 
     /**
@@ -191,9 +243,9 @@ namespace GeographicLib {
      *   90&deg;].
      * @exception GeographicErr if \e zone cannot be used for this location.
      **********************************************************************/
-    GeoCoords(real latitude, real longitude, int zone = UTMUPS::STANDARD) {
-      Reset(latitude, longitude, zone);
-    }
+    GeoCoords(real latitude, real longitude, int zone = UTMUPS::STANDARD)
+      : _complete(true)
+    { Reset(latitude, longitude, zone); }
 
     /**
      * Construct from UTM/UPS coordinates.
@@ -205,9 +257,9 @@ namespace GeographicLib {
      * @exception GeographicErr if \e zone, \e easting, or \e northing is
      *   outside its allowed range.
      **********************************************************************/
-    GeoCoords(int zone, bool northp, real easting, real northing) {
-      Reset(zone, northp, easting, northing);
-    }
+    GeoCoords(int zone, bool northp, real easting, real northing)
+      : _complete(true)
+    { Reset(zone, northp, easting, northing); }
 
     /**
      * Reset the location from a string.  See
@@ -235,14 +287,7 @@ namespace GeographicLib {
      *   90&deg;].
      * @exception GeographicErr if \e zone cannot be used for this location.
      **********************************************************************/
-    void Reset(real latitude, real longitude, int zone = UTMUPS::STANDARD) {
-      UTMUPS::Forward(latitude, longitude,
-                      _zone, _northp, _easting, _northing, _gamma, _k,
-                      zone);
-      _lat = latitude;
-      _long = Math::AngNormalize(longitude);
-      CopyToAlt();
-    }
+    void Reset(real latitude, real longitude, int zone = UTMUPS::STANDARD);
 
     /**
      * Reset the location in terms of UPS/UPS coordinates.  See
@@ -262,6 +307,8 @@ namespace GeographicLib {
       _northp = northp;
       _easting = easting;
       _northing = northing;
+      _geoinput = false;
+      _complete.store(true, std::memory_order_release);
       FixHemisphere();
       CopyToAlt();
     }
@@ -273,32 +320,34 @@ namespace GeographicLib {
     /**
      * @return latitude (degrees)
      **********************************************************************/
-    Math::real Latitude() const { return _lat; }
+    Math::real Latitude() const { CompleteGeo(); return _lat; }
 
     /**
      * @return longitude (degrees)
      **********************************************************************/
-    Math::real Longitude() const { return _long; }
+    Math::real Longitude() const { CompleteGeo(); return _long; }
 
     /**
      * @return easting (meters)
      **********************************************************************/
-    Math::real Easting() const { return _easting; }
+    Math::real Easting() const
+    { CompleteUTMUPS(); return _easting; }
 
     /**
      * @return northing (meters)
      **********************************************************************/
-    Math::real Northing() const { return _northing; }
+    Math::real Northing() const
+    { CompleteUTMUPS(); return _northing; }
 
     /**
      * @return meridian convergence (degrees) for the UTM/UPS projection.
      **********************************************************************/
-    Math::real Convergence() const { return _gamma; }
+    Math::real Convergence() const { Complete(); return _gamma; }
 
     /**
      * @return scale for the UTM/UPS projection.
      **********************************************************************/
-    Math::real Scale() const { return _k; }
+    Math::real Scale() const { Complete(); return _k; }
 
     /**
      * @return hemisphere (false means south, true means north).
@@ -332,20 +381,7 @@ namespace GeographicLib {
      * existing alternate representation.  Before this is called the alternate
      * zone is the input zone.
      **********************************************************************/
-    void SetAltZone(int zone = UTMUPS::STANDARD) const {
-      if (zone == UTMUPS::MATCH)
-        return;
-      zone = UTMUPS::StandardZone(_lat, _long, zone);
-      if (zone == _zone)
-        CopyToAlt();
-      else {
-        bool northp;
-        UTMUPS::Forward(_lat, _long,
-                        _alt_zone, northp,
-                        _alt_easting, _alt_northing, _alt_gamma, _alt_k,
-                        zone);
-      }
-    }
+    void SetAltZone(int zone = UTMUPS::STANDARD) const;
 
     /**
      * @return current alternate zone (return 0 for UPS).
@@ -355,22 +391,26 @@ namespace GeographicLib {
     /**
      * @return easting (meters) for alternate zone.
      **********************************************************************/
-    Math::real AltEasting() const { return _alt_easting; }
+    Math::real AltEasting() const
+    { return _altsame ? Easting() : _alt_easting; }
 
     /**
      * @return northing (meters) for alternate zone.
      **********************************************************************/
-    Math::real AltNorthing() const { return _alt_northing; }
+    Math::real AltNorthing() const
+    { return _altsame ? Northing() : _alt_northing; }
 
     /**
      * @return meridian convergence (degrees) for alternate zone.
      **********************************************************************/
-    Math::real AltConvergence() const { return _alt_gamma; }
+    Math::real AltConvergence() const
+    { return _altsame ? Convergence() : _alt_gamma; }
 
     /**
      * @return scale for alternate zone.
      **********************************************************************/
-    Math::real AltScale() const { return _alt_k; }
+    Math::real AltScale() const
+    { return _altsame ? Scale() : _alt_k; }
     ///@}
 
     /** \name String representations of the GeoCoords object
@@ -542,4 +582,8 @@ namespace GeographicLib {
 
 } // namespace GeographicLib
 
+#if defined(_MSC_VER)
+#  pragma warning (pop)
+#endif
+
 #endif  // GEOGRAPHICLIB_GEOCOORDS_HPP
@@ -10,8 +10,10 @@
 #if !defined(GEOGRAPHICLIB_GEOCENTRIC_HPP)
 #define GEOGRAPHICLIB_GEOCENTRIC_HPP 1
 
+#include <cstddef>
 #include <vector>
 #include <GeographicLib/Constants.hpp>
+#include <GeographicLib/Executor.hpp>
 
 namespace GeographicLib {
 
@@ -70,6 +72,7 @@ namespace GeographicLib {
     friend class LocalCartesian;
     friend class MagneticCircle; // MagneticCircle uses Rotation
     friend class MagneticModel;  // MagneticModel uses IntForward
+    friend class MagneticPoint;  // MagneticPoint uses Rotate
     friend class GravityCircle;  // GravityCircle uses Rotation
     friend class GravityModel;   // GravityModel uses IntForward
     friend class NormalGravity;  // NormalGravity uses IntForward
@@ -234,6 +237,102 @@ namespace GeographicLib {
         IntReverse(X, Y, Z, lat, lon, h, NULL);
     }
 
+    /** \name Converting many points
+     **********************************************************************/
+    ///@{
+    /**
+     * Convert an array of points from geodetic to geocentric coordinates.
+     *
+     * @param[in] num the number of points.
+     * @param[in] lat array of latitudes (degrees).
+     * @param[in] lon array of longitudes (degrees).
+     * @param[in] h array of heights above the ellipsoid (meters).
+     * @param[out] X array of geocentric coordinates (meters).
+     * @param[out] Y array of geocentric coordinates (meters).
+     * @param[out] Z array of geocentric coordinates (meters).
+     * @param[out] M (optional) array of 9\e num elements; if non-null,
+     *   M[9\e i] through M[9\e i + 8] are set to the rotation matrix for
+     *   point \e i in row-major order.
+     *
+     * The results are the same as calling Geocentric::Forward for each
+     * point.  The trigonometric functions are evaluated for a block of points
+     * before the rest of the calculation, which the compiler can then
+     * vectorize.
+     **********************************************************************/
+    void Forward(size_t num, const real lat[], const real lon[],
+                 const real h[], real X[], real Y[], real Z[],
+                 real M[] = nullptr) const;
+
+    /**
+     * Convert an array of points from geocentric to geodetic coordinates.
+     *
+     * @param[in] num the number of points.
+     * @param[in] X array of geocentric coordinates (meters).
+     * @param[in] Y array of geocentric coordinates (meters).
+     * @param[in] Z array of geocentric coordinates (meters).
+     * @param[out] lat array of latitudes (degrees).
+     * @param[out] lon array of longitudes (degrees).
+     * @param[out] h array of heights above the ellipsoid (meters).
+     * @param[out] M (optional) array of 9\e num elements for the rotation
+     *   matrices.
+     *
+     * The results are the same as calling Geocentric::Reverse for each
+     * point.
+     **********************************************************************/
+    void Reverse(size_t num, const real X[], const real Y[], const real Z[],
+                 real lat[], real lon[], real h[], real M[] = nullptr) const;
+
+    /**
+     * Convert an array of points from geodetic to geocentric coordinates in
+     * parallel.
+     *
+     * @param[in] exec the Executor used to split the work between threads.
+     * @param[in] num the number of points.
+     * @param[in] lat array of latitudes (degrees).
+     * @param[in] lon array of longitudes (degrees).
+     * @param[in] h array of heights above the ellipsoid (meters).
+     * @param[out] X array of geocentric coordinates (meters).
+     * @param[out] Y array of geocentric coordinates (meters).
+     * @param[out] Z array of geocentric coordinates (meters).
+     * @param[out] M (optional) array of 9\e num elements for the rotation
+     *   matrices.
+     **********************************************************************/
+    void Forward(const Executor& exec, size_t num,
+                 const real lat[], const real lon[], const real h[],
+                 real X[], real Y[], real Z[], real M[] = nullptr) const {
+      exec.For(num, [this, lat, lon, h, X, Y, Z, M]
+                    (size_t i0, size_t i1) -> void {
+        Forward(i1 - i0, lat + i0, lon + i0, h + i0, X + i0, Y + i0, Z + i0,
+                M ? M + dim2_ * i0 : nullptr);
+      });
+    }
+
+    /**
+     * Convert an array of points from geocentric to geodetic coordinates in
+     * parallel.
+     *
+     * @param[in] exec the Executor used to split the work between threads.
+     * @param[in] num the number of points.
+     * @param[in] X array of geocentric coordinates (meters).
+     * @param[in] Y array of geocentric coordinates (meters).
+     * @param[in] Z array of geocentric coordinates (meters).
+     * @param[out] lat array of latitudes (degrees).
+     * @param[out] lon array of longitudes (degrees).
+     * @param[out] h array of heights above the ellipsoid (meters).
+     * @param[out] M (optional) array of 9\e num elements for the rotation
+     *   matrices.
+     **********************************************************************/
+    void Reverse(const Executor& exec, size_t num,
+                 const real X[], const real Y[], const real Z[],
+                 real lat[], real lon[], real h[], real M[] = nullptr) const {
+      exec.For(num, [this, X, Y, Z, lat, lon, h, M]
+                    (size_t i0, size_t i1) -> void {
+        Reverse(i1 - i0, X + i0, Y + i0, Z + i0, lat + i0, lon + i0, h + i0,
+                M ? M + dim2_ * i0 : nullptr);
+      });
+    }
+    ///@}
+
     /** \name Inspector functions
      **********************************************************************/
     ///@{
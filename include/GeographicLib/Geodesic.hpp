@@ -2,7 +2,7 @@
  * \file Geodesic.hpp
  * \brief Header for GeographicLib::Geodesic class
  *
- * Copyright (c) Charles Karney (2009-2023) <karney@alum.mit.edu> and licensed
+ * Copyright (c) Charles Karney (2009-2026) <karney@alum.mit.edu> and licensed
  * under the MIT/X11 License.  For more information, see
  * https://geographiclib.sourceforge.io/
  **********************************************************************/
@@ -12,6 +12,8 @@
 
 #include <GeographicLib/Constants.hpp>
 #include <GeographicLib/GeodesicExact.hpp>
+#include <GeographicLib/Executor.hpp>
+#include <atomic>
 
 #if !defined(GEOGRAPHICLIB_GEODESIC_ORDER)
 /**
@@ -173,9 +175,12 @@ namespace GeographicLib {
    **********************************************************************/
 
   class GEOGRAPHICLIB_EXPORT Geodesic {
+  public:
+    class InverseHint;
   private:
     typedef Math::real real;
     friend class GeodesicLine;
+    friend class CompactGeodesicLine;
     static const int nA1_ = GEOGRAPHICLIB_GEODESIC_ORDER;
     static const int nC1_ = GEOGRAPHICLIB_GEODESIC_ORDER;
     static const int nC1p_ = GEOGRAPHICLIB_GEODESIC_ORDER;
@@ -239,7 +244,12 @@ namespace GeographicLib {
     real GenInverse(real lat1, real lon1, real lat2, real lon2,
                     unsigned outmask, real& s12,
                     real& salp1, real& calp1, real& salp2, real& calp2,
-                    real& m12, real& M12, real& M21, real& S12) const;
+                    real& m12, real& M12, real& M21, real& S12,
+                    InverseHint* hint = nullptr) const;
+    // Decide whether s12 < R using bounds; return 1 (true), 0 (false), or -1
+    // (undecided).
+    int WithinBounds(real sphi1, real cphi1, real sphi2, real cphi2,
+                     real slam12, real clam12, real R) const;
 
     // These are Maxima generated functions to provide series approximations to
     // the integrals for the ellipsoidal geodesic.
@@ -811,6 +821,369 @@ namespace GeographicLib {
                           real& m12, real& M12, real& M21, real& S12) const;
     ///@}
 
+    /** \name Warm starting the inverse geodesic solution.
+     **********************************************************************/
+    ///@{
+    /**
+     * \brief The state used to warm start the inverse problem
+     *
+     * When solving a sequence of inverse problems whose solutions change
+     * slowly (e.g., from a fixed observer to a moving target), the azimuth
+     * found for one problem is a good starting point for Newton's method for
+     * the next.  Pass the same InverseHint object to successive calls to
+     * Geodesic::GenInverse or Geodesic::Inverse; it records the solution of
+     * the last problem and statistics on the number of iterations.
+     *
+     * The hint is used only if the last problem solved by Newton's method
+     * (or with the short-line approximation) was related to the current one
+     * by the same symmetry transformations (roughly, if the points stay in
+     * the same hemispheres and the longitude difference doesn't change
+     * sign).  If the last two solutions are available, the starting point
+     * is found by linear extrapolation of the azimuth; this is appropriate
+     * if the points move smoothly.  If the first Newton step from the
+     * starting point is larger than about
+     * 1&deg;, the hint is judged to be poor and the usual starting guess is
+     * used instead; the bracket on the root established by the evaluation at
+     * the hint is retained.  The results agree with those obtained without a
+     * hint to roundoff.  The hint is ignored if the Geodesic object was
+     * constructed with \e exact = true.
+     *
+     * An InverseHint object should not be shared between threads.
+     **********************************************************************/
+    class InverseHint {
+    private:
+      friend class Geodesic;
+      // The canonical alp1 for the last two solutions; _nsol is the number
+      // of them which are valid.
+      real _salp1, _calp1, _salp0, _calp0;
+      int _signs, _nsol;
+      bool _warm;
+      unsigned _numit;
+      unsigned long long _count, _warmcount, _totit;
+      void start(int signs, real& salp1, real& calp1) const;
+      void record(int signs, real salp1, real calp1);
+    public:
+      /**
+       * Constructor for an empty hint.
+       **********************************************************************/
+      InverseHint()
+        : _salp1(0), _calp1(0), _salp0(0), _calp0(0), _signs(0), _nsol(0)
+        , _warm(false), _numit(0), _count(0), _warmcount(0), _totit(0) {}
+      /**
+       * Forget the stored solution and reset the statistics.
+       **********************************************************************/
+      void Reset() { *this = InverseHint(); }
+      /**
+       * @return true if the hint holds a solution which may be used for the
+       *   next problem.
+       **********************************************************************/
+      bool Valid() const { return _nsol > 0; }
+      /**
+       * @return true if the last problem was solved starting from the hint
+       *   (i.e., the hint was applicable and not judged to be poor).
+       **********************************************************************/
+      bool Warm() const { return _warm; }
+      /**
+       * @return the number of evaluations of the longitude difference used
+       *   by Newton's method for the last problem (0 if the problem was
+       *   solved without iteration).
+       **********************************************************************/
+      unsigned Iterations() const { return _numit; }
+      /**
+       * @return the number of problems solved with this hint.
+       **********************************************************************/
+      unsigned long long Count() const { return _count; }
+      /**
+       * @return the number of problems solved starting from the hint.
+       **********************************************************************/
+      unsigned long long WarmCount() const { return _warmcount; }
+      /**
+       * @return the total number of iterations for all the problems solved
+       *   with this hint.
+       **********************************************************************/
+      unsigned long long TotalIterations() const { return _totit; }
+    };
+
+    /**
+     * The general inverse geodesic calculation with a warm start.
+     *
+     * @param[in] lat1 latitude of point 1 (degrees).
+     * @param[in] lon1 longitude of point 1 (degrees).
+     * @param[in] lat2 latitude of point 2 (degrees).
+     * @param[in] lon2 longitude of point 2 (degrees).
+     * @param[in] outmask a bitor'ed combination of Geodesic::mask values
+     *   specifying which of the following parameters should be set.
+     * @param[out] s12 distance between point 1 and point 2 (meters).
+     * @param[out] azi1 azimuth at point 1 (degrees).
+     * @param[out] azi2 (forward) azimuth at point 2 (degrees).
+     * @param[out] m12 reduced length of geodesic (meters).
+     * @param[out] M12 geodesic scale of point 2 relative to point 1
+     *   (dimensionless).
+     * @param[out] M21 geodesic scale of point 1 relative to point 2
+     *   (dimensionless).
+     * @param[out] S12 area under the geodesic (meters<sup>2</sup>).
+     * @param[in,out] hint the solution of the previous problem; on return it
+     *   holds the solution of this one.
+     * @return \e a12 arc length of between point 1 and point 2 (degrees).
+     *
+     * This is the same as the previous function except for the use of \e
+     * hint.
+     **********************************************************************/
+    Math::real GenInverse(real lat1, real lon1, real lat2, real lon2,
+                          unsigned outmask,
+                          real& s12, real& azi1, real& azi2,
+                          real& m12, real& M12, real& M21, real& S12,
+                          InverseHint& hint) const;
+
+    /**
+     * Solve the inverse geodesic problem with a warm start.
+     *
+     * @param[in] lat1 latitude of point 1 (degrees).
+     * @param[in] lon1 longitude of point 1 (degrees).
+     * @param[in] lat2 latitude of point 2 (degrees).
+     * @param[in] lon2 longitude of point 2 (degrees).
+     * @param[out] s12 distance between point 1 and point 2 (meters).
+     * @param[out] azi1 azimuth at point 1 (degrees).
+     * @param[out] azi2 (forward) azimuth at point 2 (degrees).
+     * @param[in,out] hint the solution of the previous problem; on return it
+     *   holds the solution of this one.
+     * @return \e a12 arc length of between point 1 and point 2 (degrees).
+     **********************************************************************/
+    Math::real Inverse(real lat1, real lon1, real lat2, real lon2,
+                       real& s12, real& azi1, real& azi2,
+                       InverseHint& hint) const {
+      real t;
+      return GenInverse(lat1, lon1, lat2, lon2,
+                        DISTANCE | AZIMUTH,
+                        s12, azi1, azi2, t, t, t, t, hint);
+    }
+    ///@}
+
+    /** \name Solving many geodesic problems.
+     **********************************************************************/
+    ///@{
+    /**
+     * Solve the direct geodesic problem for arrays of points.
+     *
+     * @param[in] num the number of geodesics.
+     * @param[in] lat1 array of latitudes of point 1 (degrees).
+     * @param[in] lon1 array of longitudes of point 1 (degrees).
+     * @param[in] azi1 array of azimuths at point 1 (degrees).
+     * @param[in] s12 array of distances between point 1 and point 2
+     *   (meters).
+     * @param[out] lat2 array of latitudes of point 2 (degrees).
+     * @param[out] lon2 array of longitudes of point 2 (degrees).
+     * @param[out] azi2 array of (forward) azimuths at point 2 (degrees).
+     * @param[out] m12 array of reduced lengths (meters).
+     * @param[out] M12 array of geodesic scales of point 2 relative to point
+     *   1 (dimensionless).
+     * @param[out] M21 array of geodesic scales of point 1 relative to point
+     *   2 (dimensionless).
+     * @param[out] S12 array of areas under the geodesics
+     *   (meters<sup>2</sup>).
+     *
+     * This is equivalent to calling Geodesic::GenDirect for each geodesic.
+     * The optional output arrays may be omitted by passing nullptr (the
+     * default); the corresponding quantities are then not computed.
+     **********************************************************************/
+    void Direct(size_t num, const real lat1[], const real lon1[],
+                const real azi1[], const real s12[],
+                real lat2[], real lon2[], real azi2[] = nullptr,
+                real m12[] = nullptr, real M12[] = nullptr,
+                real M21[] = nullptr, real S12[] = nullptr) const;
+
+    /**
+     * Solve the direct geodesic problem for arrays of points using several
+     * threads.
+     *
+     * @param[in] exec the Executor used to split the work between threads.
+     * @param[in] num the number of geodesics.
+     * @param[in] lat1 array of latitudes of point 1 (degrees).
+     * @param[in] lon1 array of longitudes of point 1 (degrees).
+     * @param[in] azi1 array of azimuths at point 1 (degrees).
+     * @param[in] s12 array of distances between point 1 and point 2
+     *   (meters).
+     * @param[out] lat2 array of latitudes of point 2 (degrees).
+     * @param[out] lon2 array of longitudes of point 2 (degrees).
+     * @param[out] azi2 array of (forward) azimuths at point 2 (degrees).
+     * @param[out] m12 array of reduced lengths (meters).
+     * @param[out] M12 array of geodesic scales of point 2 relative to point
+     *   1 (dimensionless).
+     * @param[out] M21 array of geodesic scales of point 1 relative to point
+     *   2 (dimensionless).
+     * @param[out] S12 array of areas under the geodesics
+     *   (meters<sup>2</sup>).
+     **********************************************************************/
+    void Direct(const Executor& exec,
+                size_t num, const real lat1[], const real lon1[],
+                const real azi1[], const real s12[],
+                real lat2[], real lon2[], real azi2[] = nullptr,
+                real m12[] = nullptr, real M12[] = nullptr,
+                real M21[] = nullptr, real S12[] = nullptr) const {
+      exec.For(num, [this, lat1, lon1, azi1, s12, lat2, lon2, azi2, m12, M12,
+                     M21, S12]
+                    (size_t i0, size_t i1) -> void {
+        Direct(i1 - i0, lat1 + i0, lon1 + i0, azi1 + i0, s12 + i0,
+               lat2 + i0, lon2 + i0, azi2 ? azi2 + i0 : nullptr,
+               m12 ? m12 + i0 : nullptr, M12 ? M12 + i0 : nullptr,
+               M21 ? M21 + i0 : nullptr, S12 ? S12 + i0 : nullptr);
+      });
+    }
+
+    /**
+     * Solve the inverse geodesic problem for arrays of points.
+     *
+     * @param[in] num the number of pairs of points.
+     * @param[in] lat1 array of latitudes of point 1 (degrees).
+     * @param[in] lon1 array of longitudes of point 1 (degrees).
+     * @param[in] lat2 array of latitudes of point 2 (degrees).
+     * @param[in] lon2 array of longitudes of point 2 (degrees).
+     * @param[out] s12 array of distances between point 1 and point 2
+     *   (meters).
+     * @param[out] azi1 array of azimuths at point 1 (degrees).
+     * @param[out] azi2 array of (forward) azimuths at point 2 (degrees).
+     * @param[out] m12 array of reduced lengths (meters).
+     * @param[out] M12 array of geodesic scales of point 2 relative to point
+     *   1 (dimensionless).
+     * @param[out] M21 array of geodesic scales of point 1 relative to point
+     *   2 (dimensionless).
+     * @param[out] S12 array of areas under the geodesics
+     *   (meters<sup>2</sup>).
+     *
+     * This is equivalent to calling Geodesic::GenInverse for each pair of
+     * points.  Any of the output arrays may be omitted by passing nullptr;
+     * the corresponding quantities are then not computed.
+     **********************************************************************/
+    void Inverse(size_t num, const real lat1[], const real lon1[],
+                 const real lat2[], const real lon2[],
+                 real s12[], real azi1[] = nullptr, real azi2[] = nullptr,
+                 real m12[] = nullptr, real M12[] = nullptr,
+                 real M21[] = nullptr, real S12[] = nullptr) const;
+
+    /**
+     * Solve the inverse geodesic problem for arrays of points using several
+     * threads.
+     *
+     * @param[in] exec the Executor used to split the work between threads.
+     * @param[in] num the number of pairs of points.
+     * @param[in] lat1 array of latitudes of point 1 (degrees).
+     * @param[in] lon1 array of longitudes of point 1 (degrees).
+     * @param[in] lat2 array of latitudes of point 2 (degrees).
+     * @param[in] lon2 array of longitudes of point 2 (degrees).
+     * @param[out] s12 array of distances between point 1 and point 2
+     *   (meters).
+     * @param[out] azi1 array of azimuths at point 1 (degrees).
+     * @param[out] azi2 array of (forward) azimuths at point 2 (degrees).
+     * @param[out] m12 array of reduced lengths (meters).
+     * @param[out] M12 array of geodesic scales of point 2 relative to point
+     *   1 (dimensionless).
+     * @param[out] M21 array of geodesic scales of point 1 relative to point
+     *   2 (dimensionless).
+     * @param[out] S12 array of areas under the geodesics
+     *   (meters<sup>2</sup>).
+     **********************************************************************/
+    void Inverse(const Executor& exec,
+                 size_t num, const real lat1[], const real lon1[],
+                 const real lat2[], const real lon2[],
+                 real s12[], real azi1[] = nullptr, real azi2[] = nullptr,
+                 real m12[] = nullptr, real M12[] = nullptr,
+                 real M21[] = nullptr, real S12[] = nullptr) const {
+      exec.For(num, [this, lat1, lon1, lat2, lon2, s12, azi1, azi2, m12, M12,
+                     M21, S12]
+                    (size_t i0, size_t i1) -> void {
+        Inverse(i1 - i0, lat1 + i0, lon1 + i0, lat2 + i0, lon2 + i0,
+                s12 ? s12 + i0 : nullptr,
+                azi1 ? azi1 + i0 : nullptr, azi2 ? azi2 + i0 : nullptr,
+                m12 ? m12 + i0 : nullptr, M12 ? M12 + i0 : nullptr,
+                M21 ? M21 + i0 : nullptr, S12 ? S12 + i0 : nullptr);
+      });
+    }
+    ///@}
+
+    /** \name Testing whether points are within a given distance.
+     **********************************************************************/
+    ///@{
+    /**
+     * Test whether the distance between two points is less than a given
+     * value.
+     *
+     * @param[in] lat1 latitude of point 1 (degrees).
+     * @param[in] lon1 longitude of point 1 (degrees).
+     * @param[in] lat2 latitude of point 2 (degrees).
+     * @param[in] lon2 longitude of point 2 (degrees).
+     * @param[in] R the distance threshold (meters).
+     * @return whether \e s12 < \e R.
+     *
+     * This gives the same result as computing \e s12 with
+     * Geodesic::Inverse and comparing it with \e R (aside from cases where
+     * \e s12 is within roundoff of \e R).  However, the answer is first
+     * sought using cheap rigorous bounds on \e s12; the inverse problem is
+     * only solved if \e R lies between the bounds.  With \e P<sub>1</sub>
+     * and \e P<sub>2</sub> the positions of the points and &theta; the angle
+     * between them subtended at the center of the ellipsoid, the lower bound
+     * is the larger of the chord |<i>P</i><sub>1</sub> &minus;
+     * <i>P</i><sub>2</sub>| and min(\e a, \e b) &theta;.  The upper bound is
+     * the length of the arc of the ellipse formed by the intersection of the
+     * ellipsoid with the plane containing \e P<sub>1</sub>, \e
+     * P<sub>2</sub>, and the center; this is bounded by &theta; times the
+     * maximum radius on the arc times a factor accounting for the
+     * eccentricity of the ellipse.  The relative separation of the bounds is
+     * about 3 &times; 10<sup>&minus;6</sup> for short distances and \e f for
+     * long distances.  Nearly antipodal points are always resolved by
+     * solving the inverse problem.
+     **********************************************************************/
+    bool Within(real lat1, real lon1, real lat2, real lon2, real R) const;
+
+    /**
+     * Test whether the distances between arrays of points are less than a
+     * given value.
+     *
+     * @param[in] num the number of pairs of points.
+     * @param[in] lat1 array of latitudes of point 1 (degrees).
+     * @param[in] lon1 array of longitudes of point 1 (degrees).
+     * @param[in] lat2 array of latitudes of point 2 (degrees).
+     * @param[in] lon2 array of longitudes of point 2 (degrees).
+     * @param[in] R the distance threshold (meters).
+     * @param[out] within array of results, \e s12 < \e R.
+     * @return the number of pairs decided by the bounds (i.e., without
+     *   solving the inverse problem).
+     *
+     * This is equivalent to calling the scalar version of Geodesic::Within
+     * for each pair of points.  The bounds are computed in blocks using the
+     * array versions of Math::sincosd and Math::AngDiff.
+     **********************************************************************/
+    size_t Within(size_t num, const real lat1[], const real lon1[],
+                  const real lat2[], const real lon2[], real R,
+                  bool within[]) const;
+
+    /**
+     * Test whether the distances between arrays of points are less than a
+     * given value using several threads.
+     *
+     * @param[in] exec the Executor used to split the work between threads.
+     * @param[in] num the number of pairs of points.
+     * @param[in] lat1 array of latitudes of point 1 (degrees).
+     * @param[in] lon1 array of longitudes of point 1 (degrees).
+     * @param[in] lat2 array of latitudes of point 2 (degrees).
+     * @param[in] lon2 array of longitudes of point 2 (degrees).
+     * @param[in] R the distance threshold (meters).
+     * @param[out] within array of results, \e s12 < \e R.
+     * @return the number of pairs decided by the bounds.
+     **********************************************************************/
+    size_t Within(const Executor& exec,
+                  size_t num, const real lat1[], const real lon1[],
+                  const real lat2[], const real lon2[], real R,
+                  bool within[]) const {
+      std::atomic<size_t> fast(0);
+      exec.For(num, [this, lat1, lon1, lat2, lon2, R, within, &fast]
+                    (size_t i0, size_t i1) -> void {
+        fast += Within(i1 - i0, lat1 + i0, lon1 + i0, lat2 + i0, lon2 + i0,
+                       R, within + i0);
+      });
+      return fast;
+    }
+    ///@}
+
     /** \name Interface to GeodesicLine.
      **********************************************************************/
     ///@{
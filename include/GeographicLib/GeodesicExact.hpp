@@ -90,6 +90,10 @@ namespace GeographicLib {
     GeodesicExact() {};         // Do nothing; used with exact = false.
 
     static const unsigned maxit1_ = 20;
+    // Area coefficient arrays with up to nC4x_ elements are held in fixed
+    // storage to avoid allocating memory.  This covers the terrestrial
+    // ellipsoids with float, double, long double, and quad precision.
+    static const int nC4x_ = 16;
     unsigned maxit2_;
     real tiny_, tol0_, tol1_, tol2_, tolb_, xthresh_;
 
@@ -75,6 +75,7 @@ namespace GeographicLib {
   private:
     typedef Math::real real;
     friend class Geodesic;
+    friend class CompactGeodesicLine; // CompactGeodesicLine calls LineInit
     static const int nC1_ = Geodesic::nC1_;
     static const int nC1p_ = Geodesic::nC1p_;
     static const int nC2_ = Geodesic::nC2_;
@@ -95,10 +96,12 @@ namespace GeographicLib {
     unsigned _caps;
     GeodesicLineExact _lineexact;
 
+    // If coeffs is false, the series coefficients are assumed to be already
+    // set for this _salp0, _calp0, and _caps and are not recomputed.
     void LineInit(const Geodesic& g,
                   real lat1, real lon1,
                   real azi1, real salp1, real calp1,
-                  unsigned caps);
+                  unsigned caps, bool coeffs = true);
     GeodesicLine(const Geodesic& g,
                  real lat1, real lon1,
                  real azi1, real salp1, real calp1,
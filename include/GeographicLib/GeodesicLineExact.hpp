@@ -54,10 +54,17 @@ namespace GeographicLib {
       _aA4, _eE0, _dD0, _hH0, _eE1, _dD1, _hH1;
     real _a13, _s13;
     real _bB41;
-    std::vector<real> _cC4a;
+    // The coefficients for the area are held in _cC4x if _nC4 <= nC4x_ and
+    // otherwise in _cC4v; use C4a() to access them.
+    real _cC4x[GeodesicExact::nC4x_];
+    std::vector<real> _cC4v;
     EllipticFunction _eE;
     unsigned _caps;
 
+    real* C4a()
+    { return _nC4 <= GeodesicExact::nC4x_ ? _cC4x : _cC4v.data(); }
+    const real* C4a() const
+    { return _nC4 <= GeodesicExact::nC4x_ ? _cC4x : _cC4v.data(); }
     void LineInit(const GeodesicExact& g,
                   real lat1, real lon1,
                   real azi1, real salp1, real calp1,
@@ -2,7 +2,7 @@
  * \file Geoid.hpp
  * \brief Header for GeographicLib::Geoid class
  *
- * Copyright (c) Charles Karney (2009-2022) <karney@alum.mit.edu> and licensed
+ * Copyright (c) Charles Karney (2009-2026) <karney@alum.mit.edu> and licensed
  * under the MIT/X11 License.  For more information, see
  * https://geographiclib.sourceforge.io/
  **********************************************************************/
@@ -13,6 +13,7 @@
 #include <vector>
 #include <fstream>
 #include <GeographicLib/Constants.hpp>
+#include <GeographicLib/Executor.hpp>
 
 #if defined(_MSC_VER)
 // Squelch warnings about dll vs vector and constant conditional expressions
@@ -306,6 +307,49 @@ namespace GeographicLib {
       return h + real(d) * height(lat, lon);
     }
 
+    /**
+     * Compute the geoid height at an array of points.
+     *
+     * @param[in] num the number of points.
+     * @param[in] lat array of latitudes (degrees).
+     * @param[in] lon array of longitudes (degrees).
+     * @param[out] h array of heights of the geoid above the ellipsoid
+     *   (meters).
+     * @exception GeographicErr if there's a problem reading the data; this
+     *   never happens if all the points are within a successfully cached
+     *   area.
+     *
+     * This is equivalent to calling Geoid::operator()() for each point.
+     **********************************************************************/
+    void operator()(size_t num, const real lat[], const real lon[],
+                    real h[]) const;
+
+    /**
+     * Compute the geoid height at an array of points using several threads.
+     *
+     * @param[in] exec the Executor used to split the work between threads.
+     * @param[in] num the number of points.
+     * @param[in] lat array of latitudes (degrees).
+     * @param[in] lon array of longitudes (degrees).
+     * @param[out] h array of heights of the geoid above the ellipsoid
+     *   (meters).
+     * @exception GeographicErr if there's a problem reading the data.
+     *
+     * The work is only split between threads if the Geoid object was
+     * constructed with \e threadsafe = true; otherwise, because the
+     * evaluation modifies the cache, the points are processed serially in
+     * the calling thread.
+     **********************************************************************/
+    void operator()(const Executor& exec, size_t num,
+                    const real lat[], const real lon[], real h[]) const {
+      if (!_threadsafe)
+        (*this)(num, lat, lon, h);
+      else
+        exec.For(num, [this, lat, lon, h](size_t i0, size_t i1) -> void {
+          (*this)(i1 - i0, lat + i0, lon + i0, h + i0);
+        });
+    }
+
     ///@}
 
     /** \name Inspector functions
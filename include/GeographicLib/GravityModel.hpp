@@ -2,7 +2,7 @@
  * \file GravityModel.hpp
  * \brief Header for GeographicLib::GravityModel class
  *
- * Copyright (c) Charles Karney (2011-2022) <karney@alum.mit.edu> and licensed
+ * Copyright (c) Charles Karney (2011-2026) <karney@alum.mit.edu> and licensed
  * under the MIT/X11 License.  For more information, see
  * https://geographiclib.sourceforge.io/
  **********************************************************************/
@@ -14,6 +14,7 @@
 #include <GeographicLib/NormalGravity.hpp>
 #include <GeographicLib/SphericalHarmonic.hpp>
 #include <GeographicLib/SphericalHarmonic1.hpp>
+#include <GeographicLib/Executor.hpp>
 
 #if defined(_MSC_VER)
 // Squelch warnings about dll vs vector
@@ -254,6 +255,91 @@ namespace GeographicLib {
      **********************************************************************/
     Math::real GeoidHeight(real lat, real lon) const;
 
+    /**
+     * Evaluate the gravity at an array of points.
+     *
+     * @param[in] num the number of points.
+     * @param[in] lat array of geographic latitudes (degrees).
+     * @param[in] lon array of geographic longitudes (degrees).
+     * @param[in] h array of heights above the ellipsoid (meters).
+     * @param[out] gx array of easterly components of the acceleration
+     *   (m s<sup>&minus;2</sup>).
+     * @param[out] gy array of northerly components of the acceleration
+     *   (m s<sup>&minus;2</sup>).
+     * @param[out] gz array of upward components of the acceleration
+     *   (m s<sup>&minus;2</sup>).
+     * @param[out] W array of the sums of the gravitational and centrifugal
+     *   potentials (m<sup>2</sup> s<sup>&minus;2</sup>) (optional).
+     *
+     * This gives the same results as calling GravityModel::Gravity for each
+     * point; the geocentric coordinates for a block of points are computed
+     * with the array version of Geocentric::Forward.
+     **********************************************************************/
+    void Gravity(size_t num, const real lat[], const real lon[],
+                 const real h[], real gx[], real gy[], real gz[],
+                 real W[] = nullptr) const;
+
+    /**
+     * Evaluate the gravity at an array of points using several threads.
+     *
+     * @param[in] exec the Executor used to split the work between threads.
+     * @param[in] num the number of points.
+     * @param[in] lat array of geographic latitudes (degrees).
+     * @param[in] lon array of geographic longitudes (degrees).
+     * @param[in] h array of heights above the ellipsoid (meters).
+     * @param[out] gx array of easterly components of the acceleration
+     *   (m s<sup>&minus;2</sup>).
+     * @param[out] gy array of northerly components of the acceleration
+     *   (m s<sup>&minus;2</sup>).
+     * @param[out] gz array of upward components of the acceleration
+     *   (m s<sup>&minus;2</sup>).
+     * @param[out] W array of the sums of the gravitational and centrifugal
+     *   potentials (m<sup>2</sup> s<sup>&minus;2</sup>) (optional).
+     **********************************************************************/
+    void Gravity(const Executor& exec,
+                 size_t num, const real lat[], const real lon[],
+                 const real h[], real gx[], real gy[], real gz[],
+                 real W[] = nullptr) const {
+      exec.For(num, [this, lat, lon, h, gx, gy, gz, W]
+                    (size_t i0, size_t i1) -> void {
+        Gravity(i1 - i0, lat + i0, lon + i0, h + i0,
+                gx + i0, gy + i0, gz + i0, W ? W + i0 : nullptr);
+      });
+    }
+
+    /**
+     * Evaluate the geoid height at an array of points.
+     *
+     * @param[in] num the number of points.
+     * @param[in] lat array of geographic latitudes (degrees).
+     * @param[in] lon array of geographic longitudes (degrees).
+     * @param[out] N array of heights of the geoid above the
+     *   ReferenceEllipsoid() (meters).
+     *
+     * This gives the same results as calling GravityModel::GeoidHeight for
+     * each point.
+     **********************************************************************/
+    void GeoidHeight(size_t num, const real lat[], const real lon[],
+                     real N[]) const;
+
+    /**
+     * Evaluate the geoid height at an array of points using several threads.
+     *
+     * @param[in] exec the Executor used to split the work between threads.
+     * @param[in] num the number of points.
+     * @param[in] lat array of geographic latitudes (degrees).
+     * @param[in] lon array of geographic longitudes (degrees).
+     * @param[out] N array of heights of the geoid above the
+     *   ReferenceEllipsoid() (meters).
+     **********************************************************************/
+    void GeoidHeight(const Executor& exec,
+                     size_t num, const real lat[], const real lon[],
+                     real N[]) const {
+      exec.For(num, [this, lat, lon, N](size_t i0, size_t i1) -> void {
+        GeoidHeight(i1 - i0, lat + i0, lon + i0, N + i0);
+      });
+    }
+
     /**
      * Evaluate the components of the gravity anomaly vector using the
      * spherical approximation.
@@ -0,0 +1,251 @@
+/**
+ * \file GravityTrack.hpp
+ * \brief Header for GeographicLib::GravityTrack class
+ *
+ * Copyright (c) Charles Karney (2026) <karney@alum.mit.edu> and licensed
+ * under the MIT/X11 License.  For more information, see
+ * https://geographiclib.sourceforge.io/
+ **********************************************************************/
+
+#if !defined(GEOGRAPHICLIB_GRAVITYTRACK_HPP)
+#define GEOGRAPHICLIB_GRAVITYTRACK_HPP 1
+
+#include <vector>
+#include <GeographicLib/Constants.hpp>
+#include <GeographicLib/GravityModel.hpp>
+#include <GeographicLib/GravityCircle.hpp>
+
+#if defined(_MSC_VER)
+// Squelch warnings about dll vs vector
+#  pragma warning (push)
+#  pragma warning (disable: 4251)
+#endif
+
+namespace GeographicLib {
+
+  /**
+   * \brief Gravity along a trajectory
+   *
+   * Evaluate the earth's gravity field at a sequence of closely spaced
+   * points at a constant height, e.g., along the track of a ship or an
+   * aircraft.  GravityCircle objects are constructed on demand at latitudes
+   * which are multiples of a spacing \e dlat and are cached.  The field at a
+   * particular point is found by evaluating the field on the 4 surrounding
+   * circles at the longitude of the point and applying cubic interpolation
+   * in latitude.  Because neighboring points on a track typically lie
+   * between the same circles, the cost per point is a few evaluations of
+   * CircularEngine, which is \e O(\e N), instead of the \e O(\e N<sup>2</sup>)
+   * cost of a full spherical harmonic synthesis (where \e N is the degree of
+   * the model).
+   *
+   * The spacing of the circles is chosen to achieve a given relative
+   * accuracy \e eps.  The field restricted to a meridian is (nearly) a
+   * trigonometric polynomial of degree \e N + 1 in the latitude so that,
+   * by Bernstein's inequality, its 4th derivative with respect to latitude
+   * is bounded by (\e N + 1)<sup>4</sup> times its maximum magnitude.  The
+   * error in cubic interpolation is then less than \e eps times the maximum
+   * magnitude of the quantity being computed, provided that
+   * \e dlat = (24 \e eps)<sup>1/4</sup> / (\e N + 1) (in radians).  (This
+   * allows for the one-sided stencils used in the intervals adjacent to the
+   * poles; elsewhere the error is less than 9/16 of this bound.)  For
+   * EGM2008 truncated at \e N = 360 and \e eps = 10<sup>&minus;6</sup>, the
+   * spacing is about 0.011&deg;.
+   *
+   * The member functions for computing the field are not const because they
+   * update the cache of circles.  Thus, a GravityTrack object should not be
+   * shared between threads; instead each thread should construct its own
+   * GravityTrack object.  The GravityModel passed to the constructor must
+   * outlive the GravityTrack object.
+   *
+   * Example of use:
+   * \include example-GravityTrack.cpp
+   **********************************************************************/
+
+  class GEOGRAPHICLIB_EXPORT GravityTrack {
+  private:
+    typedef Math::real real;
+    const GravityModel& _grav;
+    real _h, _eps, _dlat;
+    int _nlat;
+    unsigned _caps;
+    int _maxcircles;
+    std::vector<int> _ind;
+    std::vector<GravityCircle> _circ;
+    // Return circle i, creating it if necessary, without evicting the
+    // circles i0 .. i0+3.
+    const GravityCircle& Circle(int i, int i0);
+    // Find the 4 circles surrounding lat and the interpolation weights.
+    void Stencil(real lat, const GravityCircle* c[], real w[]);
+    GravityTrack(const GravityTrack&) = delete; // copy constructor not allowed
+    // nor copy assignment
+    GravityTrack& operator=(const GravityTrack&) = delete;
+  public:
+
+    /** \name Setting up the trajectory evaluator
+     **********************************************************************/
+    ///@{
+    /**
+     * Constructor for a GravityTrack.
+     *
+     * @param[in] grav the GravityModel to use.
+     * @param[in] h the height of the points above the ellipsoid (meters).
+     * @param[in] eps (optional) the maximum relative error allowed in the
+     *   interpolation (default 10<sup>&minus;6</sup>).
+     * @param[in] caps (optional) bitor'ed combination of GravityModel::mask
+     *   values specifying the capabilities of the underlying GravityCircle
+     *   objects (default GravityModel::DISTURBANCE |
+     *   GravityModel::GEOID_HEIGHT).
+     * @param[in] maxcircles (optional) the maximum number of GravityCircle
+     *   objects to cache (default 32).
+     * @exception GeographicErr if \e eps is less than the machine epsilon
+     *   (or so small that the number of circles would overflow an int) or if
+     *   \e maxcircles is less than 4.
+     *
+     * As with GravityModel::Circle, GravityModel::GEOID_HEIGHT will only be
+     * honored if \e h = 0.  Evaluating a function which is not included in
+     * \e caps returns NaNs.
+     **********************************************************************/
+    GravityTrack(const GravityModel& grav, real h, real eps = real(1e-6),
+                 unsigned caps = GravityModel::DISTURBANCE |
+                 GravityModel::GEOID_HEIGHT,
+                 int maxcircles = 32);
+    ///@}
+
+    /** \name Compute the gravitational field along a track
+     **********************************************************************/
+    ///@{
+    /**
+     * Evaluate the gravity.
+     *
+     * @param[in] lat the geographic latitude (degrees).
+     * @param[in] lon the geographic longitude (degrees).
+     * @param[out] gx the easterly component of the acceleration
+     *   (m s<sup>&minus;2</sup>).
+     * @param[out] gy the northerly component of the acceleration
+     *   (m s<sup>&minus;2</sup>).
+     * @param[out] gz the upward component of the acceleration
+     *   (m s<sup>&minus;2</sup>); this is usually negative.
+     * @return \e W the sum of the gravitational and centrifugal potentials
+     *   (m<sup>2</sup> s<sup>&minus;2</sup>).
+     *
+     * This requires GravityModel::GRAVITY to be included in \e caps.
+     **********************************************************************/
+    Math::real Gravity(real lat, real lon, real& gx, real& gy, real& gz);
+
+    /**
+     * Evaluate the gravity disturbance vector.
+     *
+     * @param[in] lat the geographic latitude (degrees).
+     * @param[in] lon the geographic longitude (degrees).
+     * @param[out] deltax the easterly component of the disturbance vector
+     *   (m s<sup>&minus;2</sup>).
+     * @param[out] deltay the northerly component of the disturbance vector
+     *   (m s<sup>&minus;2</sup>).
+     * @param[out] deltaz the upward component of the disturbance vector
+     *   (m s<sup>&minus;2</sup>).
+     * @return \e T the corresponding disturbing potential
+     *   (m<sup>2</sup> s<sup>&minus;2</sup>).
+     **********************************************************************/
+    Math::real Disturbance(real lat, real lon,
+                           real& deltax, real& deltay, real& deltaz);
+
+    /**
+     * Evaluate the geoid height.
+     *
+     * @param[in] lat the geographic latitude (degrees).
+     * @param[in] lon the geographic longitude (degrees).
+     * @return \e N the height of the geoid above the reference ellipsoid
+     *   (meters).
+     **********************************************************************/
+    Math::real GeoidHeight(real lat, real lon);
+
+    /**
+     * Evaluate the gravity at many points.
+     *
+     * @param[in] num the number of points.
+     * @param[in] lat array of geographic latitudes (degrees).
+     * @param[in] lon array of geographic longitudes (degrees).
+     * @param[out] gx array of easterly components of the acceleration
+     *   (m s<sup>&minus;2</sup>).
+     * @param[out] gy array of northerly components of the acceleration
+     *   (m s<sup>&minus;2</sup>).
+     * @param[out] gz array of upward components of the acceleration
+     *   (m s<sup>&minus;2</sup>).
+     * @param[out] W (optional) array of the sums of the gravitational and
+     *   centrifugal potentials (m<sup>2</sup> s<sup>&minus;2</sup>).
+     *
+     * This requires GravityModel::GRAVITY to be included in \e caps.  The
+     * points should be given in the order in which they occur along the
+     * track to make the best use of the cache of circles.
+     **********************************************************************/
+    void Gravity(size_t num, const real lat[], const real lon[],
+                 real gx[], real gy[], real gz[], real W[] = nullptr);
+
+    /**
+     * Evaluate the gravity disturbance vector at many points.
+     *
+     * @param[in] num the number of points.
+     * @param[in] lat array of geographic latitudes (degrees).
+     * @param[in] lon array of geographic longitudes (degrees).
+     * @param[out] deltax array of easterly components of the disturbance
+     *   vector (m s<sup>&minus;2</sup>).
+     * @param[out] deltay array of northerly components of the disturbance
+     *   vector (m s<sup>&minus;2</sup>).
+     * @param[out] deltaz array of upward components of the disturbance
+     *   vector (m s<sup>&minus;2</sup>).
+     * @param[out] T (optional) array of disturbing potentials
+     *   (m<sup>2</sup> s<sup>&minus;2</sup>).
+     *
+     * The points should be given in the order in which they occur along the
+     * track to make the best use of the cache of circles.
+     **********************************************************************/
+    void Disturbance(size_t num, const real lat[], const real lon[],
+                     real deltax[], real deltay[], real deltaz[],
+                     real T[] = nullptr);
+
+    /**
+     * Evaluate the geoid height at many points.
+     *
+     * @param[in] num the number of points.
+     * @param[in] lat array of geographic latitudes (degrees).
+     * @param[in] lon array of geographic longitudes (degrees).
+     * @param[out] N array of the heights of the geoid above the reference
+     *   ellipsoid (meters).
+     *
+     * The points should be given in the order in which they occur along the
+     * track to make the best use of the cache of circles.
+     **********************************************************************/
+    void GeoidHeight(size_t num, const real lat[], const real lon[],
+                     real N[]);
+    ///@}
+
+    /** \name Inspector functions
+     **********************************************************************/
+    ///@{
+    /**
+     * @return the height of the track (meters).
+     **********************************************************************/
+    Math::real Height() const { return _h; }
+    /**
+     * @return \e eps the relative accuracy used to set the spacing of the
+     *   circles.
+     **********************************************************************/
+    Math::real Accuracy() const { return _eps; }
+    /**
+     * @return \e dlat the spacing of the circles (degrees).
+     **********************************************************************/
+    Math::real LatitudeSpacing() const { return _dlat; }
+    /**
+     * @return the number of GravityCircle objects currently cached.
+     **********************************************************************/
+    int CachedCircles() const { return int(_circ.size()); }
+    ///@}
+  };
+
+} // namespace GeographicLib
+
+#if defined(_MSC_VER)
+#  pragma warning (pop)
+#endif
+
+#endif  // GEOGRAPHICLIB_GRAVITYTRACK_HPP
@@ -0,0 +1,178 @@
+/**
+ * \file Helmert.hpp
+ * \brief Header for GeographicLib::Helmert class
+ *
+ * Copyright (c) Charles Karney (2026) <karney@alum.mit.edu> and licensed under
+ * the MIT/X11 License.  For more information, see
+ * https://geographiclib.sourceforge.io/
+ **********************************************************************/
+
+#if !defined(GEOGRAPHICLIB_HELMERT_HPP)
+#define GEOGRAPHICLIB_HELMERT_HPP 1
+
+#include <GeographicLib/Constants.hpp>
+#include <GeographicLib/Executor.hpp>
+
+namespace GeographicLib {
+
+  /**
+   * \brief Seven-parameter Helmert transformation
+   *
+   * Transform geocentric coordinates between two datums with a similarity
+   * transformation specified by 3 translations, 3 rotations, and a scale
+   * change,
+   * \f[
+   *   \mathbf X' = \mathbf T + (1 + s) \mathbf R \mathbf X,
+   * \f]
+   * where, in the "position vector" convention (EPSG method 1033),
+   * \f[
+   *   \mathbf R = \begin{bmatrix}
+   *     1 & -r_z & r_y \\ r_z & 1 & -r_x \\ -r_y & r_x & 1
+   *   \end{bmatrix}.
+   * \f]
+   * In the "coordinate frame" convention (EPSG method 1032) the signs of the
+   * rotations are reversed.  The rotations are assumed to be small and \e R
+   * is the linearized rotation matrix used by EPSG and most national mapping
+   * agencies.  The reverse transformation is the exact inverse of the
+   * forward transformation (instead of the approximation obtained by
+   * reversing the signs of the parameters).
+   *
+   * Convert to and from geocentric coordinates with Geocentric.  Pipeline
+   * combines these steps.
+   *
+   * Example of use:
+   * \include example-Helmert.cpp
+   **********************************************************************/
+
+  class GEOGRAPHICLIB_EXPORT Helmert {
+  private:
+    typedef Math::real real;
+    static const size_t dim_ = 3;
+    static const size_t dim2_ = dim_ * dim_;
+    real _t[dim_], _m[dim2_], _mi[dim2_];
+  public:
+
+    /**
+     * Constructor for the identity transformation.
+     **********************************************************************/
+    Helmert();
+
+    /**
+     * Constructor for a Helmert transformation.
+     *
+     * @param[in] tx the translation in \e X (meters).
+     * @param[in] ty the translation in \e Y (meters).
+     * @param[in] tz the translation in \e Z (meters).
+     * @param[in] rx the rotation about the \e X axis (arcseconds).
+     * @param[in] ry the rotation about the \e Y axis (arcseconds).
+     * @param[in] rz the rotation about the \e Z axis (arcseconds).
+     * @param[in] s the scale change (parts per million).
+     * @param[in] coordframe if true, use the coordinate frame convention
+     *   for the rotations; otherwise (the default) use the position vector
+     *   convention.
+     * @exception GeographicErr if any of the parameters is not finite.
+     **********************************************************************/
+    Helmert(real tx, real ty, real tz, real rx, real ry, real rz, real s,
+            bool coordframe = false);
+
+    /**
+     * Transform a point.
+     *
+     * @param[in] X geocentric coordinate in the source datum (meters).
+     * @param[in] Y geocentric coordinate in the source datum (meters).
+     * @param[in] Z geocentric coordinate in the source datum (meters).
+     * @param[out] Xo geocentric coordinate in the target datum (meters).
+     * @param[out] Yo geocentric coordinate in the target datum (meters).
+     * @param[out] Zo geocentric coordinate in the target datum (meters).
+     **********************************************************************/
+    void Forward(real X, real Y, real Z, real& Xo, real& Yo, real& Zo) const;
+
+    /**
+     * Transform a point in the reverse direction.
+     *
+     * @param[in] X geocentric coordinate in the target datum (meters).
+     * @param[in] Y geocentric coordinate in the target datum (meters).
+     * @param[in] Z geocentric coordinate in the target datum (meters).
+     * @param[out] Xo geocentric coordinate in the source datum (meters).
+     * @param[out] Yo geocentric coordinate in the source datum (meters).
+     * @param[out] Zo geocentric coordinate in the source datum (meters).
+     **********************************************************************/
+    void Reverse(real X, real Y, real Z, real& Xo, real& Yo, real& Zo) const;
+
+    /**
+     * Transform an array of points.
+     *
+     * @param[in] num the number of points.
+     * @param[in] X array of geocentric coordinates (meters).
+     * @param[in] Y array of geocentric coordinates (meters).
+     * @param[in] Z array of geocentric coordinates (meters).
+     * @param[out] Xo array of transformed coordinates (meters).
+     * @param[out] Yo array of transformed coordinates (meters).
+     * @param[out] Zo array of transformed coordinates (meters).
+     *
+     * The results are the same as calling Helmert::Forward for each point.
+     * The output arrays may be the same as the input arrays.
+     **********************************************************************/
+    void Forward(size_t num, const real X[], const real Y[], const real Z[],
+                 real Xo[], real Yo[], real Zo[]) const;
+
+    /**
+     * Transform an array of points in the reverse direction.
+     *
+     * @param[in] num the number of points.
+     * @param[in] X array of geocentric coordinates (meters).
+     * @param[in] Y array of geocentric coordinates (meters).
+     * @param[in] Z array of geocentric coordinates (meters).
+     * @param[out] Xo array of transformed coordinates (meters).
+     * @param[out] Yo array of transformed coordinates (meters).
+     * @param[out] Zo array of transformed coordinates (meters).
+     *
+     * The output arrays may be the same as the input arrays.
+     **********************************************************************/
+    void Reverse(size_t num, const real X[], const real Y[], const real Z[],
+                 real Xo[], real Yo[], real Zo[]) const;
+
+    /**
+     * Transform an array of points in parallel.
+     *
+     * @param[in] exec the Executor used to split the work between threads.
+     * @param[in] num the number of points.
+     * @param[in] X array of geocentric coordinates (meters).
+     * @param[in] Y array of geocentric coordinates (meters).
+     * @param[in] Z array of geocentric coordinates (meters).
+     * @param[out] Xo array of transformed coordinates (meters).
+     * @param[out] Yo array of transformed coordinates (meters).
+     * @param[out] Zo array of transformed coordinates (meters).
+     **********************************************************************/
+    void Forward(const Executor& exec,
+                 size_t num, const real X[], const real Y[], const real Z[],
+                 real Xo[], real Yo[], real Zo[]) const {
+      exec.For(num, [this, X, Y, Z, Xo, Yo, Zo](size_t i0, size_t i1) -> void {
+        Forward(i1 - i0, X + i0, Y + i0, Z + i0, Xo + i0, Yo + i0, Zo + i0);
+      });
+    }
+
+    /**
+     * Transform an array of points in the reverse direction in parallel.
+     *
+     * @param[in] exec the Executor used to split the work between threads.
+     * @param[in] num the number of points.
+     * @param[in] X array of geocentric coordinates (meters).
+     * @param[in] Y array of geocentric coordinates (meters).
+     * @param[in] Z array of geocentric coordinates (meters).
+     * @param[out] Xo array of transformed coordinates (meters).
+     * @param[out] Yo array of transformed coordinates (meters).
+     * @param[out] Zo array of transformed coordinates (meters).
+     **********************************************************************/
+    void Reverse(const Executor& exec,
+                 size_t num, const real X[], const real Y[], const real Z[],
+                 real Xo[], real Yo[], real Zo[]) const {
+      exec.For(num, [this, X, Y, Z, Xo, Yo, Zo](size_t i0, size_t i1) -> void {
+        Reverse(i1 - i0, X + i0, Y + i0, Z + i0, Xo + i0, Yo + i0, Zo + i0);
+      });
+    }
+  };
+
+} // namespace GeographicLib
+
+#endif  // GEOGRAPHICLIB_HELMERT_HPP
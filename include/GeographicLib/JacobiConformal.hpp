@@ -1,11 +1,8 @@
 /**
  * \file JacobiConformal.hpp
- * \brief Header for GeographicLib::experimental::JacobiConformal class
+ * \brief Header for GeographicLib::JacobiConformal class
  *
- * \note This is just sample code.  It is not part of GeographicLib
- * itself.
- *
- * Copyright (c) Charles Karney (2014-2023) <karney@alum.mit.edu> and licensed
+ * Copyright (c) Charles Karney (2014-2026) <karney@alum.mit.edu> and licensed
  * under the MIT/X11 License.  For more information, see
  * https://geographiclib.sourceforge.io/
  **********************************************************************/
@@ -13,16 +10,22 @@
 #if !defined(GEOGRAPHICLIB_JACOBICONFORMAL_HPP)
 #define GEOGRAPHICLIB_JACOBICONFORMAL_HPP 1
 
+#include <cstddef>
+#include <vector>
 #include <GeographicLib/EllipticFunction.hpp>
+#include <GeographicLib/Executor.hpp>
+
+#if defined(_MSC_VER)
+// Squelch warnings about dll vs vector
+#  pragma warning (push)
+#  pragma warning (disable: 4251)
+#endif
 
 namespace GeographicLib {
-namespace experimental {
+
   /**
    * \brief Jacobi's conformal projection of a triaxial ellipsoid
    *
-   * <b>NOTE:</b> This is just sample code.  It is not part of GeographicLib
-   * itself.
-   *
    * This is a conformal projection of the ellipsoid to a plane in which
    * the grid lines are straight; see Jacobi,
    * <a href="https://books.google.com/books?id=ryEOAAAAQAAJ&pg=PA212">
@@ -40,16 +43,39 @@ namespace experimental {
    * points, \f$\left|\omega\right| = \left|\beta\right| = \frac12\pi\f$, lie
    * on middle principal ellipse in the plane \f$X=0\f$.
    *
+   * The projections \e x and \e y are given by incomplete elliptic integrals
+   * of the third kind.  The scalar member functions evaluate these directly.
+   * The array versions, which are intended for projecting many points (e.g.,
+   * the vertices of a mesh), instead use Fourier series for the periodic
+   * parts of the integrals; the coefficients are computed once by the
+   * constructor.  The results of the two methods agree to within a few
+   * ulps of the quadrant lengths.  If the Fourier series converges too
+   * slowly (which happens if the ellipsoid is nearly prolate or very flat),
+   * the array versions fall back to the direct evaluation.
+   *
    * For more information on this projection, see \ref jacobi.
+   *
+   * Example of use:
+   * \include example-JacobiConformal.cpp
    **********************************************************************/
-  class JacobiConformal {
+  class GEOGRAPHICLIB_EXPORT JacobiConformal {
+  private:
     typedef Math::real real;
     real _a, _b, _c, _ab2, _bc2, _ac2;
     EllipticFunction _ex, _ey;
+    // The Fourier coefficients for _ex.deltaPi and _ey.deltaPi; empty if the
+    // series doesn't converge.
+    std::vector<real> _fx, _fy;
+    static const size_t blk_ = 64;
     static void norm(real& x, real& y) {
       using std::hypot;
       real z = hypot(x, y); x /= z; y /= z;
     }
+    static void series(const EllipticFunction& e, std::vector<real>& F);
+    // Common code for the array versions of x and y
+    static void project(size_t num, const real ang[], real s, real c,
+                        real m, const EllipticFunction& e,
+                        const std::vector<real>& F, real proj[]);
   public:
     /**
      * Constructor for a trixial ellipsoid with semi-axes.
@@ -57,28 +83,13 @@ namespace experimental {
      * @param[in] a the largest semi-axis.
      * @param[in] b the middle semi-axis.
      * @param[in] c the smallest semi-axis.
+     * @exception GeographicErr if the axes are not in order.
      *
      * The semi-axes must satisfy \e a &ge; \e b &ge; \e c > 0 and \e a >
      * \e c.  This form of the constructor cannot be used to specify a
      * sphere (use the next constructor).
      **********************************************************************/
-    JacobiConformal(real a, real b, real c)
-      : _a(a), _b(b), _c(c)
-      , _ab2((_a - _b) * (_a + _b))
-      , _bc2((_b - _c) * (_b + _c))
-      , _ac2((_a - _c) * (_a + _c))
-      , _ex(_ab2 / _ac2 * Math::sq(_c / _b), -_ab2 / Math::sq(_b),
-            _bc2 / _ac2 * Math::sq(_a / _b), Math::sq(_a / _b))
-      , _ey(_bc2 / _ac2 * Math::sq(_a / _b), +_bc2 / Math::sq(_b),
-            _ab2 / _ac2 * Math::sq(_c / _b), Math::sq(_c / _b))
-    {
-      using std::isfinite;
-      if (!(isfinite(_a) && _a >= _b && _b >= _c && _c > 0))
-        throw GeographicErr("JacobiConformal: axes are not in order");
-      if (!(_a > _c))
-        throw GeographicErr
-          ("JacobiConformal: use alternate constructor for sphere");
-    }
+    JacobiConformal(real a, real b, real c);
     /**
      * Alternate constructor for a triaxial ellipsoid.
      *
@@ -87,31 +98,15 @@ namespace experimental {
      * @param[in] c the smallest semi-axis.
      * @param[in] ab the relative magnitude of \e a &minus; \e b.
      * @param[in] bc the relative magnitude of \e b &minus; \e c.
+     * @exception GeographicErr if the axes are not in order or if \e ab +
+     *   \e bc is not positive.
      *
      * This form can be used to specify a sphere.  The semi-axes must
      * satisfy \e a &ge; \e b &ge; c > 0.  The ratio \e ab : \e bc must equal
      * (<i>a</i>&minus;<i>b</i>) : (<i>b</i>&minus;<i>c</i>) with \e ab
      * &ge; 0, \e bc &ge; 0, and \e ab + \e bc > 0.
      **********************************************************************/
-    JacobiConformal(real a, real b, real c, real ab, real bc)
-      : _a(a), _b(b), _c(c)
-      , _ab2(ab * (_a + _b))
-      , _bc2(bc * (_b + _c))
-      , _ac2(_ab2 + _bc2)
-      , _ex(_ab2 / _ac2 * Math::sq(_c / _b),
-            -(_a - _b) * (_a + _b) / Math::sq(_b),
-            _bc2 / _ac2 * Math::sq(_a / _b), Math::sq(_a / _b))
-      , _ey(_bc2 / _ac2 * Math::sq(_a / _b),
-            +(_b - _c) * (_b + _c) / Math::sq(_b),
-            _ab2 / _ac2 * Math::sq(_c / _b), Math::sq(_c / _b))
-    {
-      using std::isfinite;
-      if (!(isfinite(_a) && _a >= _b && _b >= _c && _c > 0 &&
-            ab >= 0 && bc >= 0))
-        throw GeographicErr("JacobiConformal: axes are not in order");
-      if (!(ab + bc > 0 && isfinite(_ac2)))
-        throw GeographicErr("JacobiConformal: ab + bc must be positive");
-    }
+    JacobiConformal(real a, real b, real c, real ab, real bc);
     /**
      * @return the quadrant length in the \e x direction.
      **********************************************************************/
@@ -170,9 +165,65 @@ namespace experimental {
       Math::sincosd(bet, sbet, cbet);
       return y(sbet, cbet) / Math::degree();
     }
+
+    /** \name Projecting many points
+     **********************************************************************/
+    ///@{
+    /**
+     * The \e x projection of an array of points.
+     *
+     * @param[in] num the number of points.
+     * @param[in] omg array of &omega; (in degrees).
+     * @param[out] X array of \e x (in degrees).
+     *
+     * Each &omega; must be in [&minus;180&deg;, 180&deg;].
+     **********************************************************************/
+    void x(size_t num, const real omg[], real X[]) const;
+    /**
+     * The \e x projection of an array of points using several threads.
+     *
+     * @param[in] exec the Executor specifying the threads to use.
+     * @param[in] num the number of points.
+     * @param[in] omg array of &omega; (in degrees).
+     * @param[out] X array of \e x (in degrees).
+     **********************************************************************/
+    void x(const Executor& exec, size_t num, const real omg[], real X[])
+      const {
+      exec.For(num, [this, omg, X](size_t i0, size_t i1) -> void {
+        x(i1 - i0, omg + i0, X + i0);
+      });
+    }
+    /**
+     * The \e y projection of an array of points.
+     *
+     * @param[in] num the number of points.
+     * @param[in] bet array of &beta; (in degrees).
+     * @param[out] Y array of \e y (in degrees).
+     *
+     * Each &beta; must be in (&minus;180&deg;, 180&deg;].
+     **********************************************************************/
+    void y(size_t num, const real bet[], real Y[]) const;
+    /**
+     * The \e y projection of an array of points using several threads.
+     *
+     * @param[in] exec the Executor specifying the threads to use.
+     * @param[in] num the number of points.
+     * @param[in] bet array of &beta; (in degrees).
+     * @param[out] Y array of \e y (in degrees).
+     **********************************************************************/
+    void y(const Executor& exec, size_t num, const real bet[], real Y[])
+      const {
+      exec.For(num, [this, bet, Y](size_t i0, size_t i1) -> void {
+        y(i1 - i0, bet + i0, Y + i0);
+      });
+    }
+    ///@}
   };
 
-} // namespace experimental
 } // namespace GeographicLib
 
+#if defined(_MSC_VER)
+#  pragma warning (pop)
+#endif
+
 #endif  // GEOGRAPHICLIB_JACOBICONFORMAL_HPP
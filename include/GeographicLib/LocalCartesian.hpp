@@ -11,6 +11,7 @@
 #define GEOGRAPHICLIB_LOCALCARTESIAN_HPP 1
 
 #include <GeographicLib/Geocentric.hpp>
+#include <GeographicLib/Executor.hpp>
 #include <GeographicLib/Constants.hpp>
 
 namespace GeographicLib {
@@ -199,6 +200,175 @@ namespace GeographicLib {
         IntReverse(x, y, z, lat, lon, h, NULL);
     }
 
+    /** \name Converting many points
+     **********************************************************************/
+    ///@{
+    /**
+     * Convert an array of points from geodetic to local cartesian
+     * coordinates.
+     *
+     * @param[in] num the number of points.
+     * @param[in] lat array of latitudes (degrees).
+     * @param[in] lon array of longitudes (degrees).
+     * @param[in] h array of heights above the ellipsoid (meters).
+     * @param[out] x array of local cartesian coordinates (meters).
+     * @param[out] y array of local cartesian coordinates (meters).
+     * @param[out] z array of local cartesian coordinates (meters).
+     * @param[out] M (optional) array of 9\e num elements; if non-null,
+     *   M[9\e i] through M[9\e i + 8] are set to the rotation matrix for
+     *   point \e i in row-major order.
+     *
+     * The results are the same as calling LocalCartesian::Forward for each
+     * point.  The geocentric coordinates are computed with the array version
+     * of Geocentric::Forward and the rotation to the local frame is applied
+     * to a block of points at a time.
+     **********************************************************************/
+    void Forward(size_t num, const real lat[], const real lon[],
+                 const real h[], real x[], real y[], real z[],
+                 real M[] = nullptr) const;
+
+    /**
+     * Convert an array of points from local cartesian to geodetic
+     * coordinates.
+     *
+     * @param[in] num the number of points.
+     * @param[in] x array of local cartesian coordinates (meters).
+     * @param[in] y array of local cartesian coordinates (meters).
+     * @param[in] z array of local cartesian coordinates (meters).
+     * @param[out] lat array of latitudes (degrees).
+     * @param[out] lon array of longitudes (degrees).
+     * @param[out] h array of heights above the ellipsoid (meters).
+     * @param[out] M (optional) array of 9\e num elements for the rotation
+     *   matrices.
+     *
+     * The results are the same as calling LocalCartesian::Reverse for each
+     * point.
+     **********************************************************************/
+    void Reverse(size_t num, const real x[], const real y[], const real z[],
+                 real lat[], real lon[], real h[], real M[] = nullptr) const;
+
+    /**
+     * Convert an array of points from geodetic to local cartesian
+     * coordinates in parallel.
+     *
+     * @param[in] exec the Executor used to split the work between threads.
+     * @param[in] num the number of points.
+     * @param[in] lat array of latitudes (degrees).
+     * @param[in] lon array of longitudes (degrees).
+     * @param[in] h array of heights above the ellipsoid (meters).
+     * @param[out] x array of local cartesian coordinates (meters).
+     * @param[out] y array of local cartesian coordinates (meters).
+     * @param[out] z array of local cartesian coordinates (meters).
+     * @param[out] M (optional) array of 9\e num elements for the rotation
+     *   matrices.
+     **********************************************************************/
+    void Forward(const Executor& exec, size_t num,
+                 const real lat[], const real lon[], const real h[],
+                 real x[], real y[], real z[], real M[] = nullptr) const {
+      exec.For(num, [this, lat, lon, h, x, y, z, M]
+                    (size_t i0, size_t i1) -> void {
+        Forward(i1 - i0, lat + i0, lon + i0, h + i0, x + i0, y + i0, z + i0,
+                M ? M + dim2_ * i0 : nullptr);
+      });
+    }
+
+    /**
+     * Convert an array of points from local cartesian to geodetic
+     * coordinates in parallel.
+     *
+     * @param[in] exec the Executor used to split the work between threads.
+     * @param[in] num the number of points.
+     * @param[in] x array of local cartesian coordinates (meters).
+     * @param[in] y array of local cartesian coordinates (meters).
+     * @param[in] z array of local cartesian coordinates (meters).
+     * @param[out] lat array of latitudes (degrees).
+     * @param[out] lon array of longitudes (degrees).
+     * @param[out] h array of heights above the ellipsoid (meters).
+     * @param[out] M (optional) array of 9\e num elements for the rotation
+     *   matrices.
+     **********************************************************************/
+    void Reverse(const Executor& exec, size_t num,
+                 const real x[], const real y[], const real z[],
+                 real lat[], real lon[], real h[], real M[] = nullptr) const {
+      exec.For(num, [this, x, y, z, lat, lon, h, M]
+                    (size_t i0, size_t i1) -> void {
+        Reverse(i1 - i0, x + i0, y + i0, z + i0, lat + i0, lon + i0, h + i0,
+                M ? M + dim2_ * i0 : nullptr);
+      });
+    }
+    ///@}
+
+    /** \name Moving the origin
+     **********************************************************************/
+    ///@{
+    /**
+     * Convert an array of points from geocentric to local cartesian
+     * coordinates.
+     *
+     * @param[in] num the number of points.
+     * @param[in] X array of geocentric coordinates (meters).
+     * @param[in] Y array of geocentric coordinates (meters).
+     * @param[in] Z array of geocentric coordinates (meters).
+     * @param[out] x array of local cartesian coordinates (meters).
+     * @param[out] y array of local cartesian coordinates (meters).
+     * @param[out] z array of local cartesian coordinates (meters).
+     *
+     * This involves only a translation and a rotation.  If the points are
+     * to be expressed in the local frames of a moving platform, convert the
+     * points to geocentric coordinates once (with the array version of
+     * Geocentric::Forward) and then, for each position of the platform,
+     * call LocalCartesian::Reset followed by this function.  The output
+     * arrays may be the same as the input arrays.
+     **********************************************************************/
+    void FromGeocentric(size_t num,
+                        const real X[], const real Y[], const real Z[],
+                        real x[], real y[], real z[]) const;
+
+    /**
+     * Convert an array of points from local cartesian to geocentric
+     * coordinates.
+     *
+     * @param[in] num the number of points.
+     * @param[in] x array of local cartesian coordinates (meters).
+     * @param[in] y array of local cartesian coordinates (meters).
+     * @param[in] z array of local cartesian coordinates (meters).
+     * @param[out] X array of geocentric coordinates (meters).
+     * @param[out] Y array of geocentric coordinates (meters).
+     * @param[out] Z array of geocentric coordinates (meters).
+     *
+     * The output arrays may be the same as the input arrays.
+     **********************************************************************/
+    void ToGeocentric(size_t num,
+                      const real x[], const real y[], const real z[],
+                      real X[], real Y[], real Z[]) const;
+
+    /**
+     * Convert an array of points from another local cartesian system to
+     * this one.
+     *
+     * @param[in] from the LocalCartesian object defining the coordinate
+     *   system of the input points.
+     * @param[in] num the number of points.
+     * @param[in] x array of coordinates in the system \e from (meters).
+     * @param[in] y array of coordinates in the system \e from (meters).
+     * @param[in] z array of coordinates in the system \e from (meters).
+     * @param[out] xo array of coordinates in this system (meters).
+     * @param[out] yo array of coordinates in this system (meters).
+     * @param[out] zo array of coordinates in this system (meters).
+     *
+     * The combined rotation and translation is computed once, so that each
+     * point costs just 9 multiplications and 9 additions; this is useful if
+     * the origin is moved and previously converted points are to be
+     * expressed relative to the new origin.  Because the large geocentric
+     * coordinates cancel in the computation of the translation, the result
+     * is more accurate than converting the points via geocentric
+     * coordinates.  The output arrays may be the same as the input arrays.
+     **********************************************************************/
+    void FromLocal(const LocalCartesian& from, size_t num,
+                   const real x[], const real y[], const real z[],
+                   real xo[], real yo[], real zo[]) const;
+    ///@}
+
     /** \name Inspector functions
      **********************************************************************/
     ///@{
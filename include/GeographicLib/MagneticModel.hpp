@@ -23,6 +23,7 @@
 namespace GeographicLib {
 
   class MagneticCircle;
+  class MagneticPoint;
 
   /**
    * \brief Model of the earth's magnetic field
@@ -212,6 +213,27 @@ namespace GeographicLib {
      **********************************************************************/
     MagneticCircle Circle(real t, real lat, real h) const;
 
+    /**
+     * Create a MagneticPoint object to allow the geomagnetic field at a
+     * fixed point to be computed efficiently for many different times.
+     *
+     * @param[in] lat latitude of the point (degrees).
+     * @param[in] lon longitude of the point (degrees).
+     * @param[in] h the height of the point above the ellipsoid (meters).
+     * @exception std::bad_alloc if the memory necessary for creating a
+     *   MagneticPoint can't be allocated.
+     * @return a MagneticPoint object whose MagneticPoint::operator()(real t)
+     *   member function computes the field at particular values of \e t.
+     *
+     * This evaluates the spherical harmonic sums for all the epochs of the
+     * model once.  Thereafter, the field at any time is found by linear
+     * interpolation of the stored values.  If the field at a single point is
+     * needed for more times than there are epochs in the model, this will be
+     * substantially faster than calling MagneticModel::operator()()
+     * repeatedly.
+     **********************************************************************/
+    MagneticPoint Point(real lat, real lon, real h) const;
+
     /**
      * Compute the magnetic field in geocentric coordinate.
      *
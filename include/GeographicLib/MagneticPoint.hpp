@@ -0,0 +1,215 @@
+/**
+ * \file MagneticPoint.hpp
+ * \brief Header for GeographicLib::MagneticPoint class
+ *
+ * Copyright (c) Charles Karney (2026) <karney@alum.mit.edu> and licensed
+ * under the MIT/X11 License.  For more information, see
+ * https://geographiclib.sourceforge.io/
+ **********************************************************************/
+
+#if !defined(GEOGRAPHICLIB_MAGNETICPOINT_HPP)
+#define GEOGRAPHICLIB_MAGNETICPOINT_HPP 1
+
+#include <vector>
+#include <GeographicLib/Constants.hpp>
+
+#if defined(_MSC_VER)
+// Squelch warnings about dll vs vector
+#  pragma warning (push)
+#  pragma warning (disable: 4251)
+#endif
+
+namespace GeographicLib {
+
+  /**
+   * \brief Geomagnetic field at a fixed point
+   *
+   * Evaluate the earth's magnetic field at a fixed latitude, longitude, and
+   * height for many different times.  The spherical harmonic sums for each
+   * epoch of the model are evaluated once, when the object is constructed.
+   * Because the magnetic models are linear in time, the field at any time
+   * is then given by a linear combination of these stored values, so that
+   * each evaluation costs only a handful of floating point operations.  This
+   * is useful for observatory applications where a time series of the field
+   * at a fixed location is required.
+   *
+   * Use MagneticModel::Point to create a MagneticPoint object.  (The
+   * constructor for this class is private.)
+   *
+   * The results agree with MagneticModel::operator()() to within roundoff.
+   *
+   * Example of use:
+   * \include example-MagneticPoint.cpp
+   **********************************************************************/
+
+  class GEOGRAPHICLIB_EXPORT MagneticPoint {
+  private:
+    typedef Math::real real;
+
+    real _a, _f, _lat, _lon, _h, _t0, _dt0;
+    int _nNmodels;
+    // The rotation matrix from local cartesian to geocentric coordinates
+    real _mM[9];
+    // The field and its rate of change (both in the local basis) at the start
+    // of each of the _nNmodels time intervals; each entry holds 3
+    // components.  The contribution of the constant term, if any, is folded
+    // into _bB.
+    std::vector<real> _bB, _bBt;
+
+    MagneticPoint(real a, real f, real lat, real lon, real h,
+                  real t0, real dt0, int nNmodels, const real M[],
+                  const std::vector<real>& B,
+                  const std::vector<real>& Bt)
+      : _a(a)
+      , _f(f)
+      , _lat(Math::LatFix(lat))
+      , _lon(lon)
+      , _h(h)
+      , _t0(t0)
+      , _dt0(dt0)
+      , _nNmodels(nNmodels)
+      , _bB(B)
+      , _bBt(Bt)
+    { std::copy(M, M + 9, _mM); }
+
+    // Reduce t to the time since the start of the interval and return the
+    // index of the interval.
+    int Interval(real& t) const;
+
+    friend class MagneticModel; // MagneticModel calls the private constructor
+
+  public:
+
+    /**
+     * A default constructor for the magnetic point.  This sets up an
+     * uninitialized object which can be later replaced by the
+     * MagneticModel::Point.
+     **********************************************************************/
+    MagneticPoint() : _a(-1) {}
+
+    /** \name Compute the magnetic field
+     **********************************************************************/
+    ///@{
+    /**
+     * Evaluate the components of the geomagnetic field at a particular time.
+     *
+     * @param[in] t the time (fractional years).
+     * @param[out] Bx the easterly component of the magnetic field (nanotesla).
+     * @param[out] By the northerly component of the magnetic field
+     *   (nanotesla).
+     * @param[out] Bz the vertical (up) component of the magnetic field
+     *   (nanotesla).
+     **********************************************************************/
+    void operator()(real t, real& Bx, real& By, real& Bz) const {
+      int n = 3 * Interval(t);
+      Bx = _bB[n + 0] + t * _bBt[n + 0];
+      By = _bB[n + 1] + t * _bBt[n + 1];
+      Bz = _bB[n + 2] + t * _bBt[n + 2];
+    }
+
+    /**
+     * Evaluate the components of the geomagnetic field and their time
+     * derivatives at a particular time.
+     *
+     * @param[in] t the time (fractional years).
+     * @param[out] Bx the easterly component of the magnetic field (nanotesla).
+     * @param[out] By the northerly component of the magnetic field
+     *   (nanotesla).
+     * @param[out] Bz the vertical (up) component of the magnetic field
+     *   (nanotesla).
+     * @param[out] Bxt the rate of change of \e Bx (nT/yr).
+     * @param[out] Byt the rate of change of \e By (nT/yr).
+     * @param[out] Bzt the rate of change of \e Bz (nT/yr).
+     **********************************************************************/
+    void operator()(real t, real& Bx, real& By, real& Bz,
+                    real& Bxt, real& Byt, real& Bzt) const {
+      int n = 3 * Interval(t);
+      Bxt = _bBt[n + 0]; Bx = _bB[n + 0] + t * Bxt;
+      Byt = _bBt[n + 1]; By = _bB[n + 1] + t * Byt;
+      Bzt = _bBt[n + 2]; Bz = _bB[n + 2] + t * Bzt;
+    }
+
+    /**
+     * Evaluate the components of the geomagnetic field at many times.
+     *
+     * @param[in] num the number of times.
+     * @param[in] t array of times (fractional years).
+     * @param[out] Bx array of easterly components of the magnetic field (nT).
+     * @param[out] By array of northerly components of the magnetic field
+     *   (nT).
+     * @param[out] Bz array of vertical (up) components of the magnetic field
+     *   (nT).
+     * @param[out] Bxt (optional) array of rates of change of \e Bx (nT/yr).
+     * @param[out] Byt (optional) array of rates of change of \e By (nT/yr).
+     * @param[out] Bzt (optional) array of rates of change of \e Bz (nT/yr).
+     *
+     * The output arrays must have room for \e num elements.  The rates of
+     * change are only computed if \e Bxt, \e Byt, and \e Bzt are all
+     * non-null.
+     **********************************************************************/
+    void operator()(size_t num, const real t[],
+                    real Bx[], real By[], real Bz[],
+                    real Bxt[] = nullptr, real Byt[] = nullptr,
+                    real Bzt[] = nullptr) const;
+
+    /**
+     * Evaluate the components of the geomagnetic field and their time
+     * derivatives in geocentric coordinates at a particular time.
+     *
+     * @param[in] t the time (fractional years).
+     * @param[out] BX the \e X component of the magnetic field (nT).
+     * @param[out] BY the \e Y component of the magnetic field (nT).
+     * @param[out] BZ the \e Z component of the magnetic field (nT).
+     * @param[out] BXt the rate of change of \e BX (nT/yr).
+     * @param[out] BYt the rate of change of \e BY (nT/yr).
+     * @param[out] BZt the rate of change of \e BZ (nT/yr).
+     **********************************************************************/
+    void FieldGeocentric(real t, real& BX, real& BY, real& BZ,
+                         real& BXt, real& BYt, real& BZt) const;
+    ///@}
+
+    /** \name Inspector functions
+     **********************************************************************/
+    ///@{
+    /**
+     * @return true if the object has been initialized.
+     **********************************************************************/
+    bool Init() const { return _a > 0; }
+    /**
+     * @return \e a the equatorial radius of the ellipsoid (meters).  This is
+     *   the value inherited from the MagneticModel object used in the
+     *   constructor.
+     **********************************************************************/
+    Math::real EquatorialRadius() const
+    { return Init() ? _a : Math::NaN(); }
+    /**
+     * @return \e f the flattening of the ellipsoid.  This is the value
+     *   inherited from the MagneticModel object used in the constructor.
+     **********************************************************************/
+    Math::real Flattening() const
+    { return Init() ? _f : Math::NaN(); }
+    /**
+     * @return the latitude of the point (degrees).
+     **********************************************************************/
+    Math::real Latitude() const
+    { return Init() ? _lat : Math::NaN(); }
+    /**
+     * @return the longitude of the point (degrees).
+     **********************************************************************/
+    Math::real Longitude() const
+    { return Init() ? _lon : Math::NaN(); }
+    /**
+     * @return the height of the point (meters).
+     **********************************************************************/
+    Math::real Height() const
+    { return Init() ? _h : Math::NaN(); }
+    ///@}
+  };
+
+} // namespace GeographicLib
+
+#if defined(_MSC_VER)
+#  pragma warning (pop)
+#endif
+
+#endif  // GEOGRAPHICLIB_MAGNETICPOINT_HPP
@@ -36,6 +36,7 @@
 #endif
 
 #include <cmath>
+#include <cstddef>
 #include <algorithm>
 #include <limits>
 
@@ -282,6 +283,25 @@ namespace GeographicLib {
      **********************************************************************/
     template<typename T> static T AngNormalize(T x);
 
+    /**
+     * Normalize an array of angles.
+     *
+     * @tparam T the type of the arguments.
+     * @param[in] num the number of angles.
+     * @param[in] x array of angles in degrees.
+     * @param[out] y array of angles reduced to the range [&minus;180&deg;,
+     *   180&deg;].
+     *
+     * The results are identical to those of the scalar version of
+     * Math::AngNormalize.  The exact reduction is carried out with arithmetic
+     * operations and selections (instead of a call to remainder) so that the
+     * loop can be vectorized by the compiler; angles whose magnitudes are
+     * 2<sup>22</sup>&deg; or more (and NaNs) are handled by the scalar
+     * version.  \e y may be the same array as \e x.
+     **********************************************************************/
+    template<typename T> static void AngNormalize(size_t num, const T x[],
+                                                  T y[]);
+
     /**
      * Normalize a latitude.
      *
@@ -327,6 +347,25 @@ namespace GeographicLib {
     template<typename T> static T AngDiff(T x, T y)
     { T e; return AngDiff(x, y, e); }
 
+    /**
+     * The exact differences of two arrays of angles.
+     *
+     * @tparam T the type of the arguments.
+     * @param[in] num the number of angles.
+     * @param[in] x array of the first angles in degrees.
+     * @param[in] y array of the second angles in degrees.
+     * @param[out] d array of the truncated values of \e y &minus; \e x.
+     * @param[out] e array of the error terms in degrees (optional).
+     *
+     * The results are identical to those of the scalar version of
+     * Math::AngDiff; see Math::AngNormalize(size_t, const T[], T[]) for the
+     * treatment of large angles.  The output arrays may be the same as the
+     * input arrays.
+     **********************************************************************/
+    template<typename T> static void AngDiff(size_t num,
+                                             const T x[], const T y[],
+                                             T d[], T e[] = nullptr);
+
     /**
      * Coarsen a value close to zero.
      *
@@ -358,6 +397,27 @@ namespace GeographicLib {
      **********************************************************************/
     template<typename T> static void sincosd(T x, T& sinx, T& cosx);
 
+    /**
+     * Evaluate the sine and cosine function for an array of arguments in
+     * degrees.
+     *
+     * @tparam T the type of the arguments.
+     * @param[in] num the number of values.
+     * @param[in] x array of angles in degrees.
+     * @param[out] sinx array of sin(<i>x</i>).
+     * @param[out] cosx array of cos(<i>x</i>).
+     *
+     * The results are identical to those of the scalar version of
+     * Math::sincosd, including the exact results for multiples of 90&deg;
+     * and the signs of zeros.  The reduction of the arguments
+     * and the assignment to quadrants are done with loops which the compiler
+     * can vectorize (see Math::AngNormalize(size_t, const T[], T[])); the
+     * calls to sin and cos are made in a separate loop.  The output arrays
+     * may be the same as \e x.
+     **********************************************************************/
+    template<typename T> static void sincosd(size_t num, const T x[],
+                                             T sinx[], T cosx[]);
+
     /**
      * Evaluate the sine and cosine with reduced argument plus correction
      *
@@ -423,6 +483,26 @@ namespace GeographicLib {
      **********************************************************************/
     template<typename T> static T atan2d(T y, T x);
 
+    /**
+     * Evaluate the atan2 function with the result in degrees for arrays of
+     * arguments.
+     *
+     * @tparam T the type of the arguments.
+     * @param[in] num the number of values.
+     * @param[in] y array of \e y.
+     * @param[in] x array of \e x.
+     * @param[out] ang array of atan2(<i>y</i>, <i>x</i>) in degrees.
+     *
+     * The results are identical to those of the scalar version of
+     * Math::atan2d.  The octant reduction and the assignment to quadrants are
+     * done with loops which the compiler can vectorize; the calls to atan2
+     * are made in a separate loop.  \e ang may be the same array as \e y or
+     * \e x.
+     **********************************************************************/
+    template<typename T> static void atan2d(size_t num,
+                                            const T y[], const T x[],
+                                            T ang[]);
+
     /**
      * Evaluate the atan function with the result in degrees
      *
@@ -484,6 +564,41 @@ namespace GeographicLib {
      **********************************************************************/
     template<typename T> static T tauf(T taup, T es);
 
+    /**
+     * tan&chi; in terms of tan&phi; for an array of values.
+     *
+     * @tparam T the type of the arguments.
+     * @param[in] num the number of values.
+     * @param[in] tau array of &tau; = tan&phi;.
+     * @param[out] taup array of &tau;&prime; = tan&chi;.
+     * @param[in] es the signed eccentricity = sign(<i>e</i><sup>2</sup>)
+     *   sqrt(|<i>e</i><sup>2</sup>|)
+     *
+     * The results are identical to those of the scalar version of
+     * Math::taupf.  The loop is written without branches so that it can be
+     * vectorized by the compiler.  \e taup may be the same array as \e tau.
+     **********************************************************************/
+    template<typename T> static void taupf(size_t num, const T tau[],
+                                           T taup[], T es);
+
+    /**
+     * tan&phi; in terms of tan&chi; for an array of values.
+     *
+     * @tparam T the type of the arguments.
+     * @param[in] num the number of values.
+     * @param[in] taup array of &tau;&prime; = tan&chi;.
+     * @param[out] tau array of &tau; = tan&phi;.
+     * @param[in] es the signed eccentricity = sign(<i>e</i><sup>2</sup>)
+     *   sqrt(|<i>e</i><sup>2</sup>|)
+     *
+     * The results are identical to those of the scalar version of
+     * Math::tauf.  Each Newton iteration is applied to a block of values at a
+     * time (values which have already converged are left unchanged).  \e
+     * tau and \e taup must not overlap.
+     **********************************************************************/
+    template<typename T> static void tauf(size_t num, const T taup[],
+                                          T tau[], T es);
+
     /**
      * The NaN (not a number)
      *
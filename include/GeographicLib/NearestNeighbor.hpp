@@ -2,7 +2,7 @@
  * \file NearestNeighbor.hpp
  * \brief Header for GeographicLib::NearestNeighbor class
  *
- * Copyright (c) Charles Karney (2016-2020) <karney@alum.mit.edu> and licensed
+ * Copyright (c) Charles Karney (2016-2026) <karney@alum.mit.edu> and licensed
  * under the MIT/X11 License.  For more information, see
  * https://geographiclib.sourceforge.io/
  **********************************************************************/
@@ -264,88 +264,112 @@ namespace GeographicLib {
                   dist_t tol = 0) const {
       if (_numpoints != int(pts.size()))
           throw GeographicLib::GeographicErr("pts array has wrong size");
-      std::priority_queue<item> results;
-      if (_numpoints > 0 && k > 0 && maxdist > mindist) {
-        // distance to the kth closest point so far
-        dist_t tau = maxdist;
-        // first is negative of how far query is outside boundary of node
-        // +1 if on boundary or inside
-        // second is node index
-        std::priority_queue<item> todo;
-        todo.push(std::make_pair(dist_t(1), int(_tree.size()) - 1));
-        int c = 0;
-        while (!todo.empty()) {
-          int n = todo.top().second;
-          dist_t d = -todo.top().first;
-          todo.pop();
-          dist_t tau1 = tau - tol;
-          // compare tau and d again since tau may have become smaller.
-          if (!( n >= 0 && tau1 >= d )) continue;
-          const Node& current = _tree[n];
-          dist_t dst = 0;   // to suppress warning about uninitialized variable
-          bool exitflag = false, leaf = current.index < 0;
-          for (int i = 0; i < (leaf ? _bucket : 1); ++i) {
-            int index = leaf ? current.leaves[i] : current.index;
-            if (index < 0) break;
-            dst = dist(pts[index], query);
-            ++c;
-
-            if (dst > mindist && dst <= tau) {
-              if (int(results.size()) == k) results.pop();
-              results.push(std::make_pair(dst, index));
-              if (int(results.size()) == k) {
-                if (exhaustive)
-                  tau = results.top().first;
-                else {
-                  exitflag = true;
-                  break;
-                }
-                if (tau <= tol) {
-                  exitflag = true;
-                  break;
-                }
-              }
-            }
-          }
-          if (exitflag) break;
-
-          if (current.index < 0) continue;
-          tau1 = tau - tol;
-          for (int l = 0; l < 2; ++l) {
-            if (current.data.child[l] >= 0 &&
-                dst + current.data.upper[l] >= mindist) {
-              if (dst < current.data.lower[l]) {
-                d = current.data.lower[l] - dst;
-                if (tau1 >= d)
-                  todo.push(std::make_pair(-d, current.data.child[l]));
-              } else if (dst > current.data.upper[l]) {
-                d = dst - current.data.upper[l];
-                if (tau1 >= d)
-                  todo.push(std::make_pair(-d, current.data.child[l]));
-              } else
-                todo.push(std::make_pair(dist_t(1), current.data.child[l]));
-            }
-          }
-        }
-        ++_k;
-        _c1 += c;
-        double omc = _mc;
-        _mc += (c - omc) / _k;
-        _sc += (c - omc) * (c - _mc);
-        if (c > _cmax) _cmax = c;
-        if (c < _cmin) _cmin = c;
-      }
-
-      dist_t d = -1;
-      ind.resize(results.size());
-
-      for (int i = int(ind.size()); i--;) {
-        ind[i] = int(results.top().second);
-        if (i == 0) d = results.top().first;
-        results.pop();
-      }
+      int c;
+      dist_t d = search(pts, dist, query, ind, k, maxdist, mindist,
+                        exhaustive, tol, c);
+      record(c);
       return d;
+    }
 
+    /**
+     * Search the NearestNeighbor for several query points.
+     *
+     * @param[in] pts the vector of points used for initialization.
+     * @param[in] dist the distance function object used for initialization.
+     * @param[in] queries the query points.
+     * @param[out] ind a vector of vectors of indices to the closest points
+     *   found; <i>ind</i><sub><i>i</i></sub> gives the results for
+     *   <i>queries</i><sub><i>i</i></sub>.
+     * @param[out] d a vector of the distances to the closest point found
+     *   for each query (&minus;1 if no points are found).
+     * @param[in] k the number of points to search for (default = 1).
+     * @param[in] maxdist only return points with distances of \e maxdist or
+     *   less from the query (default is the maximum \e dist_t).
+     * @param[in] mindist only return points with distances of more than
+     *   \e mindist from the query (default = &minus;1).
+     * @param[in] exhaustive whether to do an exhaustive search (default true).
+     * @param[in] tol the tolerance on the results (default 0).
+     * @exception GeographicErr if \e pts has a different size from that used
+     *   to construct the object.
+     *
+     * This is equivalent to calling Search for each query point.
+     **********************************************************************/
+    void Search(const std::vector<pos_t>& pts, const distfun_t& dist,
+                const std::vector<pos_t>& queries,
+                std::vector< std::vector<int> >& ind,
+                std::vector<dist_t>& d,
+                int k = 1,
+                dist_t maxdist = std::numeric_limits<dist_t>::max(),
+                dist_t mindist = -1,
+                bool exhaustive = true,
+                dist_t tol = 0) const {
+      if (_numpoints != int(pts.size()))
+          throw GeographicLib::GeographicErr("pts array has wrong size");
+      ind.resize(queries.size());
+      d.resize(queries.size());
+      for (size_t i = 0; i < queries.size(); ++i)
+        d[i] = Search(pts, dist, queries[i], ind[i], k, maxdist, mindist,
+                      exhaustive, tol);
+    }
+
+    /**
+     * Search the NearestNeighbor for several query points using several
+     * threads.
+     *
+     * @tparam executor the class used to run the searches in parallel,
+     *   usually GeographicLib::Executor.
+     * @param[in] exec the executor; this must provide a member function
+     *   <code>For(size_t num, const std::function<void(size_t, size_t)>&
+     *   f) const</code> which calls \e f for a set of disjoint ranges
+     *   covering [0, \e num).
+     * @param[in] pts the vector of points used for initialization.
+     * @param[in] dist the distance function object used for initialization.
+     * @param[in] queries the query points.
+     * @param[out] ind a vector of vectors of indices to the closest points
+     *   found; <i>ind</i><sub><i>i</i></sub> gives the results for
+     *   <i>queries</i><sub><i>i</i></sub>.
+     * @param[out] d a vector of the distances to the closest point found
+     *   for each query (&minus;1 if no points are found).
+     * @param[in] k the number of points to search for (default = 1).
+     * @param[in] maxdist only return points with distances of \e maxdist or
+     *   less from the query (default is the maximum \e dist_t).
+     * @param[in] mindist only return points with distances of more than
+     *   \e mindist from the query (default = &minus;1).
+     * @param[in] exhaustive whether to do an exhaustive search (default true).
+     * @param[in] tol the tolerance on the results (default 0).
+     * @exception GeographicErr if \e pts has a different size from that used
+     *   to construct the object.
+     *
+     * \e dist must be safe to call concurrently.  The results, including
+     * the statistics reported by Statistics(), are the same as for the
+     * serial version.  The executor is a template parameter so that this
+     * class remains header-only.
+     **********************************************************************/
+    template<class executor>
+    void Search(const executor& exec,
+                const std::vector<pos_t>& pts, const distfun_t& dist,
+                const std::vector<pos_t>& queries,
+                std::vector< std::vector<int> >& ind,
+                std::vector<dist_t>& d,
+                int k = 1,
+                dist_t maxdist = std::numeric_limits<dist_t>::max(),
+                dist_t mindist = -1,
+                bool exhaustive = true,
+                dist_t tol = 0) const {
+      if (_numpoints != int(pts.size()))
+          throw GeographicLib::GeographicErr("pts array has wrong size");
+      size_t num = queries.size();
+      ind.resize(num);
+      d.resize(num);
+      // The search costs; these are recorded serially afterwards.
+      std::vector<int> cost(num);
+      exec.For(num, [&](size_t i0, size_t i1) -> void {
+        for (size_t i = i0; i < i1; ++i)
+          d[i] = search(pts, dist, queries[i], ind[i], k, maxdist, mindist,
+                        exhaustive, tol, cost[i]);
+      });
+      for (size_t i = 0; i < num; ++i)
+        record(cost[i]);
     }
 
     /**
@@ -805,6 +829,102 @@ namespace GeographicLib {
       return int(tree.size()) - 1;
     }
 
+    // The search without the update of the statistics; cost is set to the
+    // number of calls to dist (or -1 if no search was done).
+    dist_t search(const std::vector<pos_t>& pts, const distfun_t& dist,
+                  const pos_t& query, std::vector<int>& ind,
+                  int k, dist_t maxdist, dist_t mindist,
+                  bool exhaustive, dist_t tol, int& cost) const {
+      std::priority_queue<item> results;
+      cost = -1;
+      if (_numpoints > 0 && k > 0 && maxdist > mindist) {
+        // distance to the kth closest point so far
+        dist_t tau = maxdist;
+        // first is negative of how far query is outside boundary of node
+        // +1 if on boundary or inside
+        // second is node index
+        std::priority_queue<item> todo;
+        todo.push(std::make_pair(dist_t(1), int(_tree.size()) - 1));
+        int c = 0;
+        while (!todo.empty()) {
+          int n = todo.top().second;
+          dist_t d = -todo.top().first;
+          todo.pop();
+          dist_t tau1 = tau - tol;
+          // compare tau and d again since tau may have become smaller.
+          if (!( n >= 0 && tau1 >= d )) continue;
+          const Node& current = _tree[n];
+          dist_t dst = 0;   // to suppress warning about uninitialized variable
+          bool exitflag = false, leaf = current.index < 0;
+          for (int i = 0; i < (leaf ? _bucket : 1); ++i) {
+            int index = leaf ? current.leaves[i] : current.index;
+            if (index < 0) break;
+            dst = dist(pts[index], query);
+            ++c;
+
+            if (dst > mindist && dst <= tau) {
+              if (int(results.size()) == k) results.pop();
+              results.push(std::make_pair(dst, index));
+              if (int(results.size()) == k) {
+                if (exhaustive)
+                  tau = results.top().first;
+                else {
+                  exitflag = true;
+                  break;
+                }
+                if (tau <= tol) {
+                  exitflag = true;
+                  break;
+                }
+              }
+            }
+          }
+          if (exitflag) break;
+
+          if (current.index < 0) continue;
+          tau1 = tau - tol;
+          for (int l = 0; l < 2; ++l) {
+            if (current.data.child[l] >= 0 &&
+                dst + current.data.upper[l] >= mindist) {
+              if (dst < current.data.lower[l]) {
+                d = current.data.lower[l] - dst;
+                if (tau1 >= d)
+                  todo.push(std::make_pair(-d, current.data.child[l]));
+              } else if (dst > current.data.upper[l]) {
+                d = dst - current.data.upper[l];
+                if (tau1 >= d)
+                  todo.push(std::make_pair(-d, current.data.child[l]));
+              } else
+                todo.push(std::make_pair(dist_t(1), current.data.child[l]));
+            }
+          }
+        }
+        cost = c;
+      }
+
+      dist_t d = -1;
+      ind.resize(results.size());
+
+      for (int i = int(ind.size()); i--;) {
+        ind[i] = int(results.top().second);
+        if (i == 0) d = results.top().first;
+        results.pop();
+      }
+      return d;
+    }
+
+    // Update the statistics with the cost of a search
+    void record(int c) const {
+      if (c < 0) return;
+      ++_k;
+      _c1 += c;
+      double omc = _mc;
+      _mc += (c - omc) / _k;
+      _sc += (c - omc) * (c - _mc);
+      if (c > _cmax) _cmax = c;
+      if (c < _cmin) _cmin = c;
+    }
+
   };
 
 } // namespace GeographicLib
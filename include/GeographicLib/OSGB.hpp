@@ -12,6 +12,7 @@
 
 #include <GeographicLib/Constants.hpp>
 #include <GeographicLib/TransverseMercator.hpp>
+#include <GeographicLib/Executor.hpp>
 
 #if defined(_MSC_VER)
 // Squelch warnings about dll vs string
@@ -63,6 +64,11 @@ namespace GeographicLib {
     };
     static real computenorthoffset();
     static void CheckCoords(real x, real y);
+    // Write the grid reference to grid (without a terminating null) and
+    // return its length.
+    static int Encode(real x, real y, int prec, char grid[]);
+    static void Decode(const char* gridref, int n,
+                       real& x, real& y, int& prec, bool centerp);
     OSGB() = delete;            // Disable constructor
   public:
 
@@ -174,6 +180,191 @@ namespace GeographicLib {
                               real& x, real& y, int& prec,
                               bool centerp = true);
 
+    /** \name Batch conversions
+     **********************************************************************/
+    ///@{
+    /**
+     * Forward projection of an array of points.
+     *
+     * @param[in] num the number of points.
+     * @param[in] lat array of latitudes of the points (degrees).
+     * @param[in] lon array of longitudes of the points (degrees).
+     * @param[out] x array of eastings (meters).
+     * @param[out] y array of northings (meters).
+     * @param[out] gamma (optional) array of meridian convergences (degrees).
+     * @param[out] k (optional) array of scales.
+     *
+     * The output arrays must have room for \e num elements.  \e gamma and
+     * \e k are only set if they are non-null.
+     **********************************************************************/
+    static void Forward(size_t num, const real lat[], const real lon[],
+                        real x[], real y[],
+                        real gamma[] = nullptr, real k[] = nullptr);
+
+    /**
+     * Reverse projection of an array of points.
+     *
+     * @param[in] num the number of points.
+     * @param[in] x array of eastings of the points (meters).
+     * @param[in] y array of northings of the points (meters).
+     * @param[out] lat array of latitudes (degrees).
+     * @param[out] lon array of longitudes (degrees).
+     * @param[out] gamma (optional) array of meridian convergences (degrees).
+     * @param[out] k (optional) array of scales.
+     *
+     * The output arrays must have room for \e num elements.  \e gamma and
+     * \e k are only set if they are non-null.
+     **********************************************************************/
+    static void Reverse(size_t num, const real x[], const real y[],
+                        real lat[], real lon[],
+                        real gamma[] = nullptr, real k[] = nullptr);
+
+    /**
+     * @param[in] prec precision relative to 100 km.
+     * @return the number of characters needed to store a grid reference
+     *   with precision \e prec, including the terminating null.
+     *
+     * This is max(2 + 2 \e prec, 7) + 1 (the 7 allows for "INVALID").
+     **********************************************************************/
+    static int GridReferenceWidth(int prec)
+    { return (2 + 2 * prec > 7 ? 2 + 2 * prec : 7) + 1; }
+
+    /**
+     * Convert an array of OSGB coordinates to grid references.
+     *
+     * @param[in] num the number of points.
+     * @param[in] x array of eastings (meters).
+     * @param[in] y array of northings (meters).
+     * @param[in] prec precision relative to 100 km.
+     * @param[out] gridref buffer for the grid references.
+     * @exception GeographicErr if \e prec, \e x, or \e y is outside its
+     *   allowed range.
+     *
+     * The grid reference for the point \e i is written as a null terminated
+     * string starting at \e gridref + \e i \e w, where \e w =
+     * GridReferenceWidth(\e prec); thus \e gridref must have room for \e
+     * num \e w characters.  No memory is allocated (except when an exception
+     * is thrown).
+     **********************************************************************/
+    static void GridReference(size_t num, const real x[], const real y[],
+                              int prec, char gridref[]);
+
+    /**
+     * Convert an array of OSGB grid references to coordinates.
+     *
+     * @param[in] num the number of grid references.
+     * @param[in] gridref buffer holding the grid references.
+     * @param[in] width the number of characters allocated to each grid
+     *   reference.
+     * @param[out] x array of eastings (meters).
+     * @param[out] y array of northings (meters).
+     * @param[out] prec array of precisions relative to 100 km.
+     * @param[in] centerp if true (default), return center of the grid square,
+     *   else return SW (lower left) corner.
+     * @exception GeographicErr if any grid reference is illegal.
+     *
+     * The grid reference for point \e i is given by the characters starting
+     * at \e gridref + \e i \e width; it is terminated by a null or after \e
+     * width characters.  This is compatible with the output of the batch
+     * version of GridReference(size_t, const real[], const real[], int,
+     * char[]) with \e width = GridReferenceWidth(\e prec).
+     **********************************************************************/
+    static void GridReference(size_t num, const char gridref[], size_t width,
+                              real x[], real y[], int prec[],
+                              bool centerp = true);
+
+    /**
+     * OSGB::Forward for an array of points processed in parallel.
+     *
+     * @param[in] exec the Executor used to split the work between threads.
+     * @param[in] num the number of points.
+     * @param[in] lat array of latitudes of the points (degrees).
+     * @param[in] lon array of longitudes of the points (degrees).
+     * @param[out] x array of eastings (meters).
+     * @param[out] y array of northings (meters).
+     * @param[out] gamma (optional) array of meridian convergences (degrees).
+     * @param[out] k (optional) array of scales.
+     **********************************************************************/
+    static void Forward(const Executor& exec,
+                        size_t num, const real lat[], const real lon[],
+                        real x[], real y[],
+                        real gamma[] = nullptr, real k[] = nullptr) {
+      exec.For(num, [=](size_t i0, size_t i1) -> void {
+        Forward(i1 - i0, lat + i0, lon + i0, x + i0, y + i0,
+                gamma ? gamma + i0 : nullptr, k ? k + i0 : nullptr);
+      });
+    }
+
+    /**
+     * OSGB::Reverse for an array of points processed in parallel.
+     *
+     * @param[in] exec the Executor used to split the work between threads.
+     * @param[in] num the number of points.
+     * @param[in] x array of eastings of the points (meters).
+     * @param[in] y array of northings of the points (meters).
+     * @param[out] lat array of latitudes (degrees).
+     * @param[out] lon array of longitudes (degrees).
+     * @param[out] gamma (optional) array of meridian convergences (degrees).
+     * @param[out] k (optional) array of scales.
+     **********************************************************************/
+    static void Reverse(const Executor& exec,
+                        size_t num, const real x[], const real y[],
+                        real lat[], real lon[],
+                        real gamma[] = nullptr, real k[] = nullptr) {
+      exec.For(num, [=](size_t i0, size_t i1) -> void {
+        Reverse(i1 - i0, x + i0, y + i0, lat + i0, lon + i0,
+                gamma ? gamma + i0 : nullptr, k ? k + i0 : nullptr);
+      });
+    }
+
+    /**
+     * OSGB::GridReference for an array of points processed in parallel.
+     *
+     * @param[in] exec the Executor used to split the work between threads.
+     * @param[in] num the number of points.
+     * @param[in] x array of eastings (meters).
+     * @param[in] y array of northings (meters).
+     * @param[in] prec precision relative to 100 km.
+     * @param[out] gridref buffer for the grid references.
+     * @exception GeographicErr if \e prec, \e x, or \e y is outside its
+     *   allowed range.
+     **********************************************************************/
+    static void GridReference(const Executor& exec,
+                              size_t num, const real x[], const real y[],
+                              int prec, char gridref[]) {
+      size_t w = GridReferenceWidth(prec);
+      exec.For(num, [=](size_t i0, size_t i1) -> void {
+        GridReference(i1 - i0, x + i0, y + i0, prec, gridref + i0 * w);
+      });
+    }
+
+    /**
+     * OSGB::GridReference for an array of grid references processed in
+     * parallel.
+     *
+     * @param[in] exec the Executor used to split the work between threads.
+     * @param[in] num the number of grid references.
+     * @param[in] gridref buffer holding the grid references.
+     * @param[in] width the number of characters allocated to each grid
+     *   reference.
+     * @param[out] x array of eastings (meters).
+     * @param[out] y array of northings (meters).
+     * @param[out] prec array of precisions relative to 100 km.
+     * @param[in] centerp if true (default), return center of the grid square,
+     *   else return SW (lower left) corner.
+     * @exception GeographicErr if any grid reference is illegal.
+     **********************************************************************/
+    static void GridReference(const Executor& exec,
+                              size_t num, const char gridref[], size_t width,
+                              real x[], real y[], int prec[],
+                              bool centerp = true) {
+      exec.For(num, [=](size_t i0, size_t i1) -> void {
+        GridReference(i1 - i0, gridref + i0 * width, width,
+                      x + i0, y + i0, prec + i0, centerp);
+      });
+    }
+    ///@}
+
     /** \name Inspector functions
      **********************************************************************/
     ///@{
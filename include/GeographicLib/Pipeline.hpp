@@ -0,0 +1,291 @@
+/**
+ * \file Pipeline.hpp
+ * \brief Header for GeographicLib::Pipeline class
+ *
+ * Copyright (c) Charles Karney (2026) <karney@alum.mit.edu> and licensed under
+ * the MIT/X11 License.  For more information, see
+ * https://geographiclib.sourceforge.io/
+ **********************************************************************/
+
+#if !defined(GEOGRAPHICLIB_PIPELINE_HPP)
+#define GEOGRAPHICLIB_PIPELINE_HPP 1
+
+#include <functional>
+#include <vector>
+#include <GeographicLib/Constants.hpp>
+#include <GeographicLib/Executor.hpp>
+#include <GeographicLib/UTMUPS.hpp>
+
+#if defined(_MSC_VER)
+// Squelch warnings about dll vs vector
+#  pragma warning (push)
+#  pragma warning (disable: 4251)
+#endif
+
+namespace GeographicLib {
+
+  class Geocentric;
+  class Helmert;
+  class Geoid;
+  class TransverseMercator;
+  class LocalCartesian;
+
+  /**
+   * \brief A fused sequence of coordinate conversions
+   *
+   * A Pipeline is built by appending conversion steps, each of which maps
+   * a triplet of coordinates of one kind to another, for example,
+   * \code
+   Pipeline p(Pipeline::GEODETIC);
+   p.ToGeocentric(etrs89).Shift(helmert).ToGeodetic(wgs84)
+     .GeoidHeight(geoid).ToUTMUPS();
+   \endcode
+   * Pipeline::Run then applies all the steps to arrays of points.  The
+   * points are processed in blocks of a few hundred which are held in
+   * buffers on the stack; each step is carried out for the whole block
+   * using the array versions of the underlying functions before the next
+   * step is applied.  Thus there are no intermediate arrays of the size of
+   * the input and the intermediate results remain in the cache.  The
+   * conversions from geodetic coordinates (Geocentric::Forward,
+   * LocalCartesian::Forward, and TransverseMercator::Forward) evaluate the
+   * trigonometric functions (and, for TransverseMercator, the conformal
+   * latitudes) for the whole block with the array versions of the Math
+   * functions, and Helmert is a simple loop over the block; the remaining
+   * steps (Geocentric::Reverse, UTMUPS::Forward, and Geoid::operator())
+   * handle the points in the block one at a time.  With an Executor, the
+   * blocks are processed in parallel.  The results are the same as applying
+   * the scalar conversions in turn to each point.
+   *
+   * The objects passed to the steps are copied, except for Geoid objects
+   * (which may be large) which are held by reference; these must remain in
+   * scope while the Pipeline is used.
+   *
+   * Example of use:
+   * \include example-Pipeline.cpp
+   **********************************************************************/
+
+  class GEOGRAPHICLIB_EXPORT Pipeline {
+  public:
+    /**
+     * The kinds of coordinates.
+     **********************************************************************/
+    enum coords {
+      /**
+       * Geodetic latitude, longitude (degrees), and height above the
+       * ellipsoid (meters).  After Pipeline::GeoidHeight the height is the
+       * height above the geoid.
+       **********************************************************************/
+      GEODETIC = 0,
+      /**
+       * Geocentric \e X, \e Y, \e Z (meters).
+       **********************************************************************/
+      GEOCENTRIC = 1,
+      /**
+       * Local cartesian \e x, \e y, \e z (meters).
+       **********************************************************************/
+      LOCAL = 2,
+      /**
+       * Projected easting and northing (meters) and height; for
+       * Pipeline::ToUTMUPS, the zone and hemisphere are also returned.
+       **********************************************************************/
+      PROJECTED = 3,
+    };
+  private:
+    typedef Math::real real;
+    static const size_t blk_ = 256;
+    // The buffers for a block of points.  The current coordinates are in
+    // c[0..2]; the steps write their results to c[3..5] and swap.
+    struct Block {
+      real buf[7][blk_];
+      real* c[6];
+      int zone[blk_];
+      bool northp[blk_];
+      Block();
+      void swap();
+    };
+    typedef std::function<void(size_t, Block&)> step;
+    int _input, _output;
+    bool _threadsafe, _utmups;
+    std::vector<step> _steps;
+    void add(int in, int out, const step& s);
+    void run(size_t num,
+             const real in0[], const real in1[], const real in2[],
+             real out0[], real out1[], real out2[],
+             int zone[], bool northp[]) const;
+  public:
+
+    /**
+     * Constructor for an empty pipeline.
+     *
+     * @param[in] input the kind of coordinates of the input, one of
+     *   Pipeline::coords (default Pipeline::GEODETIC).
+     * @exception GeographicErr if \e input is not a Pipeline::coords value.
+     **********************************************************************/
+    explicit Pipeline(int input = GEODETIC);
+
+    /** \name Adding steps to the pipeline.
+     *
+     * Each of these functions returns a reference to the Pipeline, so that
+     * calls can be chained, and throws GeographicErr if the current output of
+     * the pipeline is not of the kind required by the step.
+     **********************************************************************/
+    ///@{
+    /**
+     * Convert geodetic coordinates to geocentric coordinates.
+     *
+     * @param[in] earth the Geocentric object specifying the ellipsoid.
+     * @return a reference to this Pipeline.
+     **********************************************************************/
+    Pipeline& ToGeocentric(const Geocentric& earth);
+
+    /**
+     * Convert geocentric coordinates to geodetic coordinates.
+     *
+     * @param[in] earth the Geocentric object specifying the ellipsoid.
+     * @return a reference to this Pipeline.
+     **********************************************************************/
+    Pipeline& ToGeodetic(const Geocentric& earth);
+
+    /**
+     * Apply a Helmert transformation to geocentric coordinates.
+     *
+     * @param[in] helmert the Helmert transformation.
+     * @param[in] reverse if true, apply the reverse transformation (default
+     *   false).
+     * @return a reference to this Pipeline.
+     **********************************************************************/
+    Pipeline& Shift(const Helmert& helmert, bool reverse = false);
+
+    /**
+     * Convert the height in geodetic coordinates between the ellipsoid and
+     * the geoid.
+     *
+     * @param[in] geoid the Geoid object; this is held by reference.
+     * @param[in] toorthometric if true (the default), convert the height
+     *   above the ellipsoid to the height above the geoid; otherwise convert
+     *   the height above the geoid to the height above the ellipsoid.
+     * @return a reference to this Pipeline.
+     *
+     * If \e geoid is not thread-safe, Pipeline::Run processes all the
+     * points in the calling thread (see Geoid::operator()(const Executor&,
+     * size_t, const real[], const real[], real[]) const).
+     **********************************************************************/
+    Pipeline& GeoidHeight(const Geoid& geoid, bool toorthometric = true);
+
+    /**
+     * Project geodetic coordinates with the transverse Mercator projection.
+     *
+     * @param[in] tm the TransverseMercator object.
+     * @param[in] lon0 the central meridian (degrees).
+     * @return a reference to this Pipeline.
+     *
+     * The height is passed through unchanged.
+     **********************************************************************/
+    Pipeline& ToTransverseMercator(const TransverseMercator& tm, real lon0);
+
+    /**
+     * Project geodetic coordinates with UTM or UPS.
+     *
+     * @param[in] setzone zone override applied to all the points (optional);
+     *   see UTMUPS::Forward.
+     * @return a reference to this Pipeline.
+     *
+     * The height is passed through unchanged.  The zones and hemispheres
+     * are returned by Pipeline::Run.  Pipeline::Run throws GeographicErr if
+     * a point can't be converted.
+     **********************************************************************/
+    Pipeline& ToUTMUPS(int setzone = UTMUPS::STANDARD);
+
+    /**
+     * Convert geodetic or geocentric coordinates to local cartesian
+     * coordinates.
+     *
+     * @param[in] lc the LocalCartesian object.
+     * @return a reference to this Pipeline.
+     **********************************************************************/
+    Pipeline& ToLocalCartesian(const LocalCartesian& lc);
+
+    /**
+     * Convert local cartesian coordinates to geocentric coordinates.
+     *
+     * @param[in] lc the LocalCartesian object.
+     * @return a reference to this Pipeline.
+     **********************************************************************/
+    Pipeline& FromLocalCartesian(const LocalCartesian& lc);
+    ///@}
+
+    /** \name Running the pipeline.
+     **********************************************************************/
+    ///@{
+    /**
+     * Apply the pipeline to arrays of points using several threads.
+     *
+     * @param[in] exec the Executor used to split the work between threads.
+     * @param[in] num the number of points.
+     * @param[in] in0 array of the first input coordinates.
+     * @param[in] in1 array of the second input coordinates.
+     * @param[in] in2 array of the third input coordinates; this may be null
+     *   in which case 0 is used.
+     * @param[out] out0 array of the first output coordinates.
+     * @param[out] out1 array of the second output coordinates.
+     * @param[out] out2 array of the third output coordinates; this may be
+     *   null.
+     * @param[out] zone array of UTM zones for a pipeline ending with
+     *   Pipeline::ToUTMUPS; this may be null.
+     * @param[out] northp array of hemispheres for a pipeline ending with
+     *   Pipeline::ToUTMUPS; this may be null.
+     * @exception GeographicErr if any of the steps throws an exception.
+     *
+     * The meanings of the coordinates are given by Input() and Output().
+     * The output arrays may be the same as the input arrays.
+     **********************************************************************/
+    void Run(const Executor& exec, size_t num,
+             const real in0[], const real in1[], const real in2[],
+             real out0[], real out1[], real out2[],
+             int zone[] = nullptr, bool northp[] = nullptr) const;
+
+    /**
+     * Pipeline::Run without an Executor.
+     **********************************************************************/
+    void Run(size_t num,
+             const real in0[], const real in1[], const real in2[],
+             real out0[], real out1[], real out2[],
+             int zone[] = nullptr, bool northp[] = nullptr) const {
+      Run(Executor::Serial(), num, in0, in1, in2, out0, out1, out2,
+          zone, northp);
+    }
+    ///@}
+
+    /** \name Inspector functions
+     **********************************************************************/
+    ///@{
+    /**
+     * @return the kind of coordinates of the input.
+     **********************************************************************/
+    int Input() const { return _input; }
+
+    /**
+     * @return the kind of coordinates of the output.
+     **********************************************************************/
+    int Output() const { return _output; }
+
+    /**
+     * @return the number of steps in the pipeline.
+     **********************************************************************/
+    size_t NumSteps() const { return _steps.size(); }
+
+    /**
+     * @return true if the pipeline can be run by several threads
+     *   concurrently.
+     **********************************************************************/
+    bool ThreadSafe() const { return _threadsafe; }
+    ///@}
+  };
+
+} // namespace GeographicLib
+
+#if defined(_MSC_VER)
+#  pragma warning (pop)
+#endif
+
+#endif  // GEOGRAPHICLIB_PIPELINE_HPP
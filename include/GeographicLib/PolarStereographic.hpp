@@ -11,6 +11,7 @@
 #define GEOGRAPHICLIB_POLARSTEREOGRAPHIC_HPP 1
 
 #include <GeographicLib/Constants.hpp>
+#include <GeographicLib/Executor.hpp>
 
 namespace GeographicLib {
 
@@ -118,6 +119,101 @@ namespace GeographicLib {
       Reverse(northp, x, y, lat, lon, gamma, k);
     }
 
+    /**
+     * Forward projection of an array of points.
+     *
+     * @param[in] num the number of points.
+     * @param[in] northp the pole which is the center of projection (true means
+     *   north, false means south).
+     * @param[in] lat array of latitudes of the points (degrees).
+     * @param[in] lon array of longitudes of the points (degrees).
+     * @param[out] x array of eastings (meters).
+     * @param[out] y array of northings (meters).
+     * @param[out] gamma (optional) array of meridian convergences (degrees).
+     * @param[out] k (optional) array of scales.
+     *
+     * The output arrays must have room for \e num elements.  \e gamma and
+     * \e k are only set if they are non-null.  The points are processed in
+     * blocks with the conformal latitudes for a block being computed by the
+     * array version of Math::taupf.  The results are identical to those of
+     * the scalar version.
+     **********************************************************************/
+    void Forward(size_t num, bool northp, const real lat[], const real lon[],
+                 real x[], real y[],
+                 real gamma[] = nullptr, real k[] = nullptr) const;
+
+    /**
+     * Reverse projection of an array of points.
+     *
+     * @param[in] num the number of points.
+     * @param[in] northp the pole which is the center of projection (true means
+     *   north, false means south).
+     * @param[in] x array of eastings of the points (meters).
+     * @param[in] y array of northings of the points (meters).
+     * @param[out] lat array of latitudes (degrees).
+     * @param[out] lon array of longitudes (degrees).
+     * @param[out] gamma (optional) array of meridian convergences (degrees).
+     * @param[out] k (optional) array of scales.
+     *
+     * The output arrays must have room for \e num elements.  \e gamma and
+     * \e k are only set if they are non-null.  The geographic latitudes for a
+     * block of points are computed by the array version of Math::tauf.  The
+     * results are identical to those of the scalar version.
+     **********************************************************************/
+    void Reverse(size_t num, bool northp, const real x[], const real y[],
+                 real lat[], real lon[],
+                 real gamma[] = nullptr, real k[] = nullptr) const;
+
+    /**
+     * Forward projection of an array of points in parallel.
+     *
+     * @param[in] exec the Executor used to split the work between threads.
+     * @param[in] num the number of points.
+     * @param[in] northp the pole which is the center of projection (true means
+     *   north, false means south).
+     * @param[in] lat array of latitudes of the points (degrees).
+     * @param[in] lon array of longitudes of the points (degrees).
+     * @param[out] x array of eastings (meters).
+     * @param[out] y array of northings (meters).
+     * @param[out] gamma (optional) array of meridian convergences (degrees).
+     * @param[out] k (optional) array of scales.
+     **********************************************************************/
+    void Forward(const Executor& exec,
+                 size_t num, bool northp, const real lat[], const real lon[],
+                 real x[], real y[],
+                 real gamma[] = nullptr, real k[] = nullptr) const {
+      exec.For(num, [this, northp, lat, lon, x, y, gamma, k]
+                    (size_t i0, size_t i1) -> void {
+        Forward(i1 - i0, northp, lat + i0, lon + i0, x + i0, y + i0,
+                gamma ? gamma + i0 : nullptr, k ? k + i0 : nullptr);
+      });
+    }
+
+    /**
+     * Reverse projection of an array of points in parallel.
+     *
+     * @param[in] exec the Executor used to split the work between threads.
+     * @param[in] num the number of points.
+     * @param[in] northp the pole which is the center of projection (true means
+     *   north, false means south).
+     * @param[in] x array of eastings of the points (meters).
+     * @param[in] y array of northings of the points (meters).
+     * @param[out] lat array of latitudes (degrees).
+     * @param[out] lon array of longitudes (degrees).
+     * @param[out] gamma (optional) array of meridian convergences (degrees).
+     * @param[out] k (optional) array of scales.
+     **********************************************************************/
+    void Reverse(const Executor& exec,
+                 size_t num, bool northp, const real x[], const real y[],
+                 real lat[], real lon[],
+                 real gamma[] = nullptr, real k[] = nullptr) const {
+      exec.For(num, [this, northp, x, y, lat, lon, gamma, k]
+                    (size_t i0, size_t i1) -> void {
+        Reverse(i1 - i0, northp, x + i0, y + i0, lat + i0, lon + i0,
+                gamma ? gamma + i0 : nullptr, k ? k + i0 : nullptr);
+      });
+    }
+
     /** \name Inspector functions
      **********************************************************************/
     ///@{
@@ -14,6 +14,7 @@
 #include <GeographicLib/GeodesicExact.hpp>
 #include <GeographicLib/Rhumb.hpp>
 #include <GeographicLib/Accumulator.hpp>
+#include <GeographicLib/Executor.hpp>
 
 namespace GeographicLib {
 
@@ -116,6 +117,10 @@ namespace GeographicLib {
     }
     template<typename T>
     void AreaReduce(T& area, int crossings, bool reverse, bool sign) const;
+    // Accumulate the edges from point i to point i + 1 for i in [0, num)
+    void AddEdges(size_t num, const real lat[], const real lon[],
+                  Accumulator<>& perimeter, Accumulator<>& area,
+                  int& crossings) const;
   public:
 
     /**
@@ -155,6 +160,37 @@ namespace GeographicLib {
      **********************************************************************/
     void AddPoint(real lat, real lon);
 
+    /**
+     * Add an array of points to the polygon or polyline.
+     *
+     * @param[in] num the number of points.
+     * @param[in] lat array of latitudes of the points (degrees).
+     * @param[in] lon array of longitudes of the points (degrees).
+     *
+     * This is equivalent to calling PolygonAreaT::AddPoint for each point.
+     * For PolygonAreaRhumb, the edges are computed in blocks using the array
+     * version of Rhumb::GenInverse.
+     **********************************************************************/
+    void AddPoints(size_t num, const real lat[], const real lon[]);
+
+    /**
+     * Add an array of points to the polygon or polyline computing the edges in
+     * parallel.
+     *
+     * @param[in] exec the Executor used to split the work between threads.
+     * @param[in] num the number of points.
+     * @param[in] lat array of latitudes of the points (degrees).
+     * @param[in] lon array of longitudes of the points (degrees).
+     *
+     * The perimeter and area for each chunk of edges are accumulated
+     * separately and the partial sums are then combined, in order, into the
+     * running totals.  Because the sums are accumulated with Accumulator,
+     * the results agree with those of the serial version to roundoff in the
+     * final result.
+     **********************************************************************/
+    void AddPoints(const Executor& exec,
+                   size_t num, const real lat[], const real lon[]);
+
     /**
      * Add an edge to the polygon or polyline.
      *
@@ -12,6 +12,7 @@
 
 #include <GeographicLib/Constants.hpp>
 #include <GeographicLib/DAuxLatitude.hpp>
+#include <GeographicLib/Executor.hpp>
 #include <vector>
 
 #if !defined(GEOGRAPHICLIB_RHUMBAREA_ORDER)
@@ -96,6 +97,11 @@ namespace GeographicLib {
     };
 
     real MeanSinXi(const AuxAngle& chix, const AuxAngle& chiy) const;
+    // MeanSinXi for at most blk_ pairs of conformal latitudes given by the
+    // components of AuxAngles.
+    static const size_t blk_ = 64;
+    void MeanSinXi(size_t num, const real cy1[], const real cx1[],
+                   const real cy2[], const real cx2[], real msx[]) const;
 
     // The following two functions (with lots of ignored arguments) mimic the
     // interface to the corresponding Geodesic function.  These are needed by
@@ -303,6 +309,63 @@ namespace GeographicLib {
                     unsigned outmask,
                     real& s12, real& azi12, real& S12) const;
 
+    /**
+     * The general inverse rhumb problem for arrays of points.
+     *
+     * @param[in] num the number of pairs of points.
+     * @param[in] lat1 array of latitudes of point 1 (degrees).
+     * @param[in] lon1 array of longitudes of point 1 (degrees).
+     * @param[in] lat2 array of latitudes of point 2 (degrees).
+     * @param[in] lon2 array of longitudes of point 2 (degrees).
+     * @param[in] outmask a bitor'ed combination of Rhumb::mask values
+     *   specifying which of the following arrays should be set.
+     * @param[out] s12 array of rhumb distances (meters).
+     * @param[out] azi12 array of azimuths of the rhumb lines (degrees).
+     * @param[out] S12 array of areas under the rhumb lines
+     *   (meters<sup>2</sup>).
+     *
+     * The output arrays which are set must have room for \e num elements;
+     * the others may be null.  The pairs are processed in blocks and the
+     * Fourier series for the area is summed for all the lines in a block
+     * together using the array version of DAuxLatitude::DClenshaw.  The
+     * results are identical to those of the scalar version.
+     *
+     * The input arrays may overlap; e.g., for the edges of a polyline stored
+     * in arrays \e lat and \e lon, pass \e lat, \e lon, \e lat + 1, and \e
+     * lon + 1.
+     **********************************************************************/
+    void GenInverse(size_t num, const real lat1[], const real lon1[],
+                    const real lat2[], const real lon2[], unsigned outmask,
+                    real s12[], real azi12[], real S12[]) const;
+
+    /**
+     * The general inverse rhumb problem for arrays of points in parallel.
+     *
+     * @param[in] exec the Executor used to split the work between threads.
+     * @param[in] num the number of pairs of points.
+     * @param[in] lat1 array of latitudes of point 1 (degrees).
+     * @param[in] lon1 array of longitudes of point 1 (degrees).
+     * @param[in] lat2 array of latitudes of point 2 (degrees).
+     * @param[in] lon2 array of longitudes of point 2 (degrees).
+     * @param[in] outmask a bitor'ed combination of Rhumb::mask values
+     *   specifying which of the following arrays should be set.
+     * @param[out] s12 array of rhumb distances (meters).
+     * @param[out] azi12 array of azimuths of the rhumb lines (degrees).
+     * @param[out] S12 array of areas under the rhumb lines
+     *   (meters<sup>2</sup>).
+     **********************************************************************/
+    void GenInverse(const Executor& exec,
+                    size_t num, const real lat1[], const real lon1[],
+                    const real lat2[], const real lon2[], unsigned outmask,
+                    real s12[], real azi12[], real S12[]) const {
+      exec.For(num, [this, lat1, lon1, lat2, lon2, outmask, s12, azi12, S12]
+                    (size_t i0, size_t i1) -> void {
+        GenInverse(i1 - i0, lat1 + i0, lon1 + i0, lat2 + i0, lon2 + i0,
+                   outmask, s12 ? s12 + i0 : nullptr,
+                   azi12 ? azi12 + i0 : nullptr, S12 ? S12 + i0 : nullptr);
+      });
+    }
+
     /**
      * Typedef for the class for computing multiple points on a rhumb line.
      **********************************************************************/
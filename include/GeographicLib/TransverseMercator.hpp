@@ -2,7 +2,7 @@
  * \file TransverseMercator.hpp
  * \brief Header for GeographicLib::TransverseMercator class
  *
- * Copyright (c) Charles Karney (2008-2023) <karney@alum.mit.edu> and licensed
+ * Copyright (c) Charles Karney (2008-2026) <karney@alum.mit.edu> and licensed
  * under the MIT/X11 License.  For more information, see
  * https://geographiclib.sourceforge.io/
  **********************************************************************/
@@ -12,6 +12,7 @@
 
 #include <GeographicLib/Constants.hpp>
 #include <GeographicLib/TransverseMercatorExact.hpp>
+#include <GeographicLib/Executor.hpp>
 
 #if !defined(GEOGRAPHICLIB_TRANSVERSEMERCATOR_ORDER)
 /**
@@ -102,6 +103,25 @@ namespace GeographicLib {
     // _alp[0] and _bet[0] unused
     real _a1, _b1, _alp[maxpow_ + 1], _bet[maxpow_ + 1];
     TransverseMercatorExact _tmexact;
+    // The scalar and array versions of Forward and Reverse are split into
+    // these pieces so that the array versions can evaluate sincosd, taupf,
+    // and tauf for blocks of points.  Reduce reduces lat and lon to the
+    // first quadrant; ForwardSeries converts the conformal latitude to x
+    // and y; ReverseSeries converts x and y to xi' and eta'; and
+    // ReverseFinish completes the conversion given tau = tan(phi).
+    static void Reduce(real lon0, real& lat, real& lon,
+                       int& latsign, int& lonsign, bool& backside);
+    void ForwardSeries(real lat, real lon, real cphi, real slam, real clam,
+                       real tau, real taup, int latsign, int lonsign,
+                       bool backside,
+                       real& x, real& y, real& gamma, real& k) const;
+    void ReverseSeries(real x, real y, int& xisign, int& etasign,
+                       bool& backside, real& xip, real& etap,
+                       real& gamma, real& k) const;
+    void ReverseFinish(real lon0, real etap, real s, real c, real r,
+                       real sxip, real tau, int xisign, int etasign,
+                       bool backside,
+                       real& lat, real& lon, real& gamma, real& k) const;
   public:
 
     /**
@@ -177,6 +197,101 @@ namespace GeographicLib {
       Reverse(lon0, x, y, lat, lon, gamma, k);
     }
 
+    /**
+     * Forward projection of an array of points.
+     *
+     * @param[in] num the number of points.
+     * @param[in] lon0 central meridian of the projection (degrees).
+     * @param[in] lat array of latitudes of the points (degrees).
+     * @param[in] lon array of longitudes of the points (degrees).
+     * @param[out] x array of eastings (meters).
+     * @param[out] y array of northings (meters).
+     * @param[out] gamma (optional) array of meridian convergences (degrees).
+     * @param[out] k (optional) array of scales.
+     *
+     * The output arrays must have room for \e num elements.  \e gamma and
+     * \e k are only set if they are non-null.  The points are processed in
+     * blocks with the trigonometric functions and the conformal latitudes for
+     * a block being computed by the array versions of Math::sincosd and
+     * Math::taupf.  The results are identical to those of the scalar version.
+     * If \e exact = true, the scalar TransverseMercatorExact::Forward is
+     * called for each point.
+     **********************************************************************/
+    void Forward(size_t num, real lon0, const real lat[], const real lon[],
+                 real x[], real y[],
+                 real gamma[] = nullptr, real k[] = nullptr) const;
+
+    /**
+     * Reverse projection of an array of points.
+     *
+     * @param[in] num the number of points.
+     * @param[in] lon0 central meridian of the projection (degrees).
+     * @param[in] x array of eastings of the points (meters).
+     * @param[in] y array of northings of the points (meters).
+     * @param[out] lat array of latitudes (degrees).
+     * @param[out] lon array of longitudes (degrees).
+     * @param[out] gamma (optional) array of meridian convergences (degrees).
+     * @param[out] k (optional) array of scales.
+     *
+     * The output arrays must have room for \e num elements.  \e gamma and
+     * \e k are only set if they are non-null.  \e lat and \e lon may be the
+     * same arrays as \e x and \e y.  The geographic latitudes for a block of
+     * points are computed by the array version of Math::tauf.  The results
+     * are identical to those of the scalar version.  If \e exact = true, the
+     * scalar TransverseMercatorExact::Reverse is called for each point.
+     **********************************************************************/
+    void Reverse(size_t num, real lon0, const real x[], const real y[],
+                 real lat[], real lon[],
+                 real gamma[] = nullptr, real k[] = nullptr) const;
+
+    /**
+     * Forward projection of an array of points in parallel.
+     *
+     * @param[in] exec the Executor used to split the work between threads.
+     * @param[in] num the number of points.
+     * @param[in] lon0 central meridian of the projection (degrees).
+     * @param[in] lat array of latitudes of the points (degrees).
+     * @param[in] lon array of longitudes of the points (degrees).
+     * @param[out] x array of eastings (meters).
+     * @param[out] y array of northings (meters).
+     * @param[out] gamma (optional) array of meridian convergences (degrees).
+     * @param[out] k (optional) array of scales.
+     **********************************************************************/
+    void Forward(const Executor& exec,
+                 size_t num, real lon0, const real lat[], const real lon[],
+                 real x[], real y[],
+                 real gamma[] = nullptr, real k[] = nullptr) const {
+      exec.For(num, [this, lon0, lat, lon, x, y, gamma, k]
+                    (size_t i0, size_t i1) -> void {
+        Forward(i1 - i0, lon0, lat + i0, lon + i0, x + i0, y + i0,
+                gamma ? gamma + i0 : nullptr, k ? k + i0 : nullptr);
+      });
+    }
+
+    /**
+     * Reverse projection of an array of points in parallel.
+     *
+     * @param[in] exec the Executor used to split the work between threads.
+     * @param[in] num the number of points.
+     * @param[in] lon0 central meridian of the projection (degrees).
+     * @param[in] x array of eastings of the points (meters).
+     * @param[in] y array of northings of the points (meters).
+     * @param[out] lat array of latitudes (degrees).
+     * @param[out] lon array of longitudes (degrees).
+     * @param[out] gamma (optional) array of meridian convergences (degrees).
+     * @param[out] k (optional) array of scales.
+     **********************************************************************/
+    void Reverse(const Executor& exec,
+                 size_t num, real lon0, const real x[], const real y[],
+                 real lat[], real lon[],
+                 real gamma[] = nullptr, real k[] = nullptr) const {
+      exec.For(num, [this, lon0, x, y, lat, lon, gamma, k]
+                    (size_t i0, size_t i1) -> void {
+        Reverse(i1 - i0, lon0, x + i0, y + i0, lat + i0, lon + i0,
+                gamma ? gamma + i0 : nullptr, k ? k + i0 : nullptr);
+      });
+    }
+
     /** \name Inspector functions
      **********************************************************************/
     ///@{
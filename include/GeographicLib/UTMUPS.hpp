@@ -2,7 +2,7 @@
  * \file UTMUPS.hpp
  * \brief Header for GeographicLib::UTMUPS class
  *
- * Copyright (c) Charles Karney (2008-2022) <karney@alum.mit.edu> and licensed
+ * Copyright (c) Charles Karney (2008-2026) <karney@alum.mit.edu> and licensed
  * under the MIT/X11 License.  For more information, see
  * https://geographiclib.sourceforge.io/
  **********************************************************************/
@@ -11,6 +11,7 @@
 #define GEOGRAPHICLIB_UTMUPS_HPP 1
 
 #include <GeographicLib/Constants.hpp>
+#include <GeographicLib/Executor.hpp>
 
 namespace GeographicLib {
 
@@ -282,6 +283,127 @@ namespace GeographicLib {
       Reverse(zone, northp, x, y, lat, lon, gamma, k, mgrslimits);
     }
 
+    /**
+     * Forward projection for an array of points.
+     *
+     * @param[in] num the number of points.
+     * @param[in] lat array of latitudes (degrees).
+     * @param[in] lon array of longitudes (degrees).
+     * @param[out] zone array of UTM zones (zero means UPS).
+     * @param[out] northp array of hemispheres (true means north, false means
+     *   south).
+     * @param[out] x array of eastings (meters).
+     * @param[out] y array of northings (meters).
+     * @param[out] gamma array of meridian convergences (degrees) (optional).
+     * @param[out] k array of scales (optional).
+     * @param[in] setzone zone override applied to all the points
+     *   (optional).
+     * @param[in] mgrslimits if true enforce the stricter MGRS limits on the
+     *   coordinates (default = false).
+     * @exception GeographicErr if any point can't be converted; see the
+     *   scalar version of UTMUPS::Forward.
+     *
+     * This is equivalent to calling the scalar version of UTMUPS::Forward for
+     * each point.  If an exception is thrown, the output arrays have been
+     * set for the preceding points.
+     **********************************************************************/
+    static void Forward(size_t num, const real lat[], const real lon[],
+                        int zone[], bool northp[], real x[], real y[],
+                        real gamma[] = nullptr, real k[] = nullptr,
+                        int setzone = STANDARD, bool mgrslimits = false);
+
+    /**
+     * Forward projection for an array of points using several threads.
+     *
+     * @param[in] exec the Executor used to split the work between threads.
+     * @param[in] num the number of points.
+     * @param[in] lat array of latitudes (degrees).
+     * @param[in] lon array of longitudes (degrees).
+     * @param[out] zone array of UTM zones (zero means UPS).
+     * @param[out] northp array of hemispheres (true means north, false means
+     *   south).
+     * @param[out] x array of eastings (meters).
+     * @param[out] y array of northings (meters).
+     * @param[out] gamma array of meridian convergences (degrees) (optional).
+     * @param[out] k array of scales (optional).
+     * @param[in] setzone zone override applied to all the points
+     *   (optional).
+     * @param[in] mgrslimits if true enforce the stricter MGRS limits on the
+     *   coordinates (default = false).
+     * @exception GeographicErr if any point can't be converted.
+     **********************************************************************/
+    static void Forward(const Executor& exec,
+                        size_t num, const real lat[], const real lon[],
+                        int zone[], bool northp[], real x[], real y[],
+                        real gamma[] = nullptr, real k[] = nullptr,
+                        int setzone = STANDARD, bool mgrslimits = false) {
+      exec.For(num, [=](size_t i0, size_t i1) -> void {
+        Forward(i1 - i0, lat + i0, lon + i0, zone + i0, northp + i0,
+                x + i0, y + i0,
+                gamma ? gamma + i0 : nullptr, k ? k + i0 : nullptr,
+                setzone, mgrslimits);
+      });
+    }
+
+    /**
+     * Reverse projection for an array of points.
+     *
+     * @param[in] num the number of points.
+     * @param[in] zone array of UTM zones (zero means UPS).
+     * @param[in] northp array of hemispheres (true means north, false means
+     *   south).
+     * @param[in] x array of eastings (meters).
+     * @param[in] y array of northings (meters).
+     * @param[out] lat array of latitudes (degrees).
+     * @param[out] lon array of longitudes (degrees).
+     * @param[out] gamma array of meridian convergences (degrees) (optional).
+     * @param[out] k array of scales (optional).
+     * @param[in] mgrslimits if true enforce the stricter MGRS limits on the
+     *   coordinates (default = false).
+     * @exception GeographicErr if any point can't be converted; see the
+     *   scalar version of UTMUPS::Reverse.
+     *
+     * This is equivalent to calling the scalar version of UTMUPS::Reverse for
+     * each point.
+     **********************************************************************/
+    static void Reverse(size_t num, const int zone[], const bool northp[],
+                        const real x[], const real y[],
+                        real lat[], real lon[],
+                        real gamma[] = nullptr, real k[] = nullptr,
+                        bool mgrslimits = false);
+
+    /**
+     * Reverse projection for an array of points using several threads.
+     *
+     * @param[in] exec the Executor used to split the work between threads.
+     * @param[in] num the number of points.
+     * @param[in] zone array of UTM zones (zero means UPS).
+     * @param[in] northp array of hemispheres (true means north, false means
+     *   south).
+     * @param[in] x array of eastings (meters).
+     * @param[in] y array of northings (meters).
+     * @param[out] lat array of latitudes (degrees).
+     * @param[out] lon array of longitudes (degrees).
+     * @param[out] gamma array of meridian convergences (degrees) (optional).
+     * @param[out] k array of scales (optional).
+     * @param[in] mgrslimits if true enforce the stricter MGRS limits on the
+     *   coordinates (default = false).
+     * @exception GeographicErr if any point can't be converted.
+     **********************************************************************/
+    static void Reverse(const Executor& exec,
+                        size_t num, const int zone[], const bool northp[],
+                        const real x[], const real y[],
+                        real lat[], real lon[],
+                        real gamma[] = nullptr, real k[] = nullptr,
+                        bool mgrslimits = false) {
+      exec.For(num, [=](size_t i0, size_t i1) -> void {
+        Reverse(i1 - i0, zone + i0, northp + i0, x + i0, y + i0,
+                lat + i0, lon + i0,
+                gamma ? gamma + i0 : nullptr, k ? k + i0 : nullptr,
+                mgrslimits);
+      });
+    }
+
     /**
      * Transfer UTM/UPS coordinated from one zone to another.
      *
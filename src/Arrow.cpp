@@ -0,0 +1,465 @@
+/**
+ * \file Arrow.cpp
+ * \brief Implementation for GeographicLib::Arrow class
+ *
+ * Copyright (c) Charles Karney (2026) <karney@alum.mit.edu> and licensed
+ * under the MIT/X11 License.  For more information, see
+ * https://geographiclib.sourceforge.io/
+ **********************************************************************/
+
+#include <GeographicLib/Arrow.hpp>
+#include <GeographicLib/Geodesic.hpp>
+#include <GeographicLib/Geoid.hpp>
+#include <GeographicLib/PolygonArea.hpp>
+#include <GeographicLib/UTMUPS.hpp>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace GeographicLib {
+
+  using namespace std;
+
+  namespace {
+
+    typedef Math::real real;
+
+    bool bit(const void* bits, int64_t i) {
+      return (static_cast<const uint8_t*>(bits)[i >> 3] >> (i & 7)) & 1;
+    }
+
+    // Check that a schema and array are present and haven't been released
+    void check(const ArrowSchema* schema, const ArrowArray* array,
+               const string& what) {
+      if (!(schema && schema->release && schema->format &&
+            array && array->release))
+        throw GeographicErr("Arrow: " + what + " is missing or released");
+      if (!(array->length >= 0 && array->offset >= 0 &&
+            array->null_count >= -1 &&
+            schema->n_children == array->n_children &&
+            (array->n_children == 0 ||
+             (schema->children && array->children))))
+        throw GeographicErr("Arrow: " + what + " is malformed");
+    }
+
+    // Read the fields of a struct array.  All the fields are located with
+    // field(...) before their data is fetched with reals(...), etc., so that
+    // the null rows are known.
+    class reader {
+    private:
+      const ArrowSchema* _s;
+      const ArrowArray* _a;
+      size_t _n;
+      // _ok[i] is false if row i is null; _nulls is the number of nulls
+      vector<char> _ok;
+      size_t _nulls;
+      void null(const ArrowArray* a, int64_t off) {
+        if (a->null_count == 0 || !a->buffers[0]) return;
+        for (size_t i = 0; i < _n; ++i)
+          if (_ok[i] && !bit(a->buffers[0], off + i)) {
+            _ok[i] = 0; ++_nulls;
+          }
+      }
+    public:
+      reader(const ArrowSchema* s, const ArrowArray* a)
+        : _s(s), _a(a), _n(0), _nulls(0)
+      {
+        check(_s, _a, "input");
+        if (strcmp(_s->format, "+s") != 0)
+          throw GeographicErr("Arrow: input is not a struct array");
+        if (_a->n_buffers != 1 || !_a->buffers)
+          throw GeographicErr("Arrow: input is malformed");
+        _n = size_t(_a->length);
+        _ok.assign(_n, 1);
+        null(_a, _a->offset);
+      }
+      size_t size() const { return _n; }
+      size_t nulls() const { return _nulls; }
+      const vector<char>& ok() const { return _ok; }
+      // Return the index of the field with the given name; formats is a list
+      // of allowed (single character) formats.
+      int64_t field(const char* name, const char* formats) {
+        for (int64_t k = 0; k < _s->n_children; ++k) {
+          const ArrowSchema* s = _s->children[k];
+          if (!(s && s->name && strcmp(s->name, name) == 0)) continue;
+          const ArrowArray* a = _a->children[k];
+          check(s, a, string("field ") + name);
+          if (!(strlen(s->format) == 1 && strchr(formats, s->format[0])))
+            throw GeographicErr(string("Arrow: field ") + name
+                                + " has format " + s->format);
+          if (!(a->n_buffers == 2 && a->buffers &&
+                a->length >= _a->offset + int64_t(_n) &&
+                (_n == 0 || a->buffers[1])))
+            throw GeographicErr(string("Arrow: field ") + name
+                                + " is malformed");
+          null(a, _a->offset + a->offset);
+          return k;
+        }
+        throw GeographicErr(string("Arrow: field ") + name + " not found");
+      }
+      // Return a pointer to the data for field k.  This points into the input
+      // if the format matches real and there are no nulls; otherwise the data
+      // is converted into buf with nulls set to NaN.  The data buffer may be
+      // null if the array is empty.
+      const real* reals(int64_t k, vector<real>& buf) const {
+        const ArrowArray* a = _a->children[k];
+        const void* p = a->buffers[1];
+        int64_t o = _a->offset + a->offset;
+        bool dbl = _s->children[k]->format[0] == 'g';
+        if (_n > 0 && _nulls == 0 &&
+            (dbl ? is_same<real, double>::value : is_same<real, float>::value))
+          return static_cast<const real*>(p) + o;
+        buf.resize(_n);
+        for (size_t i = 0; i < _n; ++i)
+          buf[i] = !_ok[i] ? Math::NaN() :
+            dbl ? real(static_cast<const double*>(p)[o + i]) :
+            real(static_cast<const float*>(p)[o + i]);
+        return buf.data();
+      }
+      // Likewise for an int32 field; nulls are set to nullval
+      const int* ints(int64_t k, vector<int>& buf, int nullval) const {
+        const ArrowArray* a = _a->children[k];
+        const int32_t* p = static_cast<const int32_t*>(a->buffers[1]);
+        int64_t o = _a->offset + a->offset;
+        if (_n > 0 && _nulls == 0 && is_same<int, int32_t>::value)
+          return reinterpret_cast<const int*>(p + o);
+        buf.resize(_n);
+        for (size_t i = 0; i < _n; ++i)
+          buf[i] = _ok[i] ? int(p[o + i]) : nullval;
+        return buf.data();
+      }
+      // Unpack a boolean field; nulls are set to false
+      const bool* bools(int64_t k, unique_ptr<bool[]>& buf) const {
+        const ArrowArray* a = _a->children[k];
+        int64_t o = _a->offset + a->offset;
+        buf.reset(new bool[_n]);
+        for (size_t i = 0; i < _n; ++i)
+          buf[i] = _ok[i] && bit(a->buffers[1], o + i);
+        return buf.get();
+      }
+    };
+
+    // The private data for the output arrays and schemas
+    struct arraydata {
+      vector<uint8_t> validity, bits;
+      vector<int32_t> ints;
+      vector<double> reals;
+      const void* buffers[2];
+      vector<ArrowArray> childarrays;
+      vector<ArrowArray*> children;
+    };
+
+    struct schemadata {
+      string format, name;
+      vector<ArrowSchema> childschemas;
+      vector<ArrowSchema*> children;
+    };
+
+    void releasearray(ArrowArray* array) {
+      arraydata* d = static_cast<arraydata*>(array->private_data);
+      // Children which have been moved by the consumer have release = nullptr
+      for (ArrowArray* child : d->children)
+        if (child->release) child->release(child);
+      delete d;
+      array->release = nullptr;
+    }
+
+    void releaseschema(ArrowSchema* schema) {
+      schemadata* d = static_cast<schemadata*>(schema->private_data);
+      for (ArrowSchema* child : d->children)
+        if (child->release) child->release(child);
+      delete d;
+      schema->release = nullptr;
+    }
+
+    void exportarray(unique_ptr<arraydata> d, int64_t length, int64_t nulls,
+                     ArrowArray* array) {
+      array->length = length;
+      array->null_count = nulls;
+      array->offset = 0;
+      array->n_buffers = d->children.empty() ? 2 : 1;
+      array->n_children = int64_t(d->children.size());
+      d->buffers[0] = nulls ? d->validity.data() : nullptr;
+      if (d->children.empty())
+        d->buffers[1] = !d->bits.empty() ? (const void*)d->bits.data() :
+          !d->ints.empty() ? (const void*)d->ints.data() :
+          (const void*)d->reals.data();
+      array->buffers = d->buffers;
+      array->children = d->children.empty() ? nullptr : d->children.data();
+      array->dictionary = nullptr;
+      array->release = releasearray;
+      array->private_data = d.release();
+    }
+
+    void exportschema(unique_ptr<schemadata> d, int64_t flags,
+                      ArrowSchema* schema) {
+      schema->format = d->format.c_str();
+      schema->name = d->name.c_str();
+      schema->metadata = nullptr;
+      schema->flags = flags;
+      schema->n_children = int64_t(d->children.size());
+      schema->children = d->children.empty() ? nullptr : d->children.data();
+      schema->dictionary = nullptr;
+      schema->release = releaseschema;
+      schema->private_data = d.release();
+    }
+
+    // Assemble a struct array.  The results are written directly into the
+    // buffers of the output where possible.  Nothing is exported until
+    // finish(...) is called so an exception in the computation doesn't leak.
+    class writer {
+    private:
+      struct column {
+        string name, format;
+        unique_ptr<arraydata> data;
+        vector<real> tmp;
+        vector<int> itmp;
+        unique_ptr<bool[]> btmp;
+      };
+      size_t _n, _nulls;
+      vector<uint8_t> _validity;
+      vector<column> _cols;
+      column& add(const char* name, const char* format) {
+        _cols.emplace_back();
+        column& c = _cols.back();
+        c.name = name; c.format = format;
+        c.data.reset(new arraydata);
+        return c;
+      }
+    public:
+      explicit writer(const reader& in)
+        : writer(in.size(), in.ok(), in.nulls()) {}
+      writer(size_t n, const vector<char>& ok, size_t nulls)
+        : _n(n), _nulls(nulls)
+      {
+        if (_nulls) {
+          _validity.assign((_n + 7) / 8, 0);
+          for (size_t i = 0; i < _n; ++i)
+            if (ok[i]) _validity[i >> 3] |= uint8_t(1 << (i & 7));
+        }
+      }
+      // Add a float64 field; return the array where it should be written
+      real* reals(const char* name) {
+        column& c = add(name, "g");
+        c.data->reals.resize(_n);
+        if (is_same<real, double>::value)
+          return reinterpret_cast<real*>(c.data->reals.data());
+        c.tmp.resize(_n);
+        return c.tmp.data();
+      }
+      // Add an int32 field
+      int* ints(const char* name) {
+        column& c = add(name, "i");
+        c.data->ints.resize(_n);
+        if (is_same<int, int32_t>::value)
+          return reinterpret_cast<int*>(c.data->ints.data());
+        c.itmp.resize(_n);
+        return c.itmp.data();
+      }
+      // Add a boolean field
+      bool* bools(const char* name) {
+        column& c = add(name, "b");
+        c.btmp.reset(new bool[_n]);
+        return c.btmp.get();
+      }
+      void finish(ArrowSchema* schema, ArrowArray* array) {
+        size_t m = _cols.size();
+        unique_ptr<arraydata> d(new arraydata);
+        unique_ptr<schemadata> s(new schemadata);
+        d->validity = _validity;
+        d->childarrays.resize(m);
+        s->format = "+s";
+        s->childschemas.resize(m);
+        for (size_t k = 0; k < m; ++k) {
+          column& c = _cols[k];
+          arraydata& a = *c.data;
+          if (!c.tmp.empty())
+            for (size_t i = 0; i < _n; ++i) a.reals[i] = double(c.tmp[i]);
+          if (!c.itmp.empty())
+            for (size_t i = 0; i < _n; ++i) a.ints[i] = int32_t(c.itmp[i]);
+          if (c.btmp) {
+            a.bits.assign((_n + 7) / 8 + 1, 0);
+            for (size_t i = 0; i < _n; ++i)
+              if (c.btmp[i]) a.bits[i >> 3] |= uint8_t(1 << (i & 7));
+          }
+          a.validity = _validity;
+          d->children.push_back(&d->childarrays[k]);
+          s->children.push_back(&s->childschemas[k]);
+        }
+        vector<unique_ptr<schemadata>> cs(m);
+        for (size_t k = 0; k < m; ++k) {
+          cs[k].reset(new schemadata);
+          cs[k]->format = _cols[k].format; cs[k]->name = _cols[k].name;
+        }
+        // No more allocations, so ownership can be handed over
+        for (size_t k = 0; k < m; ++k) {
+          exportarray(move(_cols[k].data), int64_t(_n), int64_t(_nulls),
+                      d->children[k]);
+          exportschema(move(cs[k]), ARROW_FLAG_NULLABLE, s->children[k]);
+        }
+        exportarray(move(d), int64_t(_n), int64_t(_nulls), array);
+        exportschema(move(s), 0, schema);
+      }
+    };
+
+  }
+
+  void Arrow::Direct(const Executor& exec, const Geodesic& g,
+                     const ArrowSchema* schema, const ArrowArray* array,
+                     ArrowSchema* outschema, ArrowArray* outarray) {
+    reader in(schema, array);
+    int64_t
+      klat1 = in.field("lat1", "gf"), klon1 = in.field("lon1", "gf"),
+      kazi1 = in.field("azi1", "gf"), ks12 = in.field("s12", "gf");
+    vector<real> blat1, blon1, bazi1, bs12;
+    const real
+      *lat1 = in.reals(klat1, blat1), *lon1 = in.reals(klon1, blon1),
+      *azi1 = in.reals(kazi1, bazi1), *s12 = in.reals(ks12, bs12);
+    writer out(in);
+    real
+      *lat2 = out.reals("lat2"), *lon2 = out.reals("lon2"),
+      *azi2 = out.reals("azi2");
+    g.Direct(exec, in.size(), lat1, lon1, azi1, s12, lat2, lon2, azi2);
+    out.finish(outschema, outarray);
+  }
+
+  void Arrow::Inverse(const Executor& exec, const Geodesic& g,
+                      const ArrowSchema* schema, const ArrowArray* array,
+                      ArrowSchema* outschema, ArrowArray* outarray) {
+    reader in(schema, array);
+    int64_t
+      klat1 = in.field("lat1", "gf"), klon1 = in.field("lon1", "gf"),
+      klat2 = in.field("lat2", "gf"), klon2 = in.field("lon2", "gf");
+    vector<real> blat1, blon1, blat2, blon2;
+    const real
+      *lat1 = in.reals(klat1, blat1), *lon1 = in.reals(klon1, blon1),
+      *lat2 = in.reals(klat2, blat2), *lon2 = in.reals(klon2, blon2);
+    writer out(in);
+    real
+      *s12 = out.reals("s12"), *azi1 = out.reals("azi1"),
+      *azi2 = out.reals("azi2");
+    g.Inverse(exec, in.size(), lat1, lon1, lat2, lon2, s12, azi1, azi2);
+    out.finish(outschema, outarray);
+  }
+
+  void Arrow::UTMUPSForward(const Executor& exec,
+                            const ArrowSchema* schema,
+                            const ArrowArray* array,
+                            ArrowSchema* outschema, ArrowArray* outarray,
+                            int setzone) {
+    reader in(schema, array);
+    int64_t klat = in.field("lat", "gf"), klon = in.field("lon", "gf");
+    vector<real> blat, blon;
+    const real *lat = in.reals(klat, blat), *lon = in.reals(klon, blon);
+    writer out(in);
+    int* zone = out.ints("zone");
+    bool* northp = out.bools("northp");
+    real
+      *x = out.reals("x"), *y = out.reals("y"),
+      *gamma = out.reals("gamma"), *k = out.reals("k");
+    UTMUPS::Forward(exec, in.size(), lat, lon, zone, northp, x, y, gamma, k,
+                    setzone);
+    out.finish(outschema, outarray);
+  }
+
+  void Arrow::UTMUPSReverse(const Executor& exec,
+                            const ArrowSchema* schema,
+                            const ArrowArray* array,
+                            ArrowSchema* outschema, ArrowArray* outarray) {
+    reader in(schema, array);
+    int64_t
+      kzone = in.field("zone", "i"), knorthp = in.field("northp", "b"),
+      kx = in.field("x", "gf"), ky = in.field("y", "gf");
+    vector<int> bzone;
+    unique_ptr<bool[]> bnorthp;
+    vector<real> bx, by;
+    // Null rows are given an invalid zone so that they yield NaNs
+    const int* zone = in.ints(kzone, bzone, UTMUPS::INVALID);
+    const bool* northp = in.bools(knorthp, bnorthp);
+    const real *x = in.reals(kx, bx), *y = in.reals(ky, by);
+    writer out(in);
+    real
+      *lat = out.reals("lat"), *lon = out.reals("lon"),
+      *gamma = out.reals("gamma"), *k = out.reals("k");
+    UTMUPS::Reverse(exec, in.size(), zone, northp, x, y, lat, lon, gamma, k);
+    out.finish(outschema, outarray);
+  }
+
+  void Arrow::GeoidHeight(const Executor& exec, const Geoid& geoid,
+                          const ArrowSchema* schema, const ArrowArray* array,
+                          ArrowSchema* outschema, ArrowArray* outarray) {
+    reader in(schema, array);
+    int64_t klat = in.field("lat", "gf"), klon = in.field("lon", "gf");
+    vector<real> blat, blon;
+    const real *lat = in.reals(klat, blat), *lon = in.reals(klon, blon);
+    writer out(in);
+    real* h = out.reals("h");
+    geoid(exec, in.size(), lat, lon, h);
+    out.finish(outschema, outarray);
+  }
+
+  void Arrow::PolygonAreas(const Executor& exec, const Geodesic& g,
+                           bool polyline,
+                           const ArrowSchema* schema,
+                           const ArrowArray* array,
+                           ArrowSchema* outschema, ArrowArray* outarray) {
+    check(schema, array, "input");
+    bool large = strcmp(schema->format, "+L") == 0;
+    if (!(large || strcmp(schema->format, "+l") == 0))
+      throw GeographicErr("Arrow: input is not a list array");
+    if (!(array->n_buffers == 2 && array->buffers && array->n_children == 1 &&
+          (array->length == 0 || array->buffers[1])))
+      throw GeographicErr("Arrow: input is malformed");
+    // The vertices
+    reader in(schema->children[0], array->children[0]);
+    int64_t klat = in.field("lat", "gf"), klon = in.field("lon", "gf");
+    vector<real> blat, blon;
+    const real *lat = in.reals(klat, blat), *lon = in.reals(klon, blon);
+    // The polygons are given by the offsets into the vertices.  The offsets
+    // buffer may be null for an empty list array.
+    size_t n = size_t(array->length), nulls = 0;
+    vector<size_t> start(n + 1, 0);
+    vector<char> ok(n, 1);
+    for (size_t i = 0; n > 0 && i <= n; ++i) {
+      int64_t j = array->offset + int64_t(i),
+        o = large ? static_cast<const int64_t*>(array->buffers[1])[j] :
+        static_cast<const int32_t*>(array->buffers[1])[j];
+      if (!(o >= 0 && size_t(o) <= in.size() &&
+            (i == 0 || size_t(o) >= start[i - 1])))
+        throw GeographicErr("Arrow: input has invalid offsets");
+      start[i] = size_t(o);
+    }
+    for (size_t i = 0; i < n; ++i) {
+      // A polygon is null if the list entry or any of its vertices is null
+      bool valid = !(array->null_count != 0 && array->buffers[0] &&
+                     !bit(array->buffers[0], array->offset + i));
+      if (valid && in.nulls())
+        for (size_t j = start[i]; j < start[i + 1]; ++j)
+          if (!in.ok()[j]) { valid = false; break; }
+      if (!valid) { ok[i] = 0; ++nulls; }
+    }
+    writer out(n, ok, nulls);
+    int* num = out.ints("num");
+    real *perimeter = out.reals("perimeter"), *area = out.reals("area");
+    const char* okp = ok.data();
+    const size_t* startp = start.data();
+    exec.For(n, [=, &g](size_t i0, size_t i1) -> void {
+      PolygonArea poly(g, polyline);
+      for (size_t i = i0; i < i1; ++i) {
+        area[i] = Math::NaN();
+        if (!okp[i]) {
+          num[i] = 0; perimeter[i] = Math::NaN();
+          continue;
+        }
+        poly.Clear();
+        poly.AddPoints(startp[i + 1] - startp[i],
+                       lat + startp[i], lon + startp[i]);
+        num[i] = int(poly.Compute(false, true, perimeter[i], area[i]));
+      }
+    });
+    out.finish(outschema, outarray);
+  }
+
+} // namespace GeographicLib
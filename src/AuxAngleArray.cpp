@@ -0,0 +1,108 @@
+/**
+ * \file AuxAngleArray.cpp
+ * \brief Implementation for the GeographicLib::AuxAngleArray class.
+ *
+ * Copyright (c) Charles Karney (2026) <karney@alum.mit.edu> and licensed
+ * under the MIT/X11 License.  For more information, see
+ * https://geographiclib.sourceforge.io/
+ **********************************************************************/
+
+#include <GeographicLib/AuxAngleArray.hpp>
+
+namespace GeographicLib {
+
+  using namespace std;
+
+  void AuxAngleArray::check(const AuxAngleArray& p) const {
+    if (p.size() != size())
+      throw GeographicErr("AuxAngleArray sizes differ");
+  }
+
+  void AuxAngleArray::normalize(size_t num, const real y[], const real x[],
+                                real yn[], real xn[]) {
+    // The same as AuxAngle::normalized with the tests for special cases
+    // turned into selections.
+    using std::isnan;           // Needed for Centos 7, ubuntu 14
+    const real big = numeric_limits<real>::max()/2,
+      nan = numeric_limits<real>::quiet_NaN();
+    for (size_t i = 0; i < num; ++i) {
+      real y0 = y[i], x0 = x[i],
+        r = hypot(y0, x0), y1 = y0/r, x1 = x0/r;
+      bool bad = isnan(y0/x0) || (fabs(y0) > big && fabs(x0) > big);
+      // deal with r = inf, then one of y,x becomes 1
+      if (isnan(y1)) y1 = copysign(real(1), y0);
+      if (isnan(x1)) x1 = copysign(real(1), x0);
+      yn[i] = bad ? nan : y1;
+      xn[i] = bad ? nan : x1;
+    }
+  }
+
+  AuxAngleArray AuxAngleArray::normalized() const {
+    AuxAngleArray p(size());
+    normalize(size(), y(), x(), p.y(), p.x());
+    return p;
+  }
+
+  AuxAngleArray AuxAngleArray::copyquadrant(const AuxAngleArray& p) const {
+    check(p);
+    AuxAngleArray q(size());
+    for (size_t i = 0; i < size(); ++i) {
+      q._y[i] = copysign(_y[i], p._y[i]);
+      q._x[i] = copysign(_x[i], p._x[i]);
+    }
+    return q;
+  }
+
+  AuxAngleArray& AuxAngleArray::operator+=(const AuxAngleArray& p) {
+    check(p);
+    for (size_t i = 0; i < size(); ++i) {
+      // Do nothing if p.tan() == 0 to preserve signs of y() and x()
+      real py = p._y[i], px = p._x[i], t = py / px,
+        x = _x[i] * px - _y[i] * py,
+        y = _y[i] * px + _x[i] * py;
+      if (t != 0) { _y[i] = y; _x[i] = x; }
+    }
+    return *this;
+  }
+
+  void AuxAngleArray::degrees(real d[]) const {
+    Math::atan2d(size(), y(), x(), d);
+  }
+
+  void AuxAngleArray::radians(real r[]) const {
+    for (size_t i = 0; i < size(); ++i)
+      r[i] = atan2(_y[i], _x[i]);
+  }
+
+  void AuxAngleArray::lam(real psi[]) const {
+    for (size_t i = 0; i < size(); ++i)
+      psi[i] = asinh(_y[i] / _x[i]);
+  }
+
+  void AuxAngleArray::tan(real t[]) const {
+    for (size_t i = 0; i < size(); ++i)
+      t[i] = _y[i] / _x[i];
+  }
+
+  AuxAngleArray AuxAngleArray::degrees(size_t num, const real d[]) {
+    AuxAngleArray p(num);
+    Math::sincosd(num, d, p.y(), p.x());
+    return p;
+  }
+
+  AuxAngleArray AuxAngleArray::radians(size_t num, const real r[]) {
+    AuxAngleArray p(num);
+    for (size_t i = 0; i < num; ++i) {
+      p._y[i] = sin(r[i]); p._x[i] = cos(r[i]);
+    }
+    return p;
+  }
+
+  AuxAngleArray AuxAngleArray::lam(size_t num, const real psi[]) {
+    AuxAngleArray p(num);
+    for (size_t i = 0; i < num; ++i)
+      p._y[i] = sinh(psi[i]);
+    return p;
+  }
+
+} // namespace GeographicLib
@@ -329,6 +329,52 @@ namespace GeographicLib {
     return Math::td * m + Convert(auxin, auxout, zetaa, exact).degrees();
   }
 
+  void AuxLatitude::Convert(int auxin, int auxout, const AuxAngleArray& zeta,
+                            AuxAngleArray& eta, bool exact) const {
+    size_t num = zeta.size();
+    eta.resize(num);
+    Convert(num, auxin, auxout, zeta.y(), zeta.x(), eta.y(), eta.x(), exact);
+  }
+
+  void AuxLatitude::Convert(size_t num, int auxin, int auxout,
+                            const real zetay[], const real zetax[],
+                            real etay[], real etax[], bool exact) const {
+    // The same as the scalar version applied to each element
+    using std::isnan;           // Needed for Centos 7, ubuntu 14
+    int k = ind(auxout, auxin);
+    if (exact && auxin < 3 && auxout < 3 && k >= 0) {
+      real m = real(pow(_fm1, auxout - auxin));
+      for (size_t i = 0; i < num; ++i) {
+        etay[i] = zetay[i] * m; etax[i] = zetax[i];
+      }
+    } else if (exact || k < 0 || auxin == auxout) {
+      for (size_t i = 0; i < num; ++i) {
+        AuxAngle eta(Convert(auxin, auxout, AuxAngle(zetay[i], zetax[i]),
+                             exact));
+        etay[i] = eta.y(); etax[i] = eta.x();
+      }
+    } else {
+      if ( isnan(_c[Lmax * (k + 1) - 1]) ) fillcoeff(auxin, auxout, k);
+      const size_t blk = 32;
+      real d[blk];
+      for (size_t i0 = 0; i0 < num; i0 += blk) {
+        size_t n = min(blk, num - i0);
+        real *y = etay + i0, *x = etax + i0;
+        AuxAngleArray::normalize(n, zetay + i0, zetax + i0, y, x);
+        Clenshaw(n, true, y, x, _c + Lmax * k, Lmax, d);
+        for (size_t j = 0; j < n; ++j) {
+          // zetan += AuxAngle::radians(d)
+          real sd = sin(d[j]), cd = cos(d[j]);
+          if (sd / cd != 0) {
+            real xj = x[j] * cd - y[j] * sd;
+            y[j] = y[j] * cd + x[j] * sd;
+            x[j] = xj;
+          }
+        }
+      }
+    }
+  }
+
   Math::real AuxLatitude::RectifyingRadius(bool exact) const {
     if (exact) {
       return EllipticFunction::RG(Math::sq(_a), Math::sq(_b)) * 4 / Math::pi();
@@ -1342,6 +1388,35 @@ namespace GeographicLib {
     real f0 = sinp ? 2 * szeta * czeta : x / 2, fm1 = sinp ? 0 : 1;
     return f0 * u0 - fm1 * u1;
   }
+
+  void AuxLatitude::Clenshaw(size_t num, bool sinp,
+                             const real szeta[], const real czeta[],
+                             const real c[], int K, real F[]) {
+    // The same as the scalar version with the sums for a block of angles
+    // carried out together.
+    const size_t blk = 32;
+    real u0[blk], u1[blk], x[blk];
+    for (size_t i0 = 0; i0 < num; i0 += blk) {
+      size_t n = min(blk, num - i0);
+      const real *s = szeta + i0, *co = czeta + i0;
+      for (size_t j = 0; j < n; ++j) {
+        u0[j] = u1[j] = 0;
+        x[j] = 2 * (co[j] - s[j]) * (co[j] + s[j]); // 2 * cos(2*zeta)
+      }
+      for (int k = K; k > 0;) {
+        real ck = c[--k];
+        for (size_t j = 0; j < n; ++j) {
+          real t = x[j] * u0[j] - u1[j] + ck;
+          u1[j] = u0[j]; u0[j] = t;
+        }
+      }
+      real fm1 = sinp ? 0 : 1;
+      for (size_t j = 0; j < n; ++j) {
+        real f0 = sinp ? 2 * s[j] * co[j] : x[j] / 2;
+        F[i0 + j] = f0 * u0[j] - fm1 * u1[j];
+      }
+    }
+  }
   /// \endcond
 
 } // namespace GeographicLib
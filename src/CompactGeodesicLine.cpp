@@ -0,0 +1,97 @@
+/**
+ * \file CompactGeodesicLine.cpp
+ * \brief Implementation for GeographicLib::CompactGeodesicLine class
+ *
+ * Copyright (c) Charles Karney (2026) <karney@alum.mit.edu> and licensed
+ * under the MIT/X11 License.  For more information, see
+ * https://geographiclib.sourceforge.io/
+ **********************************************************************/
+
+#include <GeographicLib/CompactGeodesicLine.hpp>
+
+namespace GeographicLib {
+
+  using namespace std;
+
+  CompactGeodesicLine::CompactGeodesicLine(const Geodesic& g,
+                                           real lat1, real lon1, real azi1,
+                                           unsigned caps)
+    : _g(&g)
+  {
+    // This duplicates the start of GeodesicLine::LineInit so that the
+    // results are identical.
+    _azi1 = Math::AngNormalize(azi1);
+    Math::sincosd(Math::AngRound(_azi1), _salp1, _calp1);
+    _lat1 = Math::LatFix(lat1);
+    _lon1 = lon1;
+    _caps = caps | GeodesicLine::LATITUDE | GeodesicLine::AZIMUTH |
+      GeodesicLine::LONG_UNROLL;
+    real cbet1, sbet1;
+    Math::sincosd(Math::AngRound(_lat1), sbet1, cbet1); sbet1 *= g._f1;
+    Math::norm(sbet1, cbet1); cbet1 = fmax(g.tiny_, cbet1);
+    _salp0 = _salp1 * cbet1;
+    _calp0 = hypot(_calp1, _salp1 * sbet1);
+  }
+
+  CompactGeodesicLine::CompactGeodesicLine(const Geodesic& g,
+                                           const GeodesicLine& line)
+    : _g(&g)
+    , _lat1(line._lat1)
+    , _lon1(line._lon1)
+    , _azi1(line._azi1)
+    , _salp1(line._salp1)
+    , _calp1(line._calp1)
+    , _salp0(line._salp0)
+    , _calp0(line._calp0)
+    , _caps(line._caps)
+  {
+    if (!line.Init())
+      throw GeographicErr("GeodesicLine is not initialized");
+    if (!(line._a == g._a && line._f == g._f && line._exact == g._exact))
+      throw GeographicErr("GeodesicLine was not constructed with this "
+                          "Geodesic object");
+  }
+
+  const GeodesicLine& CompactGeodesicLine::Cached() const {
+    static const int ncache = 8;
+    static thread_local GeodesicLine cache[ncache];
+    static thread_local int next = 0;
+    const Geodesic& g = *_g;
+    // Look for the line itself or for a line with the same coefficients
+    int k = -1;
+    for (int i = 0; i < ncache; ++i) {
+      const GeodesicLine& l = cache[i];
+      if (l._caps == _caps && l._salp0 == _salp0 && l._calp0 == _calp0 &&
+          l._a == g._a && l._f == g._f && l._exact == g._exact) {
+        if (l._lat1 == _lat1 && l._lon1 == _lon1 && l._azi1 == _azi1 &&
+            l._salp1 == _salp1 && l._calp1 == _calp1)
+          return l;
+        if (k < 0) k = i;
+      }
+    }
+    if (k >= 0 && !g._exact)
+      // Reuse the series coefficients
+      cache[k].LineInit(g, _lat1, _lon1, _azi1, _salp1, _calp1, _caps, false);
+    else {
+      if (k < 0) { k = next; next = (next + 1) % ncache; }
+      cache[k].LineInit(g, _lat1, _lon1, _azi1, _salp1, _calp1, _caps);
+    }
+    return cache[k];
+  }
+
+  Math::real CompactGeodesicLine::GenPosition(bool arcmode, real s12_a12,
+                                              unsigned outmask,
+                                              real& lat2, real& lon2,
+                                              real& azi2, real& s12,
+                                              real& m12, real& M12,
+                                              real& M21, real& S12) const {
+    if (!Init()) return Math::NaN();
+    return Cached().GenPosition(arcmode, s12_a12, outmask,
+                                lat2, lon2, azi2, s12, m12, M12, M21, S12);
+  }
+
+  GeodesicLine CompactGeodesicLine::Line() const {
+    return Init() ? Cached() : GeodesicLine();
+  }
+
+} // namespace GeographicLib
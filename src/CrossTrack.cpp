@@ -0,0 +1,320 @@
+/**
+ * \file CrossTrack.cpp
+ * \brief Implementation for GeographicLib::CrossTrack class
+ *
+ * Copyright (c) Charles Karney (2026) <karney@alum.mit.edu> and licensed under
+ * the MIT/X11 License.  For more information, see
+ * https://geographiclib.sourceforge.io/
+ **********************************************************************/
+
+#include <GeographicLib/CrossTrack.hpp>
+#include <limits>
+#include <algorithm>
+#include <queue>
+#include <utility>
+
+using namespace std;
+
+namespace GeographicLib {
+
+  CrossTrack::CrossTrack(const Geodesic& geod)
+    : _geod(geod)
+    , _earth(_geod.EquatorialRadius(), _geod.Flattening())
+    , _R(sqrt(_geod.EllipsoidArea() / (4 * Math::pi())))
+    , _tol(_R * Math::pi() * pow(numeric_limits<real>::epsilon(), 3/real(4)))
+  {}
+
+  Math::real CrossTrack::Distance(real latA, real lonA, real latB, real lonB,
+                                  real lat, real lon,
+                                  real& along, real& xtrack) const {
+    return segdist(_geod.InverseLine(latA, lonA, latB, lonB, LineCaps),
+                   latA, lonA, latB, lonB, lat, lon, along, xtrack);
+  }
+
+  Math::real CrossTrack::Distance(const GeodesicLine& line,
+                                  real lat, real lon,
+                                  real& along, real& xtrack) const {
+    real latB, lonB;
+    line.Position(line.Distance(), latB, lonB);
+    return segdist(line, line.Latitude(), line.Longitude(), latB, lonB,
+                   lat, lon, along, xtrack);
+  }
+
+  Math::real CrossTrack::segdist(const GeodesicLine& line,
+                                 real latA, real lonA, real latB, real lonB,
+                                 real lat, real lon,
+                                 real& along, real& xtrack) const {
+    const unsigned outmask = Geodesic::DISTANCE | Geodesic::AZIMUTH |
+      Geodesic::REDUCEDLENGTH | Geodesic::GEODESICSCALE;
+    real s13 = line.Distance(), s = s13/2, ds = 0, z = Math::NaN(), sa = 0;
+    for (int n = 0; n < numit_ || GEOGRAPHICLIB_PANIC; ++n) {
+      // X is the current estimate of the foot; solve the right triangle
+      // with hypotenuse XP and angle a at X.  On a sphere of radius R, ds =
+      // R * atan(tan(z/R) * cos(a)) where z = XP; m12 and M12 replace R *
+      // sin(z/R) and cos(z/R) on the ellipsoid.
+      real latX, lonX, aziX, aziP, azi2, m12, M12, M21, S12, ca;
+      line.Position(s, latX, lonX, aziX);
+      _geod.GenInverse(latX, lonX, lat, lon, outmask,
+                       z, aziP, azi2, m12, M12, M21, S12);
+      Math::sincosd(Math::AngDiff(aziX, aziP), sa, ca);
+      ds = _R * atan2(m12 * ca, _R * M12);
+      s += ds;
+      if (!(fabs(ds) > _tol)) break; // break if nan
+    }
+    along = s;
+    // z was computed at s - ds; correct for the final step.
+    xtrack = copysign(sqrt(fmax(real(0), (z - ds) * (z + ds))), sa);
+    if (s >= 0 && s <= s13)
+      return fabs(xtrack);
+    real dA, dB;
+    _geod.Inverse(latA, lonA, lat, lon, dA);
+    _geod.Inverse(latB, lonB, lat, lon, dB);
+    return fmin(dA, dB);
+  }
+
+  void CrossTrack::Reset(size_t num, const real latA[], const real lonA[],
+                         const real latB[], const real lonB[]) {
+    if (num > size_t(numeric_limits<int>::max()))
+      throw GeographicErr("Too many segments for CrossTrack");
+    _lines.clear(); _ends.clear(); _sph.clear(); _order.clear(); _tree.clear();
+    _lines.reserve(num); _ends.resize(4 * num); _sph.resize(4 * num);
+    _order.resize(num);
+    for (size_t i = 0; i < num; ++i) {
+      _lines.push_back(_geod.InverseLine(latA[i], lonA[i], latB[i], lonB[i],
+                                         LineCaps));
+      _ends[4*i    ] = latA[i]; _ends[4*i + 1] = lonA[i];
+      _ends[4*i + 2] = latB[i]; _ends[4*i + 3] = lonB[i];
+      // Each point of the segment is within a geodesic distance s13/2 of the
+      // midpoint and the chord distance is no greater than this.
+      real lat, lon, h = _lines[i].Distance() / 2;
+      _lines[i].Position(h, lat, lon);
+      _earth.Forward(lat, lon, 0, _sph[4*i], _sph[4*i + 1], _sph[4*i + 2]);
+      _sph[4*i + 3] = h;
+      _order[i] = int(i);
+    }
+    if (num) build(0, int(num));
+  }
+
+  int CrossTrack::build(int lo, int hi) {
+    int k = int(_tree.size());
+    _tree.push_back(Node());
+    real c[3] = {0, 0, 0}, cmin[3], cmax[3], r = 0;
+    for (int j = 0; j < 3; ++j) {
+      cmin[j] =  Math::infinity();
+      cmax[j] = -Math::infinity();
+    }
+    for (int i = lo; i < hi; ++i) {
+      const real* p = &_sph[4 * _order[i]];
+      for (int j = 0; j < 3; ++j) {
+        c[j] += p[j];
+        cmin[j] = fmin(cmin[j], p[j]);
+        cmax[j] = fmax(cmax[j], p[j]);
+      }
+    }
+    for (int j = 0; j < 3; ++j) c[j] /= (hi - lo);
+    for (int i = lo; i < hi; ++i) {
+      const real* p = &_sph[4 * _order[i]];
+      r = fmax(r, chord(c, p) + p[3]);
+    }
+    int skip = 0;
+    if (hi - lo > bucket_) {
+      // Split at the median along the axis with the largest extent
+      int axis = 0;
+      for (int j = 1; j < 3; ++j)
+        if (cmax[j] - cmin[j] > cmax[axis] - cmin[axis]) axis = j;
+      int mid = (lo + hi) / 2;
+      nth_element(_order.begin() + lo, _order.begin() + mid,
+                  _order.begin() + hi,
+                  [this, axis](int a, int b) -> bool
+                  { return _sph[4*a + axis] < _sph[4*b + axis]; });
+      build(lo, mid);
+      skip = build(mid, hi) - k;
+    }
+    // Fill in the node after the recursive calls (which may reallocate
+    // _tree).
+    Node& node = _tree[k];
+    for (int j = 0; j < 3; ++j) node.c[j] = c[j];
+    node.r = r; node.lo = lo; node.hi = hi; node.skip = skip;
+    return k;
+  }
+
+  int CrossTrack::Nearest(real lat, real lon,
+                          real& dist, real& along, real& xtrack) const {
+    dist = along = xtrack = Math::NaN();
+    if (_tree.empty() || !(fabs(lat) <= Math::qd && isfinite(lon)))
+      return -1;
+    real p[3];
+    _earth.Forward(lat, lon, 0, p[0], p[1], p[2]);
+    int best = -1;
+    real bestd = Math::infinity();
+    // The tree has depth at most 32, so at most 32 siblings are pending.
+    int stack[64], n = 0;
+    stack[n++] = 0;
+    while (n) {
+      int k = stack[--n];
+      const Node& node = _tree[k];
+      // The chord to the bounding sphere is a lower bound on the distance;
+      // prune only if this exceeds the best distance so that ties are
+      // resolved in favor of the smallest index.
+      if (chord(p, node.c) - node.r > bestd) continue;
+      if (node.skip) {
+        int a = k + 1, b = k + node.skip;
+        // Push the farther child first so that the nearer one is searched
+        // first.
+        if (chord(p, _tree[a].c) - _tree[a].r <
+            chord(p, _tree[b].c) - _tree[b].r)
+          swap(a, b);
+        stack[n++] = a; stack[n++] = b;
+        continue;
+      }
+      for (int i = node.lo; i < node.hi; ++i) {
+        int j = _order[i];
+        const real* s = &_sph[4 * j];
+        if (chord(p, s) - s[3] > bestd) continue;
+        const real* e = &_ends[4 * j];
+        real al, xt,
+          d = segdist(_lines[j], e[0], e[1], e[2], e[3], lat, lon, al, xt);
+        if (d < bestd || (d == bestd && j < best)) {
+          best = j; bestd = d; along = al; xtrack = xt;
+        }
+      }
+    }
+    if (best >= 0) dist = bestd;
+    return best;
+  }
+
+  void CrossTrack::Nearest(size_t num, const real lat[], const real lon[],
+                           int seg[], real dist[],
+                           real along[], real xtrack[]) const {
+    for (size_t i = 0; i < num; ++i) {
+      real al, xt;
+      seg[i] = Nearest(lat[i], lon[i], dist[i], al, xt);
+      if (along) along[i] = al;
+      if (xtrack) xtrack[i] = xt;
+    }
+  }
+
+  size_t CrossTrack::Simplify(const Executor& exec,
+                              size_t num, const real lat[], const real lon[],
+                              real tol, bool keep[]) const {
+    if (num == 0) return 0;
+    fill(keep, keep + num, false);
+    keep[0] = keep[num - 1] = true;
+    if (num <= 2) return num;
+    size_t kept = 2;
+    // The ranges [i0, i1] whose interior vertices are still to be tested;
+    // these are disjoint and in increasing order.
+    vector< pair<size_t, size_t> > ranges(1, make_pair(size_t(0), num - 1)),
+      next;
+    vector<GeodesicLine> lines;
+    // The interior vertices of the ranges, the ranges they belong to, and
+    // their distances from the segments.
+    vector<size_t> ind, own;
+    vector<real> d;
+    while (!ranges.empty()) {
+      size_t nr = ranges.size();
+      lines.resize(nr);
+      ind.clear(); own.clear();
+      for (size_t r = 0; r < nr; ++r)
+        for (size_t i = ranges[r].first + 1; i < ranges[r].second; ++i) {
+          ind.push_back(i); own.push_back(r);
+        }
+      d.resize(ind.size());
+      exec.For(nr, [&](size_t r0, size_t r1) -> void {
+        for (size_t r = r0; r < r1; ++r) {
+          size_t i0 = ranges[r].first, i1 = ranges[r].second;
+          lines[r] = _geod.InverseLine(lat[i0], lon[i0], lat[i1], lon[i1],
+                                       LineCaps);
+        }
+      });
+      exec.For(ind.size(), [&](size_t k0, size_t k1) -> void {
+        for (size_t k = k0; k < k1; ++k) {
+          size_t r = own[k], i = ind[k],
+            i0 = ranges[r].first, i1 = ranges[r].second;
+          real al, xt;
+          d[k] = segdist(lines[r], lat[i0], lon[i0], lat[i1], lon[i1],
+                         lat[i], lon[i], al, xt);
+        }
+      });
+      // Find the furthest vertex in each range (the first one in case of
+      // ties) and split the range there if it's beyond tol.
+      next.clear();
+      for (size_t k = 0; k < ind.size();) {
+        size_t r = own[k], imax = ind[k];
+        real dmax = d[k];
+        for (++k; k < ind.size() && own[k] == r; ++k)
+          if (d[k] > dmax) { dmax = d[k]; imax = ind[k]; }
+        if (!(dmax <= tol)) {   // split if nan
+          keep[imax] = true; ++kept;
+          if (imax - ranges[r].first > 1)
+            next.push_back(make_pair(ranges[r].first, imax));
+          if (ranges[r].second - imax > 1)
+            next.push_back(make_pair(imax, ranges[r].second));
+        }
+      }
+      swap(ranges, next);
+    }
+    return kept;
+  }
+
+  Math::real CrossTrack::triarea(const real lat[], const real lon[],
+                                 size_t i, size_t j, size_t k) const {
+    const size_t v[4] = {i, j, k, i};
+    real S = 0;
+    for (int n = 0; n < 3; ++n) {
+      real t, S12;
+      _geod.GenInverse(lat[v[n]], lon[v[n]], lat[v[n+1]], lon[v[n+1]],
+                       Geodesic::AREA, t, t, t, t, t, t, S12);
+      S += S12;
+    }
+    // The sum is the area of the triangle modulo the area of the ellipsoid.
+    S = fabs(remainder(S, _geod.EllipsoidArea()));
+    return isnan(S) ? Math::infinity() : S;
+  }
+
+  size_t CrossTrack::SimplifyArea(const Executor& exec,
+                                  size_t num,
+                                  const real lat[], const real lon[],
+                                  real area, bool keep[]) const {
+    fill(keep, keep + num, true);
+    if (num <= 2) return num;
+    size_t kept = num;
+    vector<real> a(num, Math::infinity());
+    exec.For(num - 2, [&](size_t i0, size_t i1) -> void {
+      for (size_t i = i0; i < i1; ++i)
+        a[i + 1] = triarea(lat, lon, i, i + 1, i + 2);
+    });
+    // The remaining vertices as a doubly linked list
+    vector<size_t> prev(num), next(num);
+    for (size_t i = 0; i < num; ++i) {
+      prev[i] = i - 1; next[i] = i + 1;
+    }
+    // A min-heap of (effective area, vertex); entries which are out of date
+    // are skipped when they're popped.
+    typedef pair<real, size_t> item;
+    priority_queue<item, vector<item>, greater<item> > q;
+    for (size_t i = 1; i < num - 1; ++i)
+      q.push(item(a[i], i));
+    while (!q.empty()) {
+      item t = q.top(); q.pop();
+      size_t i = t.second;
+      if (!keep[i] || t.first != a[i]) continue;
+      if (!(t.first < area)) break;
+      keep[i] = false; --kept;
+      size_t p = prev[i], n = next[i];
+      next[p] = n; prev[n] = p;
+      // The effective area of a neighbor isn't allowed to be less than that
+      // of the vertex just removed.
+      if (p > 0) {
+        a[p] = fmax(t.first, triarea(lat, lon, prev[p], p, n));
+        q.push(item(a[p], p));
+      }
+      if (n < num - 1) {
+        a[n] = fmax(t.first, triarea(lat, lon, p, n, next[n]));
+        q.push(item(a[n], n));
+      }
+    }
+    return kept;
+  }
+
+} // namespace GeographicLib
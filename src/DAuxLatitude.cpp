@@ -19,6 +19,7 @@
 
 #include <GeographicLib/DAuxLatitude.hpp>
 #include <GeographicLib/EllipticFunction.hpp>
+#include <algorithm>
 
 #if defined(_MSC_VER)
 // Squelch warnings about constant conditional expressions
@@ -270,4 +271,101 @@ namespace GeographicLib {
     return 2 * (F0a * u0b + F0b * u0a  - Fm1a * u1b);
   }
 
+  void DAuxLatitude::DClenshaw(size_t num, bool sinp, const real Delta[],
+                               const real szeta1[], const real czeta1[],
+                               const real szeta2[], const real czeta2[],
+                               const real c[], int K, real D[]) {
+    // The same algorithm as the scalar version with the recurrence carried
+    // out for a block of pairs together.
+    const size_t blk = 32;
+    real D2[blk], Xa[blk], Xb[blk], F0a[blk], F0b[blk],
+      u0a[blk], u0b[blk], u1a[blk], u1b[blk];
+    real Fm1a = sinp ? 0 : 1;
+    for (size_t i0 = 0; i0 < num; i0 += blk) {
+      size_t n = min(blk, num - i0);
+      for (size_t j = 0; j < n; ++j) {
+        real Dl = Delta[i0 + j],
+          sz1 = szeta1[i0 + j], cz1 = czeta1[i0 + j],
+          sz2 = szeta2[i0 + j], cz2 = czeta2[i0 + j],
+          czetap = cz2 * cz1 - sz2 * sz1,
+          szetap = sz2 * cz1 + cz2 * sz1,
+          czetam = cz2 * cz1 + sz2 * sz1,
+          szetamd = (Dl == 1 ? sz2 * cz1 - cz2 * sz1 :
+                     (Dl != 0 ? sin(Dl) / Dl : 1));
+        D2[j] = Dl * Dl;
+        Xa[j] =  2 * czetap * czetam;
+        Xb[j] = -2 * szetap * szetamd;
+        F0a[j] = (sinp ? szetap :  czetap) * czetam;
+        F0b[j] = (sinp ? czetap : -szetap) * szetamd;
+        u0a[j] = u0b[j] = u1a[j] = u1b[j] = 0;
+      }
+      for (int k = K - 1; k >= 0; --k) {
+        real ck = c[k];
+        for (size_t j = 0; j < n; ++j) {
+          real ta = Xa[j] * u0a[j] + D2[j] * Xb[j] * u0b[j] - u1a[j] + ck,
+            tb = Xb[j] * u0a[j] +        Xa[j] * u0b[j] - u1b[j];
+          u1a[j] = u0a[j]; u0a[j] = ta;
+          u1b[j] = u0b[j]; u0b[j] = tb;
+        }
+      }
+      for (size_t j = 0; j < n; ++j)
+        D[i0 + j] = 2 * (F0a[j] * u0b[j] + F0b[j] * u0a[j] - Fm1a * u1b[j]);
+    }
+  }
+
+  void DAuxLatitude::DConvert(size_t num, int auxin, int auxout,
+                              const real y1[], const real x1[],
+                              const real y2[], const real x2[],
+                              real D[]) const {
+    using std::isnan;           // Needed for Centos 7, ubuntu 14
+    int k = base::ind(auxout, auxin);
+    if (k < 0 || auxin == auxout) {
+      fill(D, D + num, k < 0 ? numeric_limits<real>::quiet_NaN() : real(1));
+      return;
+    }
+    if ( isnan(base::_c[base::Lmax * (k + 1) - 1]) )
+      base::fillcoeff(auxin, auxout, k);
+    const size_t blk = 32;
+    real Delta[blk], s1[blk], c1[blk], s2[blk], c2[blk], d[blk];
+    for (size_t i0 = 0; i0 < num; i0 += blk) {
+      size_t n = min(blk, num - i0);
+      for (size_t j = 0; j < n; ++j) {
+        AuxAngle
+          zeta1n(AuxAngle(y1[i0 + j], x1[i0 + j]).normalized()),
+          zeta2n(AuxAngle(y2[i0 + j], x2[i0 + j]).normalized());
+        Delta[j] = zeta2n.radians() - zeta1n.radians();
+        s1[j] = zeta1n.y(); c1[j] = zeta1n.x();
+        s2[j] = zeta2n.y(); c2[j] = zeta2n.x();
+      }
+      DClenshaw(n, true, Delta, s1, c1, s2, c2,
+                base::_c + base::Lmax * k, base::Lmax, d);
+      for (size_t j = 0; j < n; ++j)
+        D[i0 + j] = 1 + d[j];
+    }
+  }
+
+  void DAuxLatitude::DParametric(size_t num,
+                                 const real y1[], const real x1[],
+                                 const real y2[], const real x2[],
+                                 real D[]) const {
+    for (size_t i = 0; i < num; ++i)
+      D[i] = DParametric(AuxAngle(y1[i], x1[i]), AuxAngle(y2[i], x2[i]));
+  }
+
+  void DAuxLatitude::DRectifying(size_t num,
+                                 const real y1[], const real x1[],
+                                 const real y2[], const real x2[],
+                                 real D[]) const {
+    for (size_t i = 0; i < num; ++i)
+      D[i] = DRectifying(AuxAngle(y1[i], x1[i]), AuxAngle(y2[i], x2[i]));
+  }
+
+  void DAuxLatitude::DIsometric(size_t num,
+                                const real y1[], const real x1[],
+                                const real y2[], const real x2[],
+                                real D[]) const {
+    for (size_t i = 0; i < num; ++i)
+      D[i] = DIsometric(AuxAngle(y1[i], x1[i]), AuxAngle(y2[i], x2[i]));
+  }
+
 } // namespace GeographicLib
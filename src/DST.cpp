@@ -8,6 +8,7 @@
  **********************************************************************/
 
 #include <GeographicLib/DST.hpp>
+#include <algorithm>
 #include <vector>
 
 #include "kissfft.hh"
@@ -16,6 +17,32 @@ namespace GeographicLib {
 
   using namespace std;
 
+  namespace {
+    // Scratch space for the transforms.  Each thread keeps the buffer from its
+    // most recent transform so that, once it has grown to the size needed,
+    // no memory is allocated.  The buffer is checked out by swapping, so a
+    // nested transform (e.g., one called by the function being transformed)
+    // just gets a new buffer.
+    template<typename T> class Scratch {
+    private:
+      vector<T> _v;
+      static vector<T>& pool() {
+        static thread_local vector<T> p;
+        return p;
+      }
+    public:
+      explicit Scratch(size_t n) {
+        _v.swap(pool());
+        if (_v.size() < n) _v.resize(n);
+      }
+      ~Scratch() {
+        // Keep the larger buffer if a nested transform returned one
+        if (_v.capacity() > pool().capacity()) _v.swap(pool());
+      }
+      T* data() { return _v.data(); }
+    };
+  }
+
   DST::DST(int N)
     : _N(N < 0 ? 0 : N)
     , _fft(make_shared<fft_t>(fft_t(2 * _N, false)))
@@ -46,8 +73,9 @@ namespace GeographicLib {
       for (int i = 1; i < _N; ++i) data[_N+i] = data[_N-i]; // set [N+1,2*N-1]
       for (int i = 0; i < 2*_N; ++i) data[2*_N+i] = -data[i]; // [2*N, 4*N-1]
     }
-    vector<complex<real>> ctemp(2*_N);
-    _fft->transform_real(data, ctemp.data());
+    Scratch<complex<real>> cscratch(2*_N);
+    complex<real>* ctemp = cscratch.data();
+    _fft->transform_real(data, ctemp);
     if (centerp) {
       real d = -Math::pi()/(4*_N);
       for (int i = 0, j = 1; i < _N; ++i, j+=2)
@@ -75,19 +103,21 @@ namespace GeographicLib {
   }
 
   void DST::transform(function<real(real)> f, real F[]) const {
-    vector<real> data(4 * _N);
+    Scratch<real> scratch(4 * _N);
+    real* data = scratch.data();
     real d = Math::pi()/(2 * _N);
     for (int i = 1; i <= _N; ++i)
       data[i] = f( i * d );
-    fft_transform(data.data(), F, false);
+    fft_transform(data, F, false);
   }
 
   void DST::refine(function<real(real)> f, real F[]) const {
-    vector<real> data(4 * _N);
+    Scratch<real> scratch(4 * _N);
+    real* data = scratch.data();
     real d = Math::pi()/(4 * _N);
     for (int i = 0; i < _N; ++i)
       data[i] = f( (2*i + 1) * d );
-    fft_transform2(data.data(), F);
+    fft_transform2(data, F);
   }
 
   Math::real DST::eval(real sinx, real cosx, const real F[], int N) {
@@ -147,4 +177,87 @@ namespace GeographicLib {
     return (y1 - y0) * (cosy - cosx) + (z1 - z0) * (cosy + cosx);
   }
 
+  void DST::eval(size_t num, const real sinx[], const real cosx[],
+                 const real F[], int N, real y[]) {
+    // The same Clenshaw summation as the scalar version carried out for
+    // blocks of angles.  The inner loops are over the angles in a block.
+    const size_t blk = 32;
+    real ar[blk], y0[blk], y1[blk];
+    for (size_t i0 = 0; i0 < num; i0 += blk) {
+      size_t n = min(blk, num - i0);
+      const real* s = sinx + i0;
+      const real* c = cosx + i0;
+      real f = N & 1 ? F[N - 1] : 0;
+      for (size_t j = 0; j < n; ++j) {
+        ar[j] = 2 * (c[j] - s[j]) * (c[j] + s[j]);
+        y0[j] = f; y1[j] = 0;
+      }
+      for (int k = N & ~1; k > 0;) {
+        real f1 = F[--k];
+        for (size_t j = 0; j < n; ++j)
+          y1[j] = ar[j] * y0[j] - y1[j] + f1;
+        real f0 = F[--k];
+        for (size_t j = 0; j < n; ++j)
+          y0[j] = ar[j] * y1[j] - y0[j] + f0;
+      }
+      for (size_t j = 0; j < n; ++j)
+        y[i0 + j] = s[j] * (y0[j] + y1[j]);
+    }
+  }
+
+  void DST::integral(size_t num, const real sinx[], const real cosx[],
+                     const real F[], int N, real I[]) {
+    const size_t blk = 32;
+    real ar[blk], y0[blk], y1[blk];
+    for (size_t i0 = 0; i0 < num; i0 += blk) {
+      size_t n = min(blk, num - i0);
+      const real* s = sinx + i0;
+      const real* c = cosx + i0;
+      for (size_t j = 0; j < n; ++j) {
+        ar[j] = 2 * (c[j] - s[j]) * (c[j] + s[j]);
+        y0[j] = 0; y1[j] = 0;
+      }
+      for (int k = N - 1; k >= 0; --k) {
+        real f = F[k]/(2*k+1);
+        for (size_t j = 0; j < n; ++j) {
+          real t = ar[j] * y0[j] - y1[j] + f;
+          y1[j] = y0[j]; y0[j] = t;
+        }
+      }
+      for (size_t j = 0; j < n; ++j)
+        I[i0 + j] = c[j] * (y1[j] - y0[j]);
+    }
+  }
+
+  void DST::integral(size_t num, const real sinx[], const real cosx[],
+                     const real siny[], const real cosy[],
+                     const real F[], int N, real I[]) {
+    const size_t blk = 32;
+    real ac[blk], as[blk], cm[blk], cp[blk],
+      y0[blk], y1[blk], z0[blk], z1[blk];
+    for (size_t i0 = 0; i0 < num; i0 += blk) {
+      size_t n = min(blk, num - i0);
+      for (size_t j = 0; j < n; ++j) {
+        real sx = sinx[i0 + j], cx = cosx[i0 + j],
+          sy = siny[i0 + j], cy = cosy[i0 + j];
+        ac[j] = +2 * (cy * cx + sy * sx) * (cy * cx - sy * sx);
+        as[j] = -2 * (sy * cx - cy * sx) * (sy * cx + cy * sx);
+        cm[j] = cy - cx; cp[j] = cy + cx;
+        y0[j] = y1[j] = z0[j] = z1[j] = 0;
+      }
+      for (int k = N - 1; k >= 0; --k) {
+        real f = F[k]/(2*k+1);
+        for (size_t j = 0; j < n; ++j) {
+          real
+            ty = ac[j] * y0[j] + as[j] * z0[j] - y1[j] + f,
+            tz = as[j] * y0[j] + ac[j] * z0[j] - z1[j];
+          y1[j] = y0[j]; y0[j] = ty;
+          z1[j] = z0[j]; z0[j] = tz;
+        }
+      }
+      for (size_t j = 0; j < n; ++j)
+        I[i0 + j] = (y1[j] - y0[j]) * cm[j] + (z1[j] - z0[j]) * cp[j];
+    }
+  }
+
 } // namespace GeographicLib
@@ -0,0 +1,213 @@
+/**
+ * \file EqualAreaGrid.cpp
+ * \brief Implementation for GeographicLib::EqualAreaGrid class
+ *
+ * Copyright (c) Charles Karney (2026) <karney@alum.mit.edu> and licensed under
+ * the MIT/X11 License.  For more information, see
+ * https://geographiclib.sourceforge.io/
+ **********************************************************************/
+
+#include <GeographicLib/EqualAreaGrid.hpp>
+#include <GeographicLib/Utility.hpp>
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <mutex>
+
+using namespace std;
+
+namespace GeographicLib {
+
+  EqualAreaGrid::EqualAreaGrid(real a, real f, int nbands)
+    : _aux(a, f)
+    , _nbands(nbands)
+  {
+    if (!(nbands > 0))
+      throw GeographicErr("Number of bands must be positive");
+    _dxi = real(Math::hd) / nbands;
+    _R2 = _aux.AuthalicRadiusSquared(true);
+    _lat.resize(nbands + 1);
+    _ncells.resize(nbands);
+    _start.resize(nbands + 1);
+    _area.resize(nbands);
+    for (int j = 1; j < nbands; ++j)
+      _lat[j] = _aux.Convert(AuxLatitude::AUTHALIC, AuxLatitude::GEOGRAPHIC,
+                             -Math::qd + j * _dxi, true);
+    _lat[0] = -Math::qd; _lat[nbands] = Math::qd;
+    real d = _dxi * Math::degree();
+    long long tot = 0;
+    for (int j = 0; j < nbands; ++j) {
+      // sin(xi[j+1]) - sin(xi[j]) is proportional to the area of the band;
+      // choose the number of cells so that they are nearly square.
+      real ds = 2 * Math::cosd(-Math::qd + (j + real(0.5)) * _dxi) * sin(d/2);
+      int n = max(1, int(round(2 * Math::pi() * ds / (d * d))));
+      _ncells[j] = n;
+      _start[j] = int(tot);
+      tot += n;
+      if (tot > numeric_limits<int>::max())
+        throw GeographicErr("Too many cells in EqualAreaGrid");
+      _area[j] = 2 * Math::pi() * _R2 * ds / n;
+    }
+    _start[nbands] = int(tot);
+    // Compute the series coefficients for the conversion to authalic
+    // latitude now; otherwise they are computed on first use which is not
+    // thread-safe.
+    _aux.Convert(AuxLatitude::GEOGRAPHIC, AuxLatitude::AUTHALIC, real(0));
+  }
+
+  int EqualAreaGrid::band(real lat, real xi) const {
+    // xi gives the band approximately; adjust this using the exact band
+    // boundaries in geographic latitude.
+    int j = int(floor((xi + Math::qd) / _dxi));
+    j = max(0, min(_nbands - 1, j));
+    while (j > 0 && lat < _lat[j]) --j;
+    while (j < _nbands - 1 && !(lat < _lat[j + 1])) ++j;
+    return j;
+  }
+
+  int EqualAreaGrid::cell(int j, real lon) const {
+    // lon is in (-180, 180]; the cells start at -180.
+    int n = _ncells[j];
+    if (lon == Math::hd) lon = -Math::hd;
+    real w = real(Math::td) / n;
+    int k = int(floor((lon + Math::hd) / w));
+    k = max(0, min(n - 1, k));
+    // Be consistent with Bounds
+    if (k > 0 && lon < -Math::hd + k * w) --k;
+    else if (k < n - 1 && !(lon < -Math::hd + (k + 1) * w)) ++k;
+    return _start[j] + k;
+  }
+
+  int EqualAreaGrid::Cell(real lat, real lon) const {
+    if (!(fabs(lat) <= Math::qd && isfinite(lon)))
+      return -1;
+    real xi = _aux.Convert(AuxLatitude::GEOGRAPHIC, AuxLatitude::AUTHALIC,
+                           lat);
+    return cell(band(lat, xi), Math::AngNormalize(lon));
+  }
+
+  void EqualAreaGrid::Cell(size_t num, const real lat[], const real lon[],
+                           int cell[]) const {
+    const size_t nblk = 64;
+    real sxi[nblk], cxi[nblk], xi[nblk], lam[nblk];
+    for (size_t i0 = 0; i0 < num; i0 += nblk) {
+      size_t m = min(nblk, num - i0);
+      const real* phi = lat + i0;
+      Math::sincosd(m, phi, sxi, cxi);
+      _aux.Convert(m, AuxLatitude::GEOGRAPHIC, AuxLatitude::AUTHALIC,
+                   sxi, cxi, sxi, cxi);
+      Math::atan2d(m, sxi, cxi, xi);
+      Math::AngNormalize(m, lon + i0, lam);
+      int* c = cell + i0;
+      for (size_t k = 0; k < m; ++k)
+        c[k] = fabs(phi[k]) <= Math::qd && isfinite(lam[k]) ?
+          this->cell(band(phi[k], xi[k]), lam[k]) : -1;
+    }
+  }
+
+  size_t EqualAreaGrid::Histogram(const Executor& exec,
+                                  size_t num,
+                                  const real lat[], const real lon[],
+                                  vector<unsigned long long>& counts) const {
+    typedef vector<unsigned long long> hist;
+    size_t ncells = size_t(NumCells());
+    if (counts.size() != ncells) counts.assign(ncells, 0);
+    // Each call of the work function takes a histogram which isn't in use
+    // (creating a new one if necessary) so that there's one histogram per
+    // thread.  The first histogram is counts itself.
+    vector< unique_ptr<hist> > parts;
+    vector<hist*> idle(1, &counts);
+    mutex lock;
+    atomic<size_t> total(0);
+    exec.For(num, [&](size_t i0, size_t i1) -> void {
+      hist* h;
+      {
+        lock_guard<mutex> guard(lock);
+        if (idle.empty()) {
+          parts.emplace_back(new hist(ncells, 0));
+          h = parts.back().get();
+        } else {
+          h = idle.back(); idle.pop_back();
+        }
+      }
+      const size_t nblk = 64;
+      int c[nblk];
+      size_t cnt = 0;
+      for (size_t i = i0; i < i1; i += nblk) {
+        size_t m = min(nblk, i1 - i);
+        Cell(m, lat + i, lon + i, c);
+        for (size_t k = 0; k < m; ++k)
+          if (c[k] >= 0) { ++(*h)[c[k]]; ++cnt; }
+      }
+      total += cnt;
+      lock_guard<mutex> guard(lock);
+      idle.push_back(h);
+    });
+    if (!parts.empty())
+      exec.For(ncells, [&](size_t c0, size_t c1) -> void {
+        for (const unique_ptr<hist>& p : parts)
+          for (size_t c = c0; c < c1; ++c)
+            counts[c] += (*p)[c];
+      });
+    return total;
+  }
+
+  void EqualAreaGrid::checkcell(int cell) const {
+    if (!(cell >= 0 && cell < NumCells()))
+      throw GeographicErr("Cell index " + Utility::str(cell) +
+                          " not in [0, " + Utility::str(NumCells()) + ")");
+  }
+
+  void EqualAreaGrid::Position(int cell, int& band, int& k) const {
+    checkcell(cell);
+    band = int(upper_bound(_start.begin(), _start.end(), cell) -
+               _start.begin()) - 1;
+    k = cell - _start[band];
+  }
+
+  void EqualAreaGrid::Bounds(int cell, real& lat0, real& lat1,
+                             real& lon0, real& lon1) const {
+    int j, k;
+    Position(cell, j, k);
+    real w = real(Math::td) / _ncells[j];
+    lat0 = _lat[j]; lat1 = _lat[j + 1];
+    lon0 = -Math::hd + k * w;
+    lon1 = k + 1 == _ncells[j] ? real(Math::hd) : -Math::hd + (k + 1) * w;
+  }
+
+  void EqualAreaGrid::Boundary(int cell, int n,
+                               vector<real>& lat, vector<real>& lon) const {
+    if (!(n > 0))
+      throw GeographicErr("Number of segments must be positive");
+    int j, k;
+    Position(cell, j, k);
+    real lat0, lat1, lon0, lon1;
+    Bounds(cell, lat0, lat1, lon0, lon1);
+    lat.clear(); lon.clear();
+    // The southern edge going east and the northern edge going west.  The
+    // edge at a pole is a single vertex (omitted if the cell is the whole
+    // polar cap).
+    if (j > 0)
+      for (int i = 0; i <= n; ++i) {
+        lat.push_back(lat0); lon.push_back(lon0 + (lon1 - lon0) * i / n);
+      }
+    else if (_ncells[j] > 1) {
+      lat.push_back(lat0); lon.push_back(lon0);
+    }
+    if (j < _nbands - 1)
+      for (int i = 0; i <= n; ++i) {
+        lat.push_back(lat1); lon.push_back(lon1 - (lon1 - lon0) * i / n);
+      }
+    else if (_ncells[j] > 1) {
+      lat.push_back(lat1); lon.push_back(lon1);
+    }
+  }
+
+  Math::real EqualAreaGrid::Area(int cell) const {
+    int j, k;
+    Position(cell, j, k);
+    return _area[j];
+  }
+
+} // namespace GeographicLib
@@ -0,0 +1,243 @@
+/**
+ * \file Executor.cpp
+ * \brief Implementation for GeographicLib::Executor class
+ *
+ * Copyright (c) Charles Karney (2026) <karney@alum.mit.edu> and licensed
+ * under the MIT/X11 License.  For more information, see
+ * https://geographiclib.sourceforge.io/
+ **********************************************************************/
+
+#include <GeographicLib/Executor.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace GeographicLib {
+
+  using namespace std;
+
+  // The default thread pool.  Each of the n participants (the n - 1 workers
+  // and the calling thread) is given a share of the range.  It processes
+  // its share from the front in chunks of grain elements; when its share is
+  // exhausted it steals the back half of the share of another participant.
+  // A share is only split if it contains at least 2 * grain elements.  The
+  // shares are protected by separate mutexes; these are only locked once
+  // per chunk so contention is negligible.
+  class Executor::Pool {
+  private:
+    struct share {
+      mutex lock;
+      size_t begin, end;
+      // The lowest starting index of a failed chunk and its exception
+      size_t errbegin;
+      exception_ptr err;
+      share() : begin(0), end(0), errbegin(0) {}
+    };
+    const int _n;
+    unique_ptr<share[]> _shares;
+    vector<thread> _threads;
+    // _busy is set for the duration of a call to Run.  This is an atomic
+    // flag and not a mutex, because Run may be called recursively from a
+    // work function in a thread (e.g., the caller) which is already running
+    // the pool.
+    atomic<bool> _busy;
+    mutex _lock;
+    condition_variable _start, _done;
+    const work* _f;
+    size_t _grain;
+    unsigned long long _generation;
+    int _active;
+    bool _stop;
+    // Take a chunk from share k; return false if it is empty
+    bool take(int k, size_t& b, size_t& e) {
+      share& s = _shares[k];
+      lock_guard<mutex> guard(s.lock);
+      if (s.begin >= s.end) return false;
+      b = s.begin;
+      e = s.end - b < 2 * _grain ? s.end : b + _grain;
+      s.begin = e;
+      return true;
+    }
+    // Steal the back half of another share and make it share k; return
+    // false if there's nothing to steal.
+    bool steal(int k) {
+      for (int i = 1; i < _n; ++i) {
+        share& v = _shares[(k + i) % _n];
+        size_t b, e;
+        {
+          lock_guard<mutex> guard(v.lock);
+          if (v.end - v.begin < 2 * _grain) continue;
+          b = v.begin + (v.end - v.begin) / 2; e = v.end;
+          v.end = b;
+        }
+        share& s = _shares[k];
+        lock_guard<mutex> guard(s.lock);
+        s.begin = b; s.end = e;
+        return true;
+      }
+      return false;
+    }
+    void participate(int k) {
+      share& s = _shares[k];
+      do {
+        size_t b, e;
+        while (take(k, b, e)) {
+          try {
+            (*_f)(b, e);
+          }
+          catch (...) {
+            lock_guard<mutex> guard(s.lock);
+            if (!s.err || b < s.errbegin) {
+              s.err = current_exception(); s.errbegin = b;
+            }
+          }
+        }
+      } while (steal(k));
+    }
+    void worker(int k) {
+      unsigned long long generation = 0;
+      while (true) {
+        {
+          unique_lock<mutex> guard(_lock);
+          _start.wait(guard, [this, generation]() -> bool
+                      { return _stop || _generation != generation; });
+          if (_stop) return;
+          generation = _generation;
+        }
+        participate(k);
+        lock_guard<mutex> guard(_lock);
+        if (--_active == 0) _done.notify_one();
+      }
+    }
+  public:
+    explicit Pool(int n)
+      : _n(n)
+      , _shares(new share[n])
+      , _busy(false)
+      , _f(nullptr)
+      , _grain(1)
+      , _generation(0)
+      , _active(0)
+      , _stop(false)
+    {
+      _threads.reserve(_n - 1);
+      for (int k = 1; k < _n; ++k)
+        _threads.emplace_back(&Pool::worker, this, k);
+    }
+    ~Pool() {
+      {
+        lock_guard<mutex> guard(_lock);
+        _stop = true;
+      }
+      _start.notify_all();
+      for (auto& t : _threads)
+        t.join();
+    }
+    // Return false if the pool is busy
+    bool Run(size_t num, size_t grain, const work& f) {
+      bool idle = false;
+      if (!_busy.compare_exchange_strong(idle, true)) return false;
+      // Release _busy on exit, including when an exception is rethrown
+      struct release {
+        atomic<bool>& busy;
+        explicit release(atomic<bool>& b) : busy(b) {}
+        ~release() { busy.store(false); }
+      } guard(_busy);
+      size_t m = min(size_t(_n), num / grain);
+      for (int k = 0; k < _n; ++k) {
+        share& s = _shares[k];
+        s.begin = size_t(k) < m ? k * num / m : num;
+        s.end = size_t(k) < m ? (k + 1) * num / m : num;
+        s.err = nullptr;
+      }
+      {
+        lock_guard<mutex> guard(_lock);
+        _f = &f; _grain = grain;
+        _active = _n - 1;
+        ++_generation;
+      }
+      _start.notify_all();
+      participate(0);
+      {
+        unique_lock<mutex> guard(_lock);
+        _done.wait(guard, [this]() -> bool { return _active == 0; });
+        _f = nullptr;
+      }
+      int kerr = -1;
+      for (int k = 0; k < _n; ++k)
+        if (_shares[k].err &&
+            (kerr < 0 || _shares[k].errbegin < _shares[kerr].errbegin))
+          kerr = k;
+      if (kerr >= 0) {
+        exception_ptr err = _shares[kerr].err;
+        for (int k = 0; k < _n; ++k) _shares[k].err = nullptr;
+        rethrow_exception(err);
+      }
+      return true;
+    }
+  };
+
+  Executor::Executor(int nthreads, size_t grain)
+    : _nthreads(nthreads)
+    , _grain(grain)
+  {
+    if (!(_nthreads >= 0))
+      throw GeographicErr("Number of threads cannot be negative");
+    if (!(_grain > 0))
+      throw GeographicErr("Grain size must be positive");
+    if (_nthreads == 0)
+      // hardware_concurrency may return 0 if the value can't be determined
+      _nthreads = max(1, int(thread::hardware_concurrency()));
+    if (_nthreads > 1)
+      _pool = make_shared<Pool>(_nthreads);
+  }
+
+  Executor::Executor(const scheduler& sched, int nthreads, size_t grain)
+    : _nthreads(nthreads)
+    , _grain(grain)
+    , _sched(sched)
+  {
+    if (!_sched)
+      throw GeographicErr("Scheduler must not be empty");
+    if (!(_nthreads >= 0))
+      throw GeographicErr("Number of threads cannot be negative");
+    if (!(_grain > 0))
+      throw GeographicErr("Grain size must be positive");
+    if (_nthreads == 0)
+      _nthreads = max(1, int(thread::hardware_concurrency()));
+  }
+
+  void Executor::For(size_t num, const work& f) const {
+    if (num == 0) return;
+    if (_sched) {
+      mutex lock;
+      size_t errbegin = 0;
+      exception_ptr err;
+      _sched(num, _grain,
+             [&f, &lock, &errbegin, &err](size_t b, size_t e) -> void {
+               try {
+                 f(b, e);
+               }
+               catch (...) {
+                 lock_guard<mutex> guard(lock);
+                 if (!err || b < errbegin) {
+                   err = current_exception(); errbegin = b;
+                 }
+               }
+             });
+      if (err) rethrow_exception(err);
+      return;
+    }
+    if (!(_pool && num >= 2 * _grain && _pool->Run(num, _grain, f)))
+      f(0, num);
+  }
+
+  const Executor& Executor::Serial() {
+    static const Executor serial(1);
+    return serial;
+  }
+
+} // namespace GeographicLib
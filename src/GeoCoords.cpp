@@ -2,7 +2,7 @@
  * \file GeoCoords.cpp
  * \brief Implementation for GeographicLib::GeoCoords class
  *
- * Copyright (c) Charles Karney (2008-2022) <karney@alum.mit.edu> and licensed
+ * Copyright (c) Charles Karney (2008-2026) <karney@alum.mit.edu> and licensed
  * under the MIT/X11 License.  For more information, see
  * https://geographiclib.sourceforge.io/
  **********************************************************************/
@@ -16,6 +16,82 @@ namespace GeographicLib {
 
   using namespace std;
 
+  GeoCoords& GeoCoords::operator=(const GeoCoords& p) {
+    if (this != &p) {
+      lock_guard<mutex> guard(p._lock);
+      _lat = p._lat;
+      _long = p._long;
+      _easting = p._easting;
+      _northing = p._northing;
+      _gamma = p._gamma;
+      _k = p._k;
+      _northp = p._northp;
+      _zone = p._zone;
+      _geoinput = p._geoinput;
+      _altsame = p._altsame;
+      _alt_easting = p._alt_easting;
+      _alt_northing = p._alt_northing;
+      _alt_gamma = p._alt_gamma;
+      _alt_k = p._alt_k;
+      _alt_zone = p._alt_zone;
+      _complete.store(p._complete.load(memory_order_relaxed),
+                      memory_order_release);
+    }
+    return *this;
+  }
+
+  void GeoCoords::DoComplete() const {
+    lock_guard<mutex> guard(_lock);
+    if (_complete.load(memory_order_relaxed))
+      return;                   // Another thread got here first
+    if (_geoinput) {
+      // SetGeo has checked the arguments so this doesn't throw
+      int zone; bool northp;
+      UTMUPS::Forward(_lat, _long, zone, northp,
+                      _easting, _northing, _gamma, _k, _zone);
+    } else
+      // MGRS::Reverse returns coordinates in the allowed range so this
+      // doesn't throw
+      UTMUPS::Reverse(_zone, _northp, _easting, _northing,
+                      _lat, _long, _gamma, _k);
+    _complete.store(true, memory_order_release);
+  }
+
+  void GeoCoords::SetGeo(real latitude, real longitude) {
+    _geoinput = true;
+    if (fabs(latitude) <= Math::qd && isfinite(longitude)) {
+      // The standard zone and hemisphere are cheap to find and the
+      // conversion to UTM/UPS can't fail, so defer it.
+      _zone = UTMUPS::StandardZone(latitude, longitude);
+      _northp = !signbit(latitude);
+      _lat = latitude;
+      _long = longitude;
+      _complete.store(false, memory_order_release);
+    } else {
+      // Let UTMUPS::Forward deal with NaNs and illegal arguments
+      UTMUPS::Forward(latitude, longitude,
+                      _zone, _northp, _easting, _northing, _gamma, _k);
+      _lat = latitude;
+      _long = longitude;
+      _complete.store(true, memory_order_release);
+    }
+  }
+
+  void GeoCoords::Reset(real latitude, real longitude, int zone) {
+    if (zone == UTMUPS::STANDARD)
+      SetGeo(latitude, Math::AngNormalize(longitude));
+    else {
+      UTMUPS::Forward(latitude, longitude,
+                      _zone, _northp, _easting, _northing, _gamma, _k,
+                      zone);
+      _lat = latitude;
+      _long = Math::AngNormalize(longitude);
+      _geoinput = true;
+      _complete.store(true, memory_order_release);
+    }
+    CopyToAlt();
+  }
+
   void GeoCoords::Reset(const std::string& s, bool centerp, bool longfirst) {
     vector<string> sa;
     const char* spaces = " \t\n\v\f\r,"; // Include comma as a space
@@ -29,12 +105,13 @@ namespace GeographicLib {
     if (sa.size() == 1) {
       int prec;
       MGRS::Reverse(sa[0], _zone, _northp, _easting, _northing, prec, centerp);
-      UTMUPS::Reverse(_zone, _northp, _easting, _northing,
-                      _lat, _long, _gamma, _k);
+      // Defer the conversion to geographic coordinates
+      _geoinput = false;
+      _complete.store(false, memory_order_release);
     } else if (sa.size() == 2) {
-      DMS::DecodeLatLon(sa[0], sa[1], _lat, _long, longfirst);
-      UTMUPS::Forward( _lat, _long,
-                       _zone, _northp, _easting, _northing, _gamma, _k);
+      real lat, lon;
+      DMS::DecodeLatLon(sa[0], sa[1], lat, lon, longfirst);
+      SetGeo(lat, lon);
     } else if (sa.size() == 3) {
       unsigned zoneind, coordind;
       if (sa[0].size() > 0 && isalpha(sa[0][sa[0].size() - 1])) {
@@ -52,14 +129,34 @@ namespace GeographicLib {
         (i ? _northing : _easting) = Utility::val<real>(sa[coordind + i]);
       UTMUPS::Reverse(_zone, _northp, _easting, _northing,
                       _lat, _long, _gamma, _k);
+      _geoinput = false;
+      _complete.store(true, memory_order_release);
       FixHemisphere();
     } else
       throw GeographicErr("Coordinate requires 1, 2, or 3 elements");
     CopyToAlt();
   }
 
+  void GeoCoords::SetAltZone(int zone) const {
+    if (zone == UTMUPS::MATCH)
+      return;
+    CompleteGeo();
+    zone = UTMUPS::StandardZone(_lat, _long, zone);
+    if (zone == _zone)
+      CopyToAlt();
+    else {
+      bool northp;
+      UTMUPS::Forward(_lat, _long,
+                      _alt_zone, northp,
+                      _alt_easting, _alt_northing, _alt_gamma, _alt_k,
+                      zone);
+      _altsame = false;
+    }
+  }
+
   string GeoCoords::GeoRepresentation(int prec, bool longfirst) const {
     using std::isnan;           // Needed for Centos 7, ubuntu 14
+    CompleteGeo();
     prec = max(0, min(9 + Math::extra_digits(), prec) + 5);
     return Utility::str(longfirst ? _long : _lat, prec) +
       " " + Utility::str(longfirst ? _lat : _long, prec);
@@ -67,6 +164,7 @@ namespace GeographicLib {
 
   string GeoCoords::DMSRepresentation(int prec, bool longfirst,
                                       char dmssep) const {
+    CompleteGeo();
     prec = max(0, min(10 + Math::extra_digits(), prec) + 5);
     return DMS::Encode(longfirst ? _long : _lat, unsigned(prec),
                        longfirst ? DMS::LONGITUDE : DMS::LATITUDE, dmssep) +
@@ -78,11 +176,20 @@ namespace GeographicLib {
     // Max precision is um
     prec = max(-1, min(6, prec) + 5);
     string mgrs;
-    MGRS::Forward(_zone, _northp, _easting, _northing, _lat, prec, mgrs);
+    if (_geoinput || _complete.load(memory_order_acquire)) {
+      CompleteUTMUPS();
+      MGRS::Forward(_zone, _northp, _easting, _northing, _lat, prec, mgrs);
+    } else
+      // Skip the conversion to geographic coordinates; this version of
+      // MGRS::Forward only computes the latitude if it's needed to
+      // determine the latitude band.
+      MGRS::Forward(_zone, _northp, _easting, _northing, prec, mgrs);
     return mgrs;
   }
 
   string GeoCoords::AltMGRSRepresentation(int prec) const {
+    if (_altsame)
+      return MGRSRepresentation(prec);
     // Max precision is um
     prec = max(-1, min(6, prec) + 5);
     string mgrs;
@@ -115,6 +222,7 @@ namespace GeographicLib {
   }
 
   string GeoCoords::UTMUPSRepresentation(int prec, bool abbrev) const {
+    CompleteUTMUPS();
     string utm;
     UTMUPSString(_zone, _northp, _easting, _northing, prec, abbrev, utm);
     return utm;
@@ -122,6 +230,7 @@ namespace GeographicLib {
 
   string GeoCoords::UTMUPSRepresentation(bool northp, int prec,
                                          bool abbrev) const {
+    CompleteUTMUPS();
     real e, n;
     int z;
     UTMUPS::Transfer(_zone, _northp, _easting, _northing,
@@ -132,6 +241,8 @@ namespace GeographicLib {
   }
 
   string GeoCoords::AltUTMUPSRepresentation(int prec, bool abbrev) const {
+    if (_altsame)
+      return UTMUPSRepresentation(prec, abbrev);
     string utm;
     UTMUPSString(_alt_zone, _northp, _alt_easting, _alt_northing, prec,
                  abbrev, utm);
@@ -140,6 +251,8 @@ namespace GeographicLib {
 
   string GeoCoords::AltUTMUPSRepresentation(bool northp, int prec,
                                             bool abbrev) const {
+    if (_altsame)
+      return UTMUPSRepresentation(northp, prec, abbrev);
     real e, n;
     int z;
     UTMUPS::Transfer(_alt_zone, _northp, _alt_easting, _alt_northing,
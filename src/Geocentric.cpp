@@ -152,6 +152,45 @@ namespace GeographicLib {
       Rotation(sphi, cphi, slam, clam, M);
   }
 
+  void Geocentric::Forward(size_t num, const real lat[], const real lon[],
+                           const real h[], real X[], real Y[], real Z[],
+                           real M[]) const {
+    // The same as IntForward, except that the trigonometric functions for a
+    // block of points are computed first with the array version of sincosd.
+    if (!Init())
+      return;
+    const size_t blk = 64;
+    real phi[blk], sphi[blk], cphi[blk], slam[blk], clam[blk];
+    for (size_t i0 = 0; i0 < num; i0 += blk) {
+      size_t n = min(blk, num - i0);
+      for (size_t j = 0; j < n; ++j)
+        phi[j] = Math::LatFix(lat[i0 + j]);
+      Math::sincosd(n, phi, sphi, cphi);
+      Math::sincosd(n, lon + i0, slam, clam);
+      for (size_t j = 0; j < n; ++j) {
+        size_t i = i0 + j;
+        real n1 = _a/sqrt(1 - _e2 * Math::sq(sphi[j])),
+          x = (n1 + h[i]) * cphi[j];
+        Z[i] = (_e2m * n1 + h[i]) * sphi[j];
+        Y[i] = x * slam[j];
+        X[i] = x * clam[j];
+      }
+      if (M)
+        for (size_t j = 0; j < n; ++j)
+          Rotation(sphi[j], cphi[j], slam[j], clam[j], M + dim2_ * (i0 + j));
+    }
+  }
+
+  void Geocentric::Reverse(size_t num,
+                           const real X[], const real Y[], const real Z[],
+                           real lat[], real lon[], real h[], real M[]) const {
+    if (!Init())
+      return;
+    for (size_t i = 0; i < num; ++i)
+      IntReverse(X[i], Y[i], Z[i], lat[i], lon[i], h[i],
+                 M ? M + dim2_ * i : nullptr);
+  }
+
   void Geocentric::Rotation(real sphi, real cphi, real slam, real clam,
                             real M[dim2_]) {
     // This rotation matrix is given by the following quaternion operations
@@ -2,7 +2,7 @@
  * \file Geodesic.cpp
  * \brief Implementation for GeographicLib::Geodesic class
  *
- * Copyright (c) Charles Karney (2009-2023) <karney@alum.mit.edu> and licensed
+ * Copyright (c) Charles Karney (2009-2026) <karney@alum.mit.edu> and licensed
  * under the MIT/X11 License.  For more information, see
  * https://geographiclib.sourceforge.io/
  *
@@ -143,6 +143,22 @@ namespace GeographicLib {
                   lat2, lon2, azi2, s12, m12, M12, M21, S12);
   }
 
+  void Geodesic::Direct(size_t num, const real lat1[], const real lon1[],
+                        const real azi1[], const real s12[],
+                        real lat2[], real lon2[], real azi2[],
+                        real m12[], real M12[], real M21[],
+                        real S12[]) const {
+    unsigned outmask = LATITUDE | LONGITUDE |
+      (azi2 ? AZIMUTH : NONE) | (m12 ? REDUCEDLENGTH : NONE) |
+      (M12 || M21 ? GEODESICSCALE : NONE) | (S12 ? AREA : NONE);
+    real t;
+    for (size_t i = 0; i < num; ++i)
+      GenDirect(lat1[i], lon1[i], azi1[i], false, s12[i], outmask,
+                lat2[i], lon2[i], azi2 ? azi2[i] : t, t,
+                m12 ? m12[i] : t, M12 ? M12[i] : t, M21 ? M21[i] : t,
+                S12 ? S12[i] : t);
+  }
+
   GeodesicLine Geodesic::GenDirectLine(real lat1, real lon1, real azi1,
                                        bool arcmode, real s12_a12,
                                        unsigned caps) const {
@@ -171,7 +187,10 @@ namespace GeographicLib {
                                   real& salp1, real& calp1,
                                   real& salp2, real& calp2,
                                   real& m12, real& M12, real& M21,
-                                  real& S12) const {
+                                  real& S12, InverseHint* hint) const {
+    if (hint) {
+      ++hint->_count; hint->_numit = 0; hint->_warm = false;
+    }
     if (_exact)
       return _geodexact.GenInverse(lat1, lon1, lat2, lon2,
                                    outmask, s12,
@@ -322,12 +341,20 @@ namespace GeographicLib {
       // Now point1 and point2 belong within a hemisphere bounded by a
       // meridian and geodesic is neither meridional or equatorial.
 
-      // Figure a starting point for Newton's method
+      // Figure a starting point for Newton's method.  With a warm start, the
+      // hint is the starting point; the symmetry transformations must match
+      // for its canonical alp1 to apply.
       real dnm;
-      sig12 = InverseStart(sbet1, cbet1, dn1, sbet2, cbet2, dn2,
-                           lam12, slam12, clam12,
-                           salp1, calp1, salp2, calp2, dnm,
-                           Ca);
+      int signs = 4 * swapp + 2 * latsign + lonsign;
+      bool warm = hint && hint->_nsol > 0 && hint->_signs == signs;
+      if (warm) {
+        hint->start(signs, salp1, calp1);
+        sig12 = -1;
+      } else
+        sig12 = InverseStart(sbet1, cbet1, dn1, sbet2, cbet2, dn2,
+                             lam12, slam12, clam12,
+                             salp1, calp1, salp2, calp2, dnm,
+                             Ca);
 
       if (sig12 >= 0) {
         // Short lines (InverseStart sets salp2, calp2, dnm)
@@ -337,6 +364,7 @@ namespace GeographicLib {
           M12 = M21 = cos(sig12 / dnm);
         a12 = sig12 / Math::degree();
         omg12 = lam12 / (_f1 * dnm);
+        if (hint) hint->record(signs, salp1, calp1);
       } else {
 
         // Newton's method.  This is a straightforward solution of f(alp1) =
@@ -375,6 +403,19 @@ namespace GeographicLib {
             { salp1b = salp1; calp1b = calp1; }
           else if (v < 0 && (numit > maxit1_ || calp1/salp1 < calp1a/salp1a))
             { salp1a = salp1; calp1a = calp1; }
+          if (numit == 0 && warm && !(dv > 0 && fabs(v) < real(0.02) * dv)) {
+            // The Newton step from the hint exceeds about 1 deg (or is in
+            // the wrong direction), so fall back to the usual starting
+            // point, keeping the bracket.  If InverseStart finds a short
+            // line, its solution is just used as the starting point.
+            warm = false;
+            InverseStart(sbet1, cbet1, dn1, sbet2, cbet2, dn2,
+                         lam12, slam12, clam12,
+                         salp1, calp1, salp2, calp2, dnm,
+                         Ca);
+            tripn = false;
+            continue;
+          }
           if (numit < maxit1_ && dv > 0) {
             real
               dalp1 = -v/dv;
@@ -412,6 +453,11 @@ namespace GeographicLib {
           tripb = (fabs(salp1a - salp1) + (calp1a - calp1) < tolb_ ||
                    fabs(salp1 - salp1b) + (calp1 - calp1b) < tolb_);
         }
+        if (hint) {
+          hint->record(signs, salp1, calp1);
+          hint->_warm = warm; hint->_numit = numit + 1;
+          hint->_warmcount += warm; hint->_totit += numit + 1;
+        }
         {
           real dummy;
           // Ensure that the reduced length and geodesic scale are computed in
@@ -530,6 +576,154 @@ namespace GeographicLib {
     return a12;
   }
 
+  Math::real Geodesic::GenInverse(real lat1, real lon1, real lat2, real lon2,
+                                  unsigned outmask,
+                                  real& s12, real& azi1, real& azi2,
+                                  real& m12, real& M12, real& M21,
+                                  real& S12, InverseHint& hint) const {
+    outmask &= OUT_MASK;
+    real salp1, calp1, salp2, calp2,
+      a12 =  GenInverse(lat1, lon1, lat2, lon2,
+                        outmask, s12, salp1, calp1, salp2, calp2,
+                        m12, M12, M21, S12, &hint);
+    if (outmask & AZIMUTH) {
+      azi1 = Math::atan2d(salp1, calp1);
+      azi2 = Math::atan2d(salp2, calp2);
+    }
+    return a12;
+  }
+
+  int Geodesic::WithinBounds(real sphi1, real cphi1, real sphi2, real cphi2,
+                             real slam12, real clam12, real R) const {
+    // The points on the ellipsoid with P1 in the plane lon = 0
+    real
+      n1 = _a / sqrt(1 - _e2 * Math::sq(sphi1)),
+      x1 = n1 * cphi1, z1 = n1 * Math::sq(_f1) * sphi1,
+      n2 = _a / sqrt(1 - _e2 * Math::sq(sphi2)),
+      p2 = n2 * cphi2, x2 = p2 * clam12, y2 = p2 * slam12,
+      z2 = n2 * Math::sq(_f1) * sphi2,
+      // The cross product P1 x P2, the normal to the plane of the section
+      cx = -z1 * y2, cy = z1 * x2 - x1 * z2, cz = x1 * y2,
+      cn = sqrt(Math::sq(cx) + Math::sq(cy) + Math::sq(cz)),
+      theta = atan2(cn, x1 * x2 + z1 * z2),
+      rmin = fmin(_a, _b), rmax = fmax(_a, _b),
+      // Allowance for roundoff in the bounds
+      margin = tol1_ * (rmax + R),
+      lower = fmax(sqrt(Math::sq(x1 - x2) + Math::sq(y2) + Math::sq(z1 - z2)),
+                   rmin * theta);
+    if (lower > R + margin) return 0;
+    // Nearly antipodal points (and NaNs); require sin(theta) > 1/100 so that
+    // the normal to the section is accurately determined.
+    if (!(theta < Math::pi() - real(0.01))) return -1;
+    real
+      nz = cz / cn,
+      // The semi-axes of the section are a (along the equator) and bs (in
+      // the direction of the point of the section furthest from the equator,
+      // the vertex).
+      bs = 1 / sqrt(Math::sq(nz / _a) + (1 - Math::sq(nz)) / Math::sq(_b)),
+      // The arc contains the vertex if the rate of change of z along the arc
+      // changes sign.  (The tangent at P is proportional to n x P.)
+      g1 = -cy * x1, g2 = cx * y2 - cy * x2,
+      // The radius is monotonic between the axes of the section
+      rhi = fmax(hypot(x1, z1), hypot(p2, z2));
+    if (z1 * z2 <= 0) rhi = fmax(rhi, _a);
+    if (g1 * g2 <= 0) rhi = fmax(rhi, bs);
+    // For an ellipse with semi-axes A >= B in polar coordinates |dr/dphi| / r
+    // <= (A^2/B^2 - 1)/2.
+    real
+      q = (Math::sq(fmax(_a, bs) / fmin(_a, bs)) - 1) / 2,
+      upper = rhi * theta * sqrt(1 + Math::sq(q));
+    return upper < R - margin ? 1 : -1;
+  }
+
+  bool Geodesic::Within(real lat1, real lon1, real lat2, real lon2,
+                        real R) const {
+    real sphi1, cphi1, sphi2, cphi2, slam12, clam12;
+    Math::sincosd(Math::LatFix(lat1), sphi1, cphi1);
+    Math::sincosd(Math::LatFix(lat2), sphi2, cphi2);
+    Math::sincosd(Math::AngDiff(lon1, lon2), slam12, clam12);
+    int w = WithinBounds(sphi1, cphi1, sphi2, cphi2, slam12, clam12, R);
+    if (w >= 0) return w == 1;
+    real s12, t;
+    GenInverse(lat1, lon1, lat2, lon2, DISTANCE, s12, t, t, t, t, t, t);
+    return s12 < R;
+  }
+
+  size_t Geodesic::Within(size_t num, const real lat1[], const real lon1[],
+                          const real lat2[], const real lon2[], real R,
+                          bool within[]) const {
+    const size_t nblk = 64;
+    real phi1[nblk], phi2[nblk], lam12[nblk],
+      sphi1[nblk], cphi1[nblk], sphi2[nblk], cphi2[nblk],
+      slam12[nblk], clam12[nblk];
+    size_t fast = 0;
+    for (size_t i0 = 0; i0 < num; i0 += nblk) {
+      size_t n = min(nblk, num - i0);
+      for (size_t j = 0; j < n; ++j) {
+        phi1[j] = Math::LatFix(lat1[i0 + j]);
+        phi2[j] = Math::LatFix(lat2[i0 + j]);
+      }
+      Math::sincosd(n, phi1, sphi1, cphi1);
+      Math::sincosd(n, phi2, sphi2, cphi2);
+      Math::AngDiff(n, lon1 + i0, lon2 + i0, lam12);
+      Math::sincosd(n, lam12, slam12, clam12);
+      for (size_t j = 0; j < n; ++j) {
+        int w = WithinBounds(sphi1[j], cphi1[j], sphi2[j], cphi2[j],
+                             slam12[j], clam12[j], R);
+        if (w >= 0) {
+          within[i0 + j] = w == 1;
+          ++fast;
+        } else {
+          real s12, t;
+          GenInverse(lat1[i0 + j], lon1[i0 + j], lat2[i0 + j], lon2[i0 + j],
+                     DISTANCE, s12, t, t, t, t, t, t);
+          within[i0 + j] = s12 < R;
+        }
+      }
+    }
+    return fast;
+  }
+
+  void Geodesic::InverseHint::start(int signs, real& salp1, real& calp1)
+    const {
+    salp1 = _salp1; calp1 = _calp1;
+    if (_nsol > 1 && _signs == signs) {
+      // Extrapolate alp1 + (alp1 - alp0)
+      real
+        sdalp = _salp1 * _calp0 - _calp1 * _salp0,
+        cdalp = _calp1 * _calp0 + _salp1 * _salp0,
+        s = _salp1 * cdalp + _calp1 * sdalp,
+        c = _calp1 * cdalp - _salp1 * sdalp;
+      // Only use the result if it lies in (0, pi)
+      if (s > 0) { salp1 = s; calp1 = c; Math::norm(salp1, calp1); }
+    }
+  }
+
+  void Geodesic::InverseHint::record(int signs, real salp1, real calp1) {
+    if (_nsol > 0 && _signs == signs) {
+      _salp0 = _salp1; _calp0 = _calp1;
+      _nsol = 2;
+    } else
+      _nsol = 1;
+    _salp1 = salp1; _calp1 = calp1; _signs = signs;
+  }
+
+  void Geodesic::Inverse(size_t num, const real lat1[], const real lon1[],
+                         const real lat2[], const real lon2[],
+                         real s12[], real azi1[], real azi2[],
+                         real m12[], real M12[], real M21[],
+                         real S12[]) const {
+    unsigned outmask = (s12 ? DISTANCE : NONE) |
+      (azi1 || azi2 ? AZIMUTH : NONE) | (m12 ? REDUCEDLENGTH : NONE) |
+      (M12 || M21 ? GEODESICSCALE : NONE) | (S12 ? AREA : NONE);
+    real t;
+    for (size_t i = 0; i < num; ++i)
+      GenInverse(lat1[i], lon1[i], lat2[i], lon2[i], outmask,
+                 s12 ? s12[i] : t, azi1 ? azi1[i] : t, azi2 ? azi2[i] : t,
+                 m12 ? m12[i] : t, M12 ? M12[i] : t, M21 ? M21[i] : t,
+                 S12 ? S12[i] : t);
+  }
+
   GeodesicLine Geodesic::InverseLine(real lat1, real lon1,
                                      real lat2, real lon2,
                                      unsigned caps) const {
@@ -741,9 +741,13 @@ namespace GeographicLib {
         Math::norm(ssig1, csig1);
         Math::norm(ssig2, csig2);
         I4Integrand i4(_ep2, k2);
-        vector<real> C4a(_nC4);
-        _fft.transform(i4, C4a.data());
-        S12 = A4 * DST::integral(ssig1, csig1, ssig2, csig2, C4a.data(), _nC4);
+        // Use fixed storage for the coefficients if possible
+        real C4x[nC4x_];
+        vector<real> C4v(_nC4 > nC4x_ ? _nC4 : 0);
+        real* C4a = _nC4 > nC4x_ ? C4v.data() : C4x;
+        // Pass i4 by reference to avoid copying it to the heap
+        _fft.transform(cref(i4), C4a);
+        S12 = A4 * DST::integral(ssig1, csig1, ssig2, csig2, C4a, _nC4);
       } else
         // Avoid problems with indeterminate sig1, sig2 on equator
         S12 = 0;
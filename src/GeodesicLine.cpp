@@ -40,7 +40,7 @@ namespace GeographicLib {
   void GeodesicLine::LineInit(const Geodesic& g,
                               real lat1, real lon1,
                               real azi1, real salp1, real calp1,
-                              unsigned caps) {
+                              unsigned caps, bool coeffs) {
     tiny_ = g.tiny_;
     _lat1 = Math::LatFix(lat1);
     _lon1 = lon1;
@@ -91,8 +91,10 @@ namespace GeographicLib {
     real eps = _k2 / (2 * (1 + sqrt(1 + _k2)) + _k2);
 
     if (_caps & CAP_C1) {
-      _aA1m1 = Geodesic::A1m1f(eps);
-      Geodesic::C1f(eps, _cC1a);
+      if (coeffs) {
+        _aA1m1 = Geodesic::A1m1f(eps);
+        Geodesic::C1f(eps, _cC1a);
+      }
       _bB11 = Geodesic::SinCosSeries(true, _ssig1, _csig1, _cC1a, nC1_);
       real s = sin(_bB11), c = cos(_bB11);
       // tau1 = sig1 + B11
@@ -102,25 +104,31 @@ namespace GeographicLib {
       //    _bB11 = -SinCosSeries(true, _stau1, _ctau1, _cC1pa, nC1p_);
     }
 
-    if (_caps & CAP_C1p)
+    if (coeffs && (_caps & CAP_C1p))
       Geodesic::C1pf(eps, _cC1pa);
 
     if (_caps & CAP_C2) {
-      _aA2m1 = Geodesic::A2m1f(eps);
-      Geodesic::C2f(eps, _cC2a);
+      if (coeffs) {
+        _aA2m1 = Geodesic::A2m1f(eps);
+        Geodesic::C2f(eps, _cC2a);
+      }
       _bB21 = Geodesic::SinCosSeries(true, _ssig1, _csig1, _cC2a, nC2_);
     }
 
     if (_caps & CAP_C3) {
-      g.C3f(eps, _cC3a);
-      _aA3c = -_f * _salp0 * g.A3f(eps);
+      if (coeffs) {
+        g.C3f(eps, _cC3a);
+        _aA3c = -_f * _salp0 * g.A3f(eps);
+      }
       _bB31 = Geodesic::SinCosSeries(true, _ssig1, _csig1, _cC3a, nC3_-1);
     }
 
     if (_caps & CAP_C4) {
-      g.C4f(eps, _cC4a);
-      // Multiplier = a^2 * e^2 * cos(alpha0) * sin(alpha0)
-      _aA4 = Math::sq(_a) * _calp0 * _salp0 * g._e2;
+      if (coeffs) {
+        g.C4f(eps, _cC4a);
+        // Multiplier = a^2 * e^2 * cos(alpha0) * sin(alpha0)
+        _aA4 = Math::sq(_a) * _calp0 * _salp0 * g._e2;
+      }
       _bB41 = Geodesic::SinCosSeries(false, _ssig1, _csig1, _cC4a, nC4_);
     }
 
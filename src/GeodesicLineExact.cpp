@@ -117,9 +117,10 @@ namespace GeographicLib {
         _bB41 = 0;
       else {
         GeodesicExact::I4Integrand i4(g._ep2, _k2);
-        _cC4a.resize(_nC4);
-        g._fft.transform(i4, _cC4a.data());
-        _bB41 = DST::integral(_ssig1, _csig1, _cC4a.data(), _nC4);
+        if (_nC4 > GeodesicExact::nC4x_) _cC4v.resize(_nC4);
+        // Pass i4 by reference to avoid copying it to the heap
+        g._fft.transform(cref(i4), C4a());
+        _bB41 = DST::integral(_ssig1, _csig1, C4a(), _nC4);
       }
     }
 
@@ -241,7 +242,7 @@ namespace GeographicLib {
 
     if (outmask & AREA) {
       real B42 = _aA4 == 0 ? 0 :
-        DST::integral(ssig2, csig2, _cC4a.data(), _nC4);
+        DST::integral(ssig2, csig2, C4a(), _nC4);
       real salp12, calp12;
       if (_calp0 == 0 || _salp0 == 0) {
         // alp12 = alp2 - alp1, used in atan2 so no need to normalize
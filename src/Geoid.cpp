@@ -2,7 +2,7 @@
  * \file Geoid.cpp
  * \brief Implementation for GeographicLib::Geoid class
  *
- * Copyright (c) Charles Karney (2009-2020) <karney@alum.mit.edu> and licensed
+ * Copyright (c) Charles Karney (2009-2026) <karney@alum.mit.edu> and licensed
  * under the MIT/X11 License.  For more information, see
  * https://geographiclib.sourceforge.io/
  **********************************************************************/
@@ -392,6 +392,12 @@ namespace GeographicLib {
     }
   }
 
+  void Geoid::operator()(size_t num, const real lat[], const real lon[],
+                         real h[]) const {
+    for (size_t i = 0; i < num; ++i)
+      h[i] = height(lat[i], lon[i]);
+  }
+
   void Geoid::CacheClear() const {
     if (!_threadsafe) {
       _cache = false;
@@ -2,7 +2,7 @@
  * \file GravityModel.cpp
  * \brief Implementation for GeographicLib::GravityModel class
  *
- * Copyright (c) Charles Karney (2011-2023) <karney@alum.mit.edu> and licensed
+ * Copyright (c) Charles Karney (2011-2026) <karney@alum.mit.edu> and licensed
  * under the MIT/X11 License.  For more information, see
  * https://geographiclib.sourceforge.io/
  **********************************************************************/
@@ -309,6 +309,32 @@ namespace GeographicLib {
     Geocentric::Unrotate(M, gx, gy, gz, gx, gy, gz);
     return Wres;
   }
+
+  void GravityModel::Gravity(size_t num, const real lat[], const real lon[],
+                             const real h[], real gx[], real gy[], real gz[],
+                             real W[]) const {
+    const size_t blk = 64;
+    real X[blk], Y[blk], Z[blk], M[blk * Geocentric::dim2_];
+    for (size_t i0 = 0; i0 < num; i0 += blk) {
+      size_t n = min(blk, num - i0);
+      _earth.Earth().Forward(n, lat + i0, lon + i0, h + i0, X, Y, Z, M);
+      for (size_t j = 0; j < n; ++j) {
+        size_t i = i0 + j;
+        real Wres = this->W(X[j], Y[j], Z[j], gx[i], gy[i], gz[i]);
+        Geocentric::Unrotate(M + Geocentric::dim2_ * j, gx[i], gy[i], gz[i],
+                             gx[i], gy[i], gz[i]);
+        if (W) W[i] = Wres;
+      }
+    }
+  }
+
+  void GravityModel::GeoidHeight(size_t num,
+                                 const real lat[], const real lon[],
+                                 real N[]) const {
+    for (size_t i = 0; i < num; ++i)
+      N[i] = GeoidHeight(lat[i], lon[i]);
+  }
+
   Math::real GravityModel::Disturbance(real lat, real lon, real h,
                                        real& deltax, real& deltay,
                                        real& deltaz) const {
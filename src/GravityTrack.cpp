@@ -0,0 +1,151 @@
+/**
+ * \file GravityTrack.cpp
+ * \brief Implementation for GeographicLib::GravityTrack class
+ *
+ * Copyright (c) Charles Karney (2026) <karney@alum.mit.edu> and licensed
+ * under the MIT/X11 License.  For more information, see
+ * https://geographiclib.sourceforge.io/
+ **********************************************************************/
+
+#include <GeographicLib/GravityTrack.hpp>
+#include <limits>
+
+namespace GeographicLib {
+
+  using namespace std;
+
+  GravityTrack::GravityTrack(const GravityModel& grav, real h, real eps,
+                             unsigned caps, int maxcircles)
+    : _grav(grav)
+    , _h(h)
+    , _eps(eps)
+    , _caps(caps)
+    , _maxcircles(maxcircles)
+  {
+    if (!(isfinite(_eps) && _eps >= numeric_limits<real>::epsilon()))
+      throw GeographicErr("Accuracy is less than machine epsilon");
+    if (!(_maxcircles >= 4))
+      throw GeographicErr("Cache must hold at least 4 circles");
+    // Spacing (in radians) for which the error in cubic interpolation of a
+    // trigonometric polynomial of degree N+1 is bounded by eps.  The error
+    // term is f''''(lat)/24 * dlat^4 * prod(u - u_i); max|prod| is 9/16 for
+    // the centered stencil but 1 for the one-sided stencils in the
+    // intervals next to the poles, so use the latter bound.
+    real dlat = pow(24 * _eps, real(0.25)) / (_grav.Degree() + 1);
+    // Divide [-90,90] into an integer number of intervals; need at least 3
+    // intervals for a 4-point stencil.
+    real nlat = ceil(Math::hd / (dlat / Math::degree()));
+    // Guard against overflow in the conversion to int (which would need a
+    // model of degree exceeding 10^5).
+    if (!(nlat < real(numeric_limits<int>::max())))
+      throw GeographicErr("Accuracy is too small for the degree of the model");
+    _nlat = max(3, int(nlat));
+    _dlat = real(Math::hd) / _nlat;
+    _ind.reserve(_maxcircles);
+    _circ.reserve(_maxcircles);
+  }
+
+  const GravityCircle& GravityTrack::Circle(int i, int i0) {
+    int n = int(_ind.size()), k = 0;
+    for (; k < n; ++k)
+      if (_ind[k] == i) return _circ[k];
+    // Not in cache, so create it with the latitude exactly +/-90 at the
+    // poles.
+    real lat = i == _nlat ? real(Math::qd) : -Math::qd + i * _dlat;
+    if (n < _maxcircles) {
+      _ind.push_back(i);
+      _circ.push_back(_grav.Circle(lat, _h, _caps));
+      return _circ.back();
+    }
+    // Replace the circle furthest from the requested one (the track is
+    // unlikely to return there soon) excluding the members of the current
+    // stencil, i0 .. i0+3.  Because _maxcircles >= 4, there is always at
+    // least one candidate.
+    int kmax = -1;
+    for (k = 0; k < n; ++k)
+      if (!(_ind[k] >= i0 && _ind[k] < i0 + 4) &&
+          (kmax < 0 || abs(_ind[k] - i) > abs(_ind[kmax] - i)))
+        kmax = k;
+    _ind[kmax] = i;
+    _circ[kmax] = _grav.Circle(lat, _h, _caps);
+    return _circ[kmax];
+  }
+
+  void GravityTrack::Stencil(real lat, const GravityCircle* c[], real w[]) {
+    real x = (Math::LatFix(lat) + Math::qd) / _dlat;
+    // Use the stencil i0 .. i0+3 centered on x, shifting it at the poles.
+    int i0 = isfinite(x) ? max(0, min(_nlat - 3, int(floor(x)) - 1)) : 0;
+    real u = x - i0;
+    // Lagrange weights for nodes at 0, 1, 2, 3
+    w[0] = -(u - 1) * (u - 2) * (u - 3) / 6;
+    w[1] =   u      * (u - 2) * (u - 3) / 2;
+    w[2] = - u      * (u - 1) * (u - 3) / 2;
+    w[3] =   u      * (u - 1) * (u - 2) / 6;
+    // Pointers into _circ remain valid because _circ never reallocates
+    // (capacity is reserved in the constructor) and members of the stencil
+    // are never evicted while the stencil is being filled.
+    for (int k = 0; k < 4; ++k)
+      c[k] = &Circle(i0 + k, i0);
+  }
+
+  Math::real GravityTrack::Gravity(real lat, real lon,
+                                   real& gx, real& gy, real& gz) {
+    const GravityCircle* c[4]; real w[4];
+    Stencil(lat, c, w);
+    real W = 0; gx = gy = gz = 0;
+    for (int k = 0; k < 4; ++k) {
+      real x, y, z;
+      W += w[k] * c[k]->Gravity(lon, x, y, z);
+      gx += w[k] * x; gy += w[k] * y; gz += w[k] * z;
+    }
+    return W;
+  }
+
+  Math::real GravityTrack::Disturbance(real lat, real lon,
+                                       real& deltax, real& deltay,
+                                       real& deltaz) {
+    const GravityCircle* c[4]; real w[4];
+    Stencil(lat, c, w);
+    real T = 0; deltax = deltay = deltaz = 0;
+    for (int k = 0; k < 4; ++k) {
+      real x, y, z;
+      T += w[k] * c[k]->Disturbance(lon, x, y, z);
+      deltax += w[k] * x; deltay += w[k] * y; deltaz += w[k] * z;
+    }
+    return T;
+  }
+
+  Math::real GravityTrack::GeoidHeight(real lat, real lon) {
+    const GravityCircle* c[4]; real w[4];
+    Stencil(lat, c, w);
+    real N = 0;
+    for (int k = 0; k < 4; ++k)
+      N += w[k] * c[k]->GeoidHeight(lon);
+    return N;
+  }
+
+  void GravityTrack::Gravity(size_t num, const real lat[], const real lon[],
+                             real gx[], real gy[], real gz[], real W[]) {
+    for (size_t i = 0; i < num; ++i) {
+      real w = Gravity(lat[i], lon[i], gx[i], gy[i], gz[i]);
+      if (W) W[i] = w;
+    }
+  }
+
+  void GravityTrack::Disturbance(size_t num, const real lat[],
+                                 const real lon[],
+                                 real deltax[], real deltay[], real deltaz[],
+                                 real T[]) {
+    for (size_t i = 0; i < num; ++i) {
+      real t = Disturbance(lat[i], lon[i], deltax[i], deltay[i], deltaz[i]);
+      if (T) T[i] = t;
+    }
+  }
+
+  void GravityTrack::GeoidHeight(size_t num, const real lat[],
+                                 const real lon[], real N[]) {
+    for (size_t i = 0; i < num; ++i)
+      N[i] = GeoidHeight(lat[i], lon[i]);
+  }
+
+} // namespace GeographicLib
@@ -0,0 +1,95 @@
+/**
+ * \file Helmert.cpp
+ * \brief Implementation for GeographicLib::Helmert class
+ *
+ * Copyright (c) Charles Karney (2026) <karney@alum.mit.edu> and licensed under
+ * the MIT/X11 License.  For more information, see
+ * https://geographiclib.sourceforge.io/
+ **********************************************************************/
+
+#include <GeographicLib/Helmert.hpp>
+
+using namespace std;
+
+namespace GeographicLib {
+
+  Helmert::Helmert() {
+    for (size_t i = 0; i < dim_; ++i) _t[i] = 0;
+    for (size_t i = 0; i < dim2_; ++i) _m[i] = _mi[i] = 0;
+  }
+
+  Helmert::Helmert(real tx, real ty, real tz, real rx, real ry, real rz,
+                   real s, bool coordframe) {
+    if (!(isfinite(tx) && isfinite(ty) && isfinite(tz) &&
+          isfinite(rx) && isfinite(ry) && isfinite(rz) && isfinite(s)))
+      throw GeographicErr("Helmert parameters must be finite");
+    // Convert arcseconds to radians and ppm to a fraction
+    real c = (coordframe ? -1 : 1) * Math::degree() / 3600;
+    rx *= c; ry *= c; rz *= c; s /= 1000000;
+    _t[0] = tx; _t[1] = ty; _t[2] = tz;
+    // Store _m = (1 + s) * R - I which is small; this preserves the
+    // precision of the result.
+    real r[dim2_] = {  1, -rz,  ry,
+                      rz,   1, -rx,
+                     -ry,  rx,   1 };
+    for (size_t i = 0; i < dim2_; ++i)
+      _m[i] = (1 + s) * r[i] - (i % (dim_ + 1) == 0 ? 1 : 0);
+    // a = I + _m and its inverse via the adjugate; then _mi = a^-1 - I =
+    // -a^-1 * _m, also small.
+    real a[dim2_], ai[dim2_];
+    for (size_t i = 0; i < dim2_; ++i)
+      a[i] = _m[i] + (i % (dim_ + 1) == 0 ? 1 : 0);
+    ai[0] = a[4] * a[8] - a[5] * a[7];
+    ai[1] = a[2] * a[7] - a[1] * a[8];
+    ai[2] = a[1] * a[5] - a[2] * a[4];
+    ai[3] = a[5] * a[6] - a[3] * a[8];
+    ai[4] = a[0] * a[8] - a[2] * a[6];
+    ai[5] = a[2] * a[3] - a[0] * a[5];
+    ai[6] = a[3] * a[7] - a[4] * a[6];
+    ai[7] = a[1] * a[6] - a[0] * a[7];
+    ai[8] = a[0] * a[4] - a[1] * a[3];
+    real det = a[0] * ai[0] + a[1] * ai[3] + a[2] * ai[6];
+    for (size_t i = 0; i < dim_; ++i)
+      for (size_t j = 0; j < dim_; ++j) {
+        real t = 0;
+        for (size_t k = 0; k < dim_; ++k)
+          t += ai[dim_ * i + k] * _m[dim_ * k + j];
+        _mi[dim_ * i + j] = -t / det;
+      }
+  }
+
+  void Helmert::Forward(real X, real Y, real Z,
+                        real& Xo, real& Yo, real& Zo) const {
+    Forward(1, &X, &Y, &Z, &Xo, &Yo, &Zo);
+  }
+
+  void Helmert::Reverse(real X, real Y, real Z,
+                        real& Xo, real& Yo, real& Zo) const {
+    Reverse(1, &X, &Y, &Z, &Xo, &Yo, &Zo);
+  }
+
+  void Helmert::Forward(size_t num,
+                        const real X[], const real Y[], const real Z[],
+                        real Xo[], real Yo[], real Zo[]) const {
+    const real* m = _m;
+    for (size_t i = 0; i < num; ++i) {
+      real x = X[i], y = Y[i], z = Z[i];
+      Xo[i] = x + (_t[0] + (m[0] * x + m[1] * y + m[2] * z));
+      Yo[i] = y + (_t[1] + (m[3] * x + m[4] * y + m[5] * z));
+      Zo[i] = z + (_t[2] + (m[6] * x + m[7] * y + m[8] * z));
+    }
+  }
+
+  void Helmert::Reverse(size_t num,
+                        const real X[], const real Y[], const real Z[],
+                        real Xo[], real Yo[], real Zo[]) const {
+    const real* m = _mi;
+    for (size_t i = 0; i < num; ++i) {
+      real x = X[i] - _t[0], y = Y[i] - _t[1], z = Z[i] - _t[2];
+      Xo[i] = x + (m[0] * x + m[1] * y + m[2] * z);
+      Yo[i] = y + (m[3] * x + m[4] * y + m[5] * z);
+      Zo[i] = z + (m[6] * x + m[7] * y + m[8] * z);
+    }
+  }
+
+} // namespace GeographicLib
@@ -0,0 +1,139 @@
+/**
+ * \file JacobiConformal.cpp
+ * \brief Implementation for GeographicLib::JacobiConformal class
+ *
+ * Copyright (c) Charles Karney (2014-2026) <karney@alum.mit.edu> and licensed
+ * under the MIT/X11 License.  For more information, see
+ * https://geographiclib.sourceforge.io/
+ **********************************************************************/
+
+#include <GeographicLib/JacobiConformal.hpp>
+#include <GeographicLib/AuxLatitude.hpp>
+
+namespace GeographicLib {
+
+  using namespace std;
+
+  JacobiConformal::JacobiConformal(real a, real b, real c)
+    : _a(a), _b(b), _c(c)
+    , _ab2((_a - _b) * (_a + _b))
+    , _bc2((_b - _c) * (_b + _c))
+    , _ac2((_a - _c) * (_a + _c))
+    , _ex(_ab2 / _ac2 * Math::sq(_c / _b), -_ab2 / Math::sq(_b),
+          _bc2 / _ac2 * Math::sq(_a / _b), Math::sq(_a / _b))
+    , _ey(_bc2 / _ac2 * Math::sq(_a / _b), +_bc2 / Math::sq(_b),
+          _ab2 / _ac2 * Math::sq(_c / _b), Math::sq(_c / _b))
+  {
+    if (!(isfinite(_a) && _a >= _b && _b >= _c && _c > 0))
+      throw GeographicErr("JacobiConformal: axes are not in order");
+    if (!(_a > _c))
+      throw GeographicErr
+        ("JacobiConformal: use alternate constructor for sphere");
+    series(_ex, _fx);
+    series(_ey, _fy);
+  }
+
+  JacobiConformal::JacobiConformal(real a, real b, real c, real ab, real bc)
+    : _a(a), _b(b), _c(c)
+    , _ab2(ab * (_a + _b))
+    , _bc2(bc * (_b + _c))
+    , _ac2(_ab2 + _bc2)
+    , _ex(_ab2 / _ac2 * Math::sq(_c / _b),
+          -(_a - _b) * (_a + _b) / Math::sq(_b),
+          _bc2 / _ac2 * Math::sq(_a / _b), Math::sq(_a / _b))
+    , _ey(_bc2 / _ac2 * Math::sq(_a / _b),
+          +(_b - _c) * (_b + _c) / Math::sq(_b),
+          _ab2 / _ac2 * Math::sq(_c / _b), Math::sq(_c / _b))
+  {
+    if (!(isfinite(_a) && _a >= _b && _b >= _c && _c > 0 &&
+          ab >= 0 && bc >= 0))
+      throw GeographicErr("JacobiConformal: axes are not in order");
+    if (!(ab + bc > 0 && isfinite(_ac2)))
+      throw GeographicErr("JacobiConformal: ab + bc must be positive");
+    series(_ex, _fx);
+    series(_ey, _fy);
+  }
+
+  void JacobiConformal::series(const EllipticFunction& e, vector<real>& F) {
+    // Find the coefficients F[l] of the sine series for the periodic
+    // function (period pi)
+    //   e.deltaPi(phi) = sum(F[l] * sin((2*l+2)*phi), l, 0, K-1)
+    // using the trapezoidal rule with M = 2*K equally spaced samples.  K is
+    // doubled (reusing the existing samples) until the coefficients in the
+    // upper half of the range are negligible.  The sines are looked up in a
+    // table indexed by (l+1)*j mod M to avoid the accumulation of roundoff
+    // with a recurrence.
+    const int Kmin = 16, Kmax = 1024;
+    const real tol = numeric_limits<real>::epsilon();
+    vector<real> f, g, s;
+    for (int K = Kmin; K <= Kmax; K *= 2) {
+      int M = 2 * K;
+      g.resize(M);
+      for (int j = 0; j < M; ++j) {
+        if (j % 2 == 0 && !f.empty())
+          g[j] = f[j/2];
+        else {
+          real sn, cn;
+          Math::sincosd(real(Math::hd) * j / M, sn, cn);
+          g[j] = e.deltaPi(sn, cn, e.Delta(sn, cn));
+        }
+      }
+      f.swap(g);
+      s.resize(M);
+      for (int j = 0; j < M; ++j)
+        s[j] = Math::sind(real(Math::td) * j / M);
+      F.resize(K);
+      real err = 0;
+      for (int l = 0; l < K; ++l) {
+        real t = 0;
+        for (int j = 1; j < M; ++j)
+          t += f[j] * s[(l + 1) * j % M];
+        F[l] = 2 * t / M;
+        if (2 * l >= K) err = fmax(err, fabs(F[l]));
+      }
+      if (err <= tol) {
+        // Drop the negligible trailing coefficients
+        while (K > 0 && fabs(F[K - 1]) <= tol) --K;
+        F.resize(K);
+        return;
+      }
+    }
+    // Not converged (or NaNs in the samples); use direct evaluation
+    F.clear();
+  }
+
+  void JacobiConformal::project(size_t num, const real ang[], real s, real c,
+                                real m, const EllipticFunction& e,
+                                const vector<real>& F, real proj[]) {
+    // The angle ang is mapped to phi = atan2(s * sin(ang), c * cos(ang)) and
+    // the result is m * Pi(phi) (in degrees).  With the Fourier series,
+    //   Pi(phi) = (phi + deltaPi(phi)) * Pi / (pi/2)
+    real sn[blk_], cn[blk_], d[blk_];
+    real q = m * e.Pi() / (Math::pi()/2);
+    for (size_t i0 = 0; i0 < num; i0 += blk_) {
+      size_t n = min(size_t(blk_), num - i0);
+      Math::sincosd(n, ang + i0, sn, cn);
+      for (size_t j = 0; j < n; ++j) {
+        sn[j] *= s; cn[j] *= c; norm(sn[j], cn[j]);
+      }
+      if (F.empty()) {
+        for (size_t j = 0; j < n; ++j)
+          proj[i0 + j] = m * e.Pi(sn[j], cn[j], e.Delta(sn[j], cn[j]))
+            / Math::degree();
+      } else {
+        AuxLatitude::Clenshaw(n, true, sn, cn, F.data(), int(F.size()), d);
+        for (size_t j = 0; j < n; ++j)
+          proj[i0 + j] = q * (atan2(sn[j], cn[j]) + d[j]) / Math::degree();
+      }
+    }
+  }
+
+  void JacobiConformal::x(size_t num, const real omg[], real X[]) const {
+    project(num, omg, _b, _a, Math::sq(_a / _b), _ex, _fx, X);
+  }
+
+  void JacobiConformal::y(size_t num, const real bet[], real Y[]) const {
+    project(num, bet, _b, _c, Math::sq(_c / _b), _ey, _fy, Y);
+  }
+
+} // namespace GeographicLib
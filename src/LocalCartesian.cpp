@@ -59,4 +59,107 @@ namespace GeographicLib {
       MatrixMultiply(M);
   }
 
+  void LocalCartesian::Forward(size_t num, const real lat[],
+                               const real lon[], const real h[],
+                               real x[], real y[], real z[],
+                               real M[]) const {
+    // Copy the origin and the rotation matrix to local variables so that the
+    // compiler can keep them in registers.
+    const real x0 = _x0, y0 = _y0, z0 = _z0,
+      r0 = _r[0], r1 = _r[1], r2 = _r[2],
+      r3 = _r[3], r4 = _r[4], r5 = _r[5],
+      r6 = _r[6], r7 = _r[7], r8 = _r[8];
+    const size_t blk = 64;
+    real xc[blk], yc[blk], zc[blk];
+    for (size_t i0 = 0; i0 < num; i0 += blk) {
+      size_t n = min(blk, num - i0);
+      _earth.Forward(n, lat + i0, lon + i0, h + i0, xc, yc, zc,
+                     M ? M + dim2_ * i0 : nullptr);
+      for (size_t j = 0; j < n; ++j) {
+        size_t i = i0 + j;
+        real X = xc[j] - x0, Y = yc[j] - y0, Z = zc[j] - z0;
+        x[i] = r0 * X + r3 * Y + r6 * Z;
+        y[i] = r1 * X + r4 * Y + r7 * Z;
+        z[i] = r2 * X + r5 * Y + r8 * Z;
+      }
+      if (M)
+        for (size_t j = 0; j < n; ++j)
+          MatrixMultiply(M + dim2_ * (i0 + j));
+    }
+  }
+
+  void LocalCartesian::Reverse(size_t num,
+                               const real x[], const real y[], const real z[],
+                               real lat[], real lon[], real h[],
+                               real M[]) const {
+    const size_t blk = 64;
+    real xc[blk], yc[blk], zc[blk];
+    for (size_t i0 = 0; i0 < num; i0 += blk) {
+      size_t n = min(blk, num - i0);
+      ToGeocentric(n, x + i0, y + i0, z + i0, xc, yc, zc);
+      _earth.Reverse(n, xc, yc, zc, lat + i0, lon + i0, h + i0,
+                     M ? M + dim2_ * i0 : nullptr);
+      if (M)
+        for (size_t j = 0; j < n; ++j)
+          MatrixMultiply(M + dim2_ * (i0 + j));
+    }
+  }
+
+  void LocalCartesian::FromGeocentric(size_t num, const real X[],
+                                      const real Y[], const real Z[],
+                                      real x[], real y[], real z[]) const {
+    const real x0 = _x0, y0 = _y0, z0 = _z0,
+      r0 = _r[0], r1 = _r[1], r2 = _r[2],
+      r3 = _r[3], r4 = _r[4], r5 = _r[5],
+      r6 = _r[6], r7 = _r[7], r8 = _r[8];
+    for (size_t i = 0; i < num; ++i) {
+      real xc = X[i] - x0, yc = Y[i] - y0, zc = Z[i] - z0;
+      x[i] = r0 * xc + r3 * yc + r6 * zc;
+      y[i] = r1 * xc + r4 * yc + r7 * zc;
+      z[i] = r2 * xc + r5 * yc + r8 * zc;
+    }
+  }
+
+  void LocalCartesian::ToGeocentric(size_t num, const real x[],
+                                    const real y[], const real z[],
+                                    real X[], real Y[], real Z[]) const {
+    const real x0 = _x0, y0 = _y0, z0 = _z0,
+      r0 = _r[0], r1 = _r[1], r2 = _r[2],
+      r3 = _r[3], r4 = _r[4], r5 = _r[5],
+      r6 = _r[6], r7 = _r[7], r8 = _r[8];
+    for (size_t i = 0; i < num; ++i) {
+      real xi = x[i], yi = y[i], zi = z[i];
+      X[i] = x0 + r0 * xi + r1 * yi + r2 * zi;
+      Y[i] = y0 + r3 * xi + r4 * yi + r5 * zi;
+      Z[i] = z0 + r6 * xi + r7 * yi + r8 * zi;
+    }
+  }
+
+  void LocalCartesian::FromLocal(const LocalCartesian& from, size_t num,
+                                 const real x[], const real y[],
+                                 const real z[],
+                                 real xo[], real yo[], real zo[]) const {
+    // xo = r' . (from.r . x + from.x0 - x0) = c . x + t
+    real c[dim2_], t[dim_],
+      d[dim_] = {from._x0 - _x0, from._y0 - _y0, from._z0 - _z0};
+    for (size_t k = 0; k < dim2_; ++k) {
+      size_t row = k / dim_, col = k % dim_;
+      c[k] = _r[row] * from._r[col] + _r[row+3] * from._r[col+3] +
+        _r[row+6] * from._r[col+6];
+    }
+    for (size_t k = 0; k < dim_; ++k)
+      t[k] = _r[k] * d[0] + _r[k+3] * d[1] + _r[k+6] * d[2];
+    const real
+      c0 = c[0], c1 = c[1], c2 = c[2],
+      c3 = c[3], c4 = c[4], c5 = c[5],
+      c6 = c[6], c7 = c[7], c8 = c[8],
+      t0 = t[0], t1 = t[1], t2 = t[2];
+    for (size_t i = 0; i < num; ++i) {
+      real xi = x[i], yi = y[i], zi = z[i];
+      xo[i] = t0 + c0 * xi + c1 * yi + c2 * zi;
+      yo[i] = t1 + c3 * xi + c4 * yi + c5 * zi;
+      zo[i] = t2 + c6 * xi + c7 * yi + c8 * zi;
+    }
+  }
+
 } // namespace GeographicLib
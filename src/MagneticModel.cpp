@@ -11,6 +11,7 @@
 #include <fstream>
 #include <GeographicLib/SphericalEngine.hpp>
 #include <GeographicLib/MagneticCircle.hpp>
+#include <GeographicLib/MagneticPoint.hpp>
 #include <GeographicLib/Utility.hpp>
 
 #if !defined(GEOGRAPHICLIB_DATA)
@@ -251,6 +252,39 @@ namespace GeographicLib {
                            _harm[_nNmodels + 1].Circle(X, Z, true)));
   }
 
+  MagneticPoint MagneticModel::Point(real lat, real lon, real h) const {
+    real X, Y, Z, M[Geocentric::dim2_];
+    _earth.IntForward(lat, lon, h, X, Y, Z, M);
+    // Evaluate the field for each epoch (and the constant term) in the local
+    // basis; because the models are linear in time, this is all that's
+    // needed to evaluate the field at any time.
+    vector<real> F(3 * (_nNmodels + 1)), C(3, 0);
+    for (int i = 0; i <= _nNmodels; ++i) {
+      real BX, BY, BZ;
+      _harm[i](X, Y, Z, BX, BY, BZ);
+      Geocentric::Unrotate(M, BX, BY, BZ, F[3*i], F[3*i+1], F[3*i+2]);
+    }
+    if (_nNconstants) {
+      real BX, BY, BZ;
+      _harm[_nNmodels + 1](X, Y, Z, BX, BY, BZ);
+      Geocentric::Unrotate(M, BX, BY, BZ, C[0], C[1], C[2]);
+    }
+    vector<real> B(3 * _nNmodels), Bt(3 * _nNmodels);
+    for (int n = 0; n < _nNmodels; ++n) {
+      bool interpolate = n + 1 < _nNmodels;
+      for (int k = 0; k < 3; ++k) {
+        real b = F[3*n + k], bt = F[3*(n+1) + k];
+        if (interpolate)
+          // Convert to a time derivative
+          bt = (bt - b) / _dt0;
+        B[3*n + k] = (b + C[k]) * - _a;
+        Bt[3*n + k] = bt * - _a;
+      }
+    }
+    return MagneticPoint(_a, _earth._f, lat, lon, h, _t0, _dt0, _nNmodels,
+                         M, B, Bt);
+  }
+
   void MagneticModel::FieldComponents(real Bx, real By, real Bz,
                                       real Bxt, real Byt, real Bzt,
                                       real& H, real& F, real& D, real& I,
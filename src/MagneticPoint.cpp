@@ -0,0 +1,51 @@
+/**
+ * \file MagneticPoint.cpp
+ * \brief Implementation for GeographicLib::MagneticPoint class
+ *
+ * Copyright (c) Charles Karney (2026) <karney@alum.mit.edu> and licensed
+ * under the MIT/X11 License.  For more information, see
+ * https://geographiclib.sourceforge.io/
+ **********************************************************************/
+
+#include <GeographicLib/MagneticPoint.hpp>
+#include <GeographicLib/Geocentric.hpp>
+
+namespace GeographicLib {
+
+  using namespace std;
+
+  int MagneticPoint::Interval(real& t) const {
+    t -= _t0;
+    int n = max(min(int(floor(t / _dt0)), _nNmodels - 1), 0);
+    t -= n * _dt0;
+    return n;
+  }
+
+  void MagneticPoint::operator()(size_t num, const real t[],
+                                 real Bx[], real By[], real Bz[],
+                                 real Bxt[], real Byt[], real Bzt[]) const {
+    bool diffp = Bxt && Byt && Bzt;
+    for (size_t i = 0; i < num; ++i) {
+      real t1 = t[i];
+      int n = 3 * Interval(t1);
+      Bx[i] = _bB[n + 0] + t1 * _bBt[n + 0];
+      By[i] = _bB[n + 1] + t1 * _bBt[n + 1];
+      Bz[i] = _bB[n + 2] + t1 * _bBt[n + 2];
+      if (diffp) {
+        Bxt[i] = _bBt[n + 0];
+        Byt[i] = _bBt[n + 1];
+        Bzt[i] = _bBt[n + 2];
+      }
+    }
+  }
+
+  void MagneticPoint::FieldGeocentric(real t,
+                                      real& BX, real& BY, real& BZ,
+                                      real& BXt, real& BYt, real& BZt) const {
+    real Bx, By, Bz, Bxt, Byt, Bzt;
+    operator()(t, Bx, By, Bz, Bxt, Byt, Bzt);
+    Geocentric::Rotate(_mM, Bx, By, Bz, BX, BY, BZ);
+    Geocentric::Rotate(_mM, Bxt, Byt, Bzt, BXt, BYt, BZt);
+  }
+
+} // namespace GeographicLib
@@ -2,7 +2,7 @@
  * \file Math.cpp
  * \brief Implementation for GeographicLib::Math class
  *
- * Copyright (c) Charles Karney (2015-2022) <karney@alum.mit.edu> and licensed
+ * Copyright (c) Charles Karney (2015-2026) <karney@alum.mit.edu> and licensed
  * under the MIT/X11 License.  For more information, see
  * https://geographiclib.sourceforge.io/
  **********************************************************************/
@@ -18,6 +18,36 @@ namespace GeographicLib {
 
   using namespace std;
 
+  namespace {
+
+    // Exactly reduce x to r = x - n * y, where n is the integer nearest x/y
+    // (with ties going to even n), as with remquo and remainder; r = 0 is
+    // given the sign of x.  This requires |x| < 2^22 and y = 90 or 360.  The
+    // corrections are written as selections so that loops which call this
+    // can be vectorized.
+    template<typename T> inline T reduce(T x, T y, int& n) {
+      // Truncated quotient; y * m is an integer and so r is exact with |r| <
+      // y.  At most one correction is then needed to get |r| <= y/2.
+      int m = int(x / y);
+      T r = x - y * T(m), h = y / 2;
+      m += (r > h ? 1 : 0) - (r < -h ? 1 : 0);
+      r = r > h ? r - y : (r < -h ? r + y : r);
+      bool odd = fabs(r) == h && (m & 1) != 0;
+      m += odd ? (r > 0 ? 1 : -1) : 0;
+      r = odd ? -r : r;
+      n = m;
+      return r == 0 ? copysign(r, x) : r;
+    }
+
+    // The array versions of the angle functions use reduce for arguments
+    // below this limit and the scalar versions otherwise.
+    template<typename T> inline T reducelim() { return T(1 << 22); }
+
+    // The array versions process blocks of this many elements
+    const size_t angblk_ = 64;
+
+  } // namespace
+
   void Math::dummy() {
     static_assert(GEOGRAPHICLIB_PRECISION >= 1 && GEOGRAPHICLIB_PRECISION <= 5,
                   "Bad value of precision");
@@ -94,6 +124,79 @@ namespace GeographicLib {
     return d;
   }
 
+  template<typename T> void Math::AngNormalize(size_t num, const T x[],
+                                              T y[]) {
+    // Copy the block of x so that y can be the same as x
+    T xv[angblk_];
+    for (size_t i0 = 0; i0 < num; i0 += angblk_) {
+      size_t n = min(angblk_, num - i0);
+      bool scalar = false;
+      for (size_t j = 0; j < n; ++j) {
+        T xj = x[i0 + j];
+        bool ok = fabs(xj) < reducelim<T>();
+        int q;
+        T yj = reduce(ok ? xj : T(0), T(td), q);
+        xv[j] = xj;
+        y[i0 + j] = fabs(yj) == T(hd) ? copysign(T(hd), xj) : yj;
+        scalar = scalar || !ok;
+      }
+      if (scalar)
+        for (size_t j = 0; j < n; ++j)
+          if (!(fabs(xv[j]) < reducelim<T>()))
+            y[i0 + j] = AngNormalize(xv[j]);
+    }
+  }
+
+  template<typename T> void Math::AngDiff(size_t num,
+                                         const T x[], const T y[],
+                                         T d[], T e[]) {
+    // The same as the scalar version with remainder replaced by reduce and
+    // with Math::sum written out.
+    T xv[angblk_], yv[angblk_];
+    for (size_t i0 = 0; i0 < num; i0 += angblk_) {
+      size_t n = min(angblk_, num - i0);
+      bool scalar = false;
+      for (size_t j = 0; j < n; ++j) {
+        size_t i = i0 + j;
+        T xj = x[i], yj = y[i];
+        bool ok = fabs(xj) < reducelim<T>() && fabs(yj) < reducelim<T>();
+        int q;
+        T u = reduce(ok ? -xj : T(0), T(td), q),
+          v = reduce(ok ?  yj : T(0), T(td), q);
+        GEOGRAPHICLIB_VOLATILE T s = u + v;
+        GEOGRAPHICLIB_VOLATILE T up = s - v;
+        GEOGRAPHICLIB_VOLATILE T vpp = s - up;
+        up -= u;
+        vpp -= v;
+        T t = s != 0 ? T(0) - (up + vpp) : s;
+        // As in the scalar version, |s| <= 360 and the second sum can't
+        // change the reduced value enough to need another reduction.
+        u = reduce(T(s), T(td), q);
+        s = u + t;
+        up = s - t;
+        vpp = s - up;
+        up -= u;
+        vpp -= t;
+        t = s != 0 ? T(0) - (up + vpp) : s;
+        T dj = s;
+        dj = dj == 0 || fabs(dj) == T(hd) ?
+          copysign(dj, t == 0 ? yj - xj : -t) : dj;
+        xv[j] = xj; yv[j] = yj;
+        d[i] = dj;
+        if (e) e[i] = t;
+        scalar = scalar || !ok;
+      }
+      if (scalar)
+        for (size_t j = 0; j < n; ++j)
+          if (!(fabs(xv[j]) < reducelim<T>() && fabs(yv[j]) < reducelim<T>()))
+            {
+              T t;
+              d[i0 + j] = AngDiff(xv[j], yv[j], t);
+              if (e) e[i0 + j] = t;
+            }
+    }
+  }
+
   template<typename T> T Math::AngRound(T x) {
     static const T z = T(1)/T(16);
     GEOGRAPHICLIB_VOLATILE T y = fabs(x);
@@ -123,6 +226,43 @@ namespace GeographicLib {
     if (sinx == 0) sinx = copysign(sinx, x); // special values from F.10.1.13
   }
 
+  template<typename T> void Math::sincosd(size_t num, const T x[],
+                                         T sinx[], T cosx[]) {
+    // The same as the scalar version except that the reduction, the
+    // evaluation of sin and cos, and the assignment to the quadrants are
+    // done in separate loops over a block of values.
+    T xv[angblk_], r[angblk_], s[angblk_], c[angblk_];
+    int q[angblk_];
+    for (size_t i0 = 0; i0 < num; i0 += angblk_) {
+      size_t n = min(angblk_, num - i0);
+      bool scalar = false;
+      for (size_t j = 0; j < n; ++j) {
+        T xj = x[i0 + j];
+        bool ok = fabs(xj) < reducelim<T>();
+        xv[j] = xj;
+        r[j] = reduce(ok ? xj : T(0), T(qd), q[j]) * degree<T>();
+        scalar = scalar || !ok;
+      }
+      for (size_t j = 0; j < n; ++j) {
+        s[j] = sin(r[j]); c[j] = cos(r[j]);
+      }
+      for (size_t j = 0; j < n; ++j) {
+        unsigned p = unsigned(q[j]) & 3U;
+        T sj = p & 1U ? c[j] : s[j], cj = p & 1U ? s[j] : c[j];
+        sj = p & 2U ? -sj : sj;          // quadrants 2 and 3
+        cj = (p + 1U) & 2U ? -cj : cj;   // quadrants 1 and 2
+        // mpreal needs T(0) here
+        cj += T(0);                      // special values from F.10.1.12
+        sinx[i0 + j] = sj == 0 ? copysign(sj, xv[j]) : sj; // F.10.1.13
+        cosx[i0 + j] = cj;
+      }
+      if (scalar)
+        for (size_t j = 0; j < n; ++j)
+          if (!(fabs(xv[j]) < reducelim<T>()))
+            sincosd(xv[j], sinx[i0 + j], cosx[i0 + j]);
+    }
+  }
+
   template<typename T> void Math::sincosde(T x, T t, T& sinx, T& cosx) {
     // In order to minimize round-off errors, this function exactly reduces
     // the argument to the range [-45, 45] before converting it to radians.
@@ -199,6 +339,30 @@ namespace GeographicLib {
     return ang;
   }
 
+  template<typename T> void Math::atan2d(size_t num,
+                                        const T y[], const T x[], T ang[]) {
+    // The same as the scalar version with the swaps and the quadrant
+    // assignment done with selections.  The quadrant fixup is expressed as
+    // off + sgn * ang; off = -0 in the first case so that the sign of a zero
+    // result is preserved.
+    T yv[angblk_], xv[angblk_], off[angblk_], sgn[angblk_];
+    for (size_t i0 = 0; i0 < num; i0 += angblk_) {
+      size_t n = min(angblk_, num - i0);
+      for (size_t j = 0; j < n; ++j) {
+        T yj = y[i0 + j], xj = x[i0 + j];
+        bool swp = fabs(yj) > fabs(xj);
+        T x1 = swp ? yj : xj, y1 = swp ? xj : yj;
+        bool neg = signbit(x1);
+        yv[j] = y1; xv[j] = neg ? -x1 : x1;
+        off[j] = swp ? (neg ? -T(qd) : T(qd)) :
+          (neg ? copysign(T(hd), y1) : -T(0));
+        sgn[j] = swp != neg ? -1 : 1;
+      }
+      for (size_t j = 0; j < n; ++j)
+        ang[i0 + j] = off[j] + sgn[j] * (atan2(yv[j], xv[j]) / degree<T>());
+    }
+  }
+
   template<typename T> T Math::atand(T x)
   { return atan2d(x, T(1)); }
 
@@ -247,6 +411,63 @@ namespace GeographicLib {
     return tau;
   }
 
+  template<typename T> void Math::taupf(size_t num, const T tau[], T taup[],
+                                        T es) {
+    // Same as the scalar version except that the choice between atanh and
+    // atan in eatanhe is hoisted out of the loop and the test on isfinite is
+    // replaced by a select.
+    if (es > 0) {
+      for (size_t i = 0; i < num; ++i) {
+        T t = tau[i], tau1 = hypot(T(1), t),
+          sig = sinh( es * atanh(es * (t / tau1)) ),
+          tp = hypot(T(1), sig) * t - sig * tau1;
+        taup[i] = isfinite(t) ? tp : t;
+      }
+    } else {
+      for (size_t i = 0; i < num; ++i) {
+        T t = tau[i], tau1 = hypot(T(1), t),
+          sig = sinh( -es * atan(es * (t / tau1)) ),
+          tp = hypot(T(1), sig) * t - sig * tau1;
+        taup[i] = isfinite(t) ? tp : t;
+      }
+    }
+  }
+
+  template<typename T> void Math::tauf(size_t num, const T taup[], T tau[],
+                                       T es) {
+    // Same as the scalar version except that the Newton iterations are
+    // carried out for a block of values at a time.  act[i] records whether
+    // value i is still being iterated; the scalar version exits the loop at
+    // the corresponding point.
+    static const int numit = 5, nblk = 128;
+    static const T tol = sqrt(numeric_limits<T>::epsilon()) / 10;
+    static const T taumax = 2 / sqrt(numeric_limits<T>::epsilon());
+    T e2m = 1 - sq(es), tau70 = exp(eatanhe(T(1), es)), taupa[nblk];
+    bool act[nblk];
+    for (size_t i0 = 0; i0 < num; i0 += nblk) {
+      int n = int(min(size_t(nblk), num - i0)), nact = 0;
+      const T* tp = taup + i0;
+      T* t = tau + i0;
+      for (int i = 0; i < n; ++i) {
+        t[i] = fabs(tp[i]) > 70 ? tp[i] * tau70 : tp[i]/e2m;
+        act[i] = fabs(t[i]) < taumax; // false for +/-inf and nan
+        nact += act[i];
+      }
+      for (int k = 0; nact > 0 && (k < numit || GEOGRAPHICLIB_PANIC); ++k) {
+        taupf(n, t, taupa, es);
+        nact = 0;
+        for (int i = 0; i < n; ++i) {
+          T dtau = (tp[i] - taupa[i]) * (1 + e2m * sq(t[i])) /
+            ( e2m * hypot(T(1), t[i]) * hypot(T(1), taupa[i]) ),
+            stol = tol * fmax(T(1), fabs(tp[i]));
+          t[i] = act[i] ? t[i] + dtau : t[i];
+          act[i] = act[i] && fabs(dtau) >= stol;
+          nact += act[i];
+        }
+      }
+    }
+  }
+
   template<typename T> T Math::NaN() {
 #if defined(_MSC_VER)
     return numeric_limits<T>::has_quiet_NaN ?
@@ -288,6 +509,18 @@ namespace GeographicLib {
   template T    GEOGRAPHICLIB_EXPORT Math::eatanhe      <T>(T, T);         \
   template T    GEOGRAPHICLIB_EXPORT Math::taupf        <T>(T, T);         \
   template T    GEOGRAPHICLIB_EXPORT Math::tauf         <T>(T, T);         \
+  template void GEOGRAPHICLIB_EXPORT Math::AngNormalize <T>               \
+  (size_t, const T[], T[]);                                               \
+  template void GEOGRAPHICLIB_EXPORT Math::AngDiff <T>                    \
+  (size_t, const T[], const T[], T[], T[]);                               \
+  template void GEOGRAPHICLIB_EXPORT Math::sincosd <T>                    \
+  (size_t, const T[], T[], T[]);                                          \
+  template void GEOGRAPHICLIB_EXPORT Math::atan2d <T>                     \
+  (size_t, const T[], const T[], T[]);                                    \
+  template void GEOGRAPHICLIB_EXPORT Math::taupf <T>                      \
+  (size_t, const T[], T[], T);                                            \
+  template void GEOGRAPHICLIB_EXPORT Math::tauf <T>                       \
+  (size_t, const T[], T[], T);                                            \
   template T    GEOGRAPHICLIB_EXPORT Math::NaN          <T>();             \
   template T    GEOGRAPHICLIB_EXPORT Math::infinity     <T>();
 
@@ -37,6 +37,13 @@ namespace GeographicLib {
   }
 
   void OSGB::GridReference(real x, real y, int prec, std::string& gridref) {
+    char grid[2 + 2 * maxprec_];
+    int mlen = Encode(x, y, prec, grid);
+    gridref.resize(mlen);
+    copy(grid, grid + mlen, gridref.begin());
+  }
+
+  int OSGB::Encode(real x, real y, int prec, char grid[]) {
     using std::isnan;           // Needed for Centos 7, ubuntu 14
     CheckCoords(x, y);
     if (!(prec >= 0 && prec <= maxprec_))
@@ -44,10 +51,10 @@ namespace GeographicLib {
                           + " not in [0, "
                           + Utility::str(int(maxprec_)) + "]");
     if (isnan(x) || isnan(y)) {
-      gridref = "INVALID";
-      return;
+      static const char* const invalid = "INVALID";
+      copy(invalid, invalid + 7, grid);
+      return 7;
     }
-    char grid[2 + 2 * maxprec_];
     int
       xh = int(floor(x / tile_)),
       yh = int(floor(y / tile_));
@@ -85,16 +92,19 @@ namespace GeographicLib {
         iy /= base_;
       }
     }
-    int mlen = z + 2 * prec;
-    gridref.resize(mlen);
-    copy(grid, grid + mlen, gridref.begin());
+    return z + 2 * prec;
   }
 
   void OSGB::GridReference(const std::string& gridref,
                            real& x, real& y, int& prec,
                            bool centerp) {
+    Decode(gridref.data(), int(gridref.size()), x, y, prec, centerp);
+  }
+
+  void OSGB::Decode(const char* gridref, int n,
+                    real& x, real& y, int& prec, bool centerp) {
     int
-      len = int(gridref.size()),
+      len = n,
       p = 0;
     if (len >= 2 &&
         toupper(gridref[0]) == 'I' &&
@@ -107,16 +117,18 @@ namespace GeographicLib {
     for (int i = 0; i < len; ++i) {
       if (!isspace(gridref[i])) {
         if (p >= 2 + 2 * maxprec_)
-          throw GeographicErr("OSGB string " + gridref + " too long");
+          throw GeographicErr("OSGB string " + string(gridref, n)
+                              + " too long");
         grid[p++] = gridref[i];
       }
     }
     len = p;
     p = 0;
     if (len < 2)
-      throw GeographicErr("OSGB string " + gridref + " too short");
+      throw GeographicErr("OSGB string " + string(gridref, n)
+                          + " too short");
     if (len % 2)
-      throw GeographicErr("OSGB string " + gridref +
+      throw GeographicErr("OSGB string " + string(gridref, n) +
                           " has odd number of characters");
     int
       xh = 0,
@@ -124,7 +136,8 @@ namespace GeographicLib {
     while (p < 2) {
       int i = Utility::lookup(letters_, grid[p++]);
       if (i < 0)
-        throw GeographicErr("Illegal prefix character " + gridref);
+        throw GeographicErr("Illegal prefix character "
+                            + string(gridref, n));
       yh = yh * tilegrid_ + tilegrid_ - (i / tilegrid_) - 1;
       xh = xh * tilegrid_ + (i % tilegrid_);
     }
@@ -142,7 +155,8 @@ namespace GeographicLib {
         ix = Utility::lookup(digits_, grid[p + i]),
         iy = Utility::lookup(digits_, grid[p + i + prec1]);
       if (ix < 0 || iy < 0)
-        throw GeographicErr("Encountered a non-digit in " + gridref);
+        throw GeographicErr("Encountered a non-digit in "
+                            + string(gridref, n));
       x1 += unit * ix;
       y1 += unit * iy;
     }
@@ -155,6 +169,45 @@ namespace GeographicLib {
     prec = prec1;
   }
 
+  void OSGB::Forward(size_t num, const real lat[], const real lon[],
+                     real x[], real y[], real gamma[], real k[]) {
+    OSGBTM().Forward(num, OriginLongitude(), lat, lon, x, y, gamma, k);
+    real x0 = FalseEasting(), y0 = computenorthoffset();
+    for (size_t i = 0; i < num; ++i) {
+      x[i] += x0;
+      y[i] += y0;
+    }
+  }
+
+  void OSGB::Reverse(size_t num, const real x[], const real y[],
+                     real lat[], real lon[], real gamma[], real k[]) {
+    // Remove the false origin in place in the output arrays
+    real x0 = FalseEasting(), y0 = computenorthoffset();
+    for (size_t i = 0; i < num; ++i) {
+      lat[i] = x[i] - x0;
+      lon[i] = y[i] - y0;
+    }
+    OSGBTM().Reverse(num, OriginLongitude(), lat, lon, lat, lon, gamma, k);
+  }
+
+  void OSGB::GridReference(size_t num, const real x[], const real y[],
+                           int prec, char gridref[]) {
+    int w = GridReferenceWidth(prec);
+    for (size_t i = 0; i < num; ++i, gridref += w) {
+      int len = Encode(x[i], y[i], prec, gridref);
+      fill(gridref + len, gridref + w, '\0');
+    }
+  }
+
+  void OSGB::GridReference(size_t num, const char gridref[], size_t width,
+                           real x[], real y[], int prec[], bool centerp) {
+    for (size_t i = 0; i < num; ++i, gridref += width) {
+      int len = 0;
+      while (len < int(width) && gridref[len]) ++len;
+      Decode(gridref, len, x[i], y[i], prec[i], centerp);
+    }
+  }
+
   void OSGB::CheckCoords(real x, real y) {
     // Limits are all multiples of 100km and are all closed on the lower end
     // and open on the upper end -- and this is reflected in the error
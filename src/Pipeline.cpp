@@ -0,0 +1,172 @@
+/**
+ * \file Pipeline.cpp
+ * \brief Implementation for GeographicLib::Pipeline class
+ *
+ * Copyright (c) Charles Karney (2026) <karney@alum.mit.edu> and licensed under
+ * the MIT/X11 License.  For more information, see
+ * https://geographiclib.sourceforge.io/
+ **********************************************************************/
+
+#include <GeographicLib/Pipeline.hpp>
+#include <GeographicLib/Geocentric.hpp>
+#include <GeographicLib/Helmert.hpp>
+#include <GeographicLib/Geoid.hpp>
+#include <GeographicLib/TransverseMercator.hpp>
+#include <GeographicLib/LocalCartesian.hpp>
+#include <algorithm>
+#include <utility>
+
+using namespace std;
+
+namespace GeographicLib {
+
+  Pipeline::Block::Block() {
+    for (int k = 0; k < 6; ++k) c[k] = buf[k];
+  }
+
+  void Pipeline::Block::swap() {
+    for (int k = 0; k < 3; ++k) std::swap(c[k], c[k + 3]);
+  }
+
+  Pipeline::Pipeline(int input)
+    : _input(input)
+    , _output(input)
+    , _threadsafe(true)
+    , _utmups(false)
+  {
+    if (!(input >= GEODETIC && input <= PROJECTED))
+      throw GeographicErr("Unknown kind of coordinates for Pipeline");
+  }
+
+  void Pipeline::add(int in, int out, const step& s) {
+    static const char* const names[] =
+      {"geodetic", "geocentric", "local", "projected"};
+    if (_output != in)
+      throw GeographicErr(string("Pipeline step needs ") + names[in] +
+                          " coordinates instead of " + names[_output]);
+    _steps.push_back(s);
+    _output = out;
+    _utmups = false;
+  }
+
+  Pipeline& Pipeline::ToGeocentric(const Geocentric& earth) {
+    add(GEODETIC, GEOCENTRIC, [earth](size_t m, Block& b) -> void {
+      earth.Forward(m, b.c[0], b.c[1], b.c[2], b.c[3], b.c[4], b.c[5]);
+      b.swap();
+    });
+    return *this;
+  }
+
+  Pipeline& Pipeline::ToGeodetic(const Geocentric& earth) {
+    add(GEOCENTRIC, GEODETIC, [earth](size_t m, Block& b) -> void {
+      earth.Reverse(m, b.c[0], b.c[1], b.c[2], b.c[3], b.c[4], b.c[5]);
+      b.swap();
+    });
+    return *this;
+  }
+
+  Pipeline& Pipeline::Shift(const Helmert& helmert, bool reverse) {
+    add(GEOCENTRIC, GEOCENTRIC,
+        [helmert, reverse](size_t m, Block& b) -> void {
+          if (reverse)
+            helmert.Reverse(m, b.c[0], b.c[1], b.c[2],
+                            b.c[0], b.c[1], b.c[2]);
+          else
+            helmert.Forward(m, b.c[0], b.c[1], b.c[2],
+                            b.c[0], b.c[1], b.c[2]);
+        });
+    return *this;
+  }
+
+  Pipeline& Pipeline::GeoidHeight(const Geoid& geoid, bool toorthometric) {
+    const Geoid* g = &geoid;
+    real sign = toorthometric ? -1 : 1;
+    add(GEODETIC, GEODETIC, [g, sign](size_t m, Block& b) -> void {
+      real* n = b.buf[6];
+      (*g)(m, b.c[0], b.c[1], n);
+      for (size_t i = 0; i < m; ++i)
+        b.c[2][i] += sign * n[i];
+    });
+    _threadsafe = _threadsafe && geoid.ThreadSafe();
+    return *this;
+  }
+
+  Pipeline& Pipeline::ToTransverseMercator(const TransverseMercator& tm,
+                                           real lon0) {
+    add(GEODETIC, PROJECTED, [tm, lon0](size_t m, Block& b) -> void {
+      tm.Forward(m, lon0, b.c[0], b.c[1], b.c[3], b.c[4]);
+      // The height is unchanged
+      std::swap(b.c[0], b.c[3]); std::swap(b.c[1], b.c[4]);
+    });
+    return *this;
+  }
+
+  Pipeline& Pipeline::ToUTMUPS(int setzone) {
+    add(GEODETIC, PROJECTED, [setzone](size_t m, Block& b) -> void {
+      UTMUPS::Forward(m, b.c[0], b.c[1], b.zone, b.northp, b.c[3], b.c[4],
+                      nullptr, nullptr, setzone);
+      std::swap(b.c[0], b.c[3]); std::swap(b.c[1], b.c[4]);
+    });
+    _utmups = true;
+    return *this;
+  }
+
+  Pipeline& Pipeline::ToLocalCartesian(const LocalCartesian& lc) {
+    if (_output == GEODETIC)
+      add(GEODETIC, LOCAL, [lc](size_t m, Block& b) -> void {
+        lc.Forward(m, b.c[0], b.c[1], b.c[2], b.c[3], b.c[4], b.c[5]);
+        b.swap();
+      });
+    else
+      add(GEOCENTRIC, LOCAL, [lc](size_t m, Block& b) -> void {
+        lc.FromGeocentric(m, b.c[0], b.c[1], b.c[2], b.c[0], b.c[1], b.c[2]);
+      });
+    return *this;
+  }
+
+  Pipeline& Pipeline::FromLocalCartesian(const LocalCartesian& lc) {
+    add(LOCAL, GEOCENTRIC, [lc](size_t m, Block& b) -> void {
+      lc.ToGeocentric(m, b.c[0], b.c[1], b.c[2], b.c[0], b.c[1], b.c[2]);
+    });
+    return *this;
+  }
+
+  void Pipeline::Run(const Executor& exec, size_t num,
+                     const real in0[], const real in1[], const real in2[],
+                     real out0[], real out1[], real out2[],
+                     int zone[], bool northp[]) const {
+    const Executor& e = _threadsafe ? exec : Executor::Serial();
+    e.For(num, [this, in0, in1, in2, out0, out1, out2, zone, northp]
+               (size_t i0, size_t i1) -> void {
+      run(i1 - i0, in0 + i0, in1 + i0, in2 ? in2 + i0 : nullptr,
+          out0 + i0, out1 + i0, out2 ? out2 + i0 : nullptr,
+          zone ? zone + i0 : nullptr, northp ? northp + i0 : nullptr);
+    });
+  }
+
+  void Pipeline::run(size_t num,
+                     const real in0[], const real in1[], const real in2[],
+                     real out0[], real out1[], real out2[],
+                     int zone[], bool northp[]) const {
+    Block b;
+    for (size_t i0 = 0; i0 < num; i0 += blk_) {
+      size_t m = min(size_t(blk_), num - i0);
+      copy(in0 + i0, in0 + i0 + m, b.c[0]);
+      copy(in1 + i0, in1 + i0 + m, b.c[1]);
+      if (in2)
+        copy(in2 + i0, in2 + i0 + m, b.c[2]);
+      else
+        fill(b.c[2], b.c[2] + m, real(0));
+      for (const step& s : _steps)
+        s(m, b);
+      copy(b.c[0], b.c[0] + m, out0 + i0);
+      copy(b.c[1], b.c[1] + m, out1 + i0);
+      if (out2) copy(b.c[2], b.c[2] + m, out2 + i0);
+      if (_utmups) {
+        if (zone) copy(b.zone, b.zone + m, zone + i0);
+        if (northp) copy(b.northp, b.northp + m, northp + i0);
+      }
+    }
+  }
+
+} // namespace GeographicLib
@@ -100,6 +100,69 @@ namespace GeographicLib {
     gamma = Math::AngNormalize(northp ? lon : -lon);
   }
 
+  void PolarStereographic::Forward(size_t num, bool northp,
+                                   const real lat[], const real lon[],
+                                   real x[], real y[],
+                                   real gamma[], real k[]) const {
+    // Same as the scalar version except that taupf is evaluated for a block
+    // of points at a time.
+    static const int nblk = 64;
+    real tau[nblk], taup[nblk];
+    for (size_t i0 = 0; i0 < num; i0 += nblk) {
+      int n = int(min(size_t(nblk), num - i0));
+      for (int i = 0; i < n; ++i)
+        tau[i] = Math::tand((northp ? 1 : -1) * Math::LatFix(lat[i0 + i]));
+      Math::taupf(n, tau, taup, _es);
+      for (int i = 0; i < n; ++i) {
+        size_t j = i0 + i;
+        real
+          phi = (northp ? 1 : -1) * Math::LatFix(lat[j]),
+          secphi = hypot(real(1), tau[i]),
+          rho = hypot(real(1), taup[i]) + fabs(taup[i]),
+          lam = lon[j], s, c;
+        rho = taup[i] >= 0 ? (phi != Math::qd ? 1/rho : 0) : rho;
+        rho *= 2 * _k0 * _a / _c;
+        Math::sincosd(lam, s, c);
+        if (k) k[j] = phi != Math::qd ?
+          (rho / _a) * secphi * sqrt(_e2m + _e2 / Math::sq(secphi)) : _k0;
+        if (gamma) gamma[j] = Math::AngNormalize(northp ? lam : -lam);
+        x[j] = s * rho;
+        y[j] = c * (northp ? -rho : rho);
+      }
+    }
+  }
+
+  void PolarStereographic::Reverse(size_t num, bool northp,
+                                   const real x[], const real y[],
+                                   real lat[], real lon[],
+                                   real gamma[], real k[]) const {
+    // Same as the scalar version except that tauf is evaluated for a block
+    // of points at a time.
+    static const int nblk = 64;
+    real rho[nblk], taup[nblk], tau[nblk];
+    for (size_t i0 = 0; i0 < num; i0 += nblk) {
+      int n = int(min(size_t(nblk), num - i0));
+      for (int i = 0; i < n; ++i) {
+        rho[i] = hypot(x[i0 + i], y[i0 + i]);
+        real t = rho[i] != 0 ? rho[i] / (2 * _k0 * _a / _c) :
+          Math::sq(numeric_limits<real>::epsilon());
+        taup[i] = (1 / t - t) / 2;
+      }
+      Math::tauf(n, taup, tau, _es);
+      for (int i = 0; i < n; ++i) {
+        size_t j = i0 + i;
+        real
+          secphi = hypot(real(1), tau[i]),
+          lam = Math::atan2d(x[j], northp ? -y[j] : y[j]);
+        if (k) k[j] = rho[i] != 0 ?
+          (rho[i] / _a) * secphi * sqrt(_e2m + _e2 / Math::sq(secphi)) : _k0;
+        if (gamma) gamma[j] = Math::AngNormalize(northp ? lam : -lam);
+        lat[j] = (northp ? 1 : -1) * Math::atand(tau[i]);
+        lon[j] = lam;
+      }
+    }
+  }
+
   void PolarStereographic::SetScale(real lat, real k) {
     if (!(isfinite(k) && k > 0))
       throw GeographicErr("Scale is not positive");
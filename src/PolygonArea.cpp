@@ -8,6 +8,9 @@
  **********************************************************************/
 
 #include <GeographicLib/PolygonArea.hpp>
+#include <algorithm>
+#include <map>
+#include <mutex>
 
 #if defined(_MSC_VER)
 // Squelch warnings about enum-float expressions
@@ -84,6 +87,90 @@ namespace GeographicLib {
     ++_num;
   }
 
+  namespace {
+    // Compute the distances and areas for edges (lat1, lon1) -> (lat2, lon2).
+    // The general case solves the inverse problems one at a time; for Rhumb
+    // the array version of GenInverse is used.
+    template<class GeodType>
+    void edges(const GeodType& earth, unsigned mask, size_t num,
+               const Math::real lat1[], const Math::real lon1[],
+               const Math::real lat2[], const Math::real lon2[],
+               Math::real s12[], Math::real S12[]) {
+      for (size_t i = 0; i < num; ++i) {
+        Math::real t;
+        earth.GenInverse(lat1[i], lon1[i], lat2[i], lon2[i], mask,
+                         s12[i], t, t, t, t, t, S12[i]);
+      }
+    }
+    void edges(const Rhumb& earth, unsigned mask, size_t num,
+               const Math::real lat1[], const Math::real lon1[],
+               const Math::real lat2[], const Math::real lon2[],
+               Math::real s12[], Math::real S12[]) {
+      earth.GenInverse(num, lat1, lon1, lat2, lon2, mask, s12, nullptr, S12);
+    }
+  }
+
+  template<class GeodType>
+  void PolygonAreaT<GeodType>::AddEdges(size_t num,
+                                        const real lat[], const real lon[],
+                                        Accumulator<>& perimeter,
+                                        Accumulator<>& area,
+                                        int& crossings) const {
+    const size_t blk = 64;
+    real s12[blk], S12[blk];
+    for (size_t i0 = 0; i0 < num; i0 += blk) {
+      size_t n = min(blk, num - i0);
+      edges(_earth, _mask, n, lat + i0, lon + i0, lat + i0 + 1, lon + i0 + 1,
+            s12, S12);
+      for (size_t j = 0; j < n; ++j) {
+        perimeter += s12[j];
+        if (!_polyline) {
+          area += S12[j];
+          crossings += transit(lon[i0 + j], lon[i0 + j + 1]);
+        }
+      }
+    }
+  }
+
+  template<class GeodType>
+  void PolygonAreaT<GeodType>::AddPoints(size_t num,
+                                         const real lat[], const real lon[]) {
+    if (num == 0) return;
+    // The first point may be connected to the existing points
+    AddPoint(lat[0], lon[0]);
+    AddEdges(num - 1, lat, lon, _perimetersum, _areasum, _crossings);
+    _lat1 = lat[num - 1]; _lon1 = lon[num - 1];
+    _num += unsigned(num - 1);
+  }
+
+  template<class GeodType>
+  void PolygonAreaT<GeodType>::AddPoints(const Executor& exec, size_t num,
+                                         const real lat[], const real lon[]) {
+    if (num == 0) return;
+    AddPoint(lat[0], lon[0]);
+    // Partial sums for each chunk, indexed by the first edge of the chunk
+    struct partial {
+      Accumulator<> perimeter, area;
+      int crossings;
+      partial() : crossings(0) {}
+    };
+    map<size_t, partial> partials;
+    mutex lock;
+    exec.For(num - 1, [&](size_t i0, size_t i1) -> void {
+      partial p;
+      AddEdges(i1 - i0, lat + i0, lon + i0, p.perimeter, p.area, p.crossings);
+      lock_guard<mutex> guard(lock);
+      partials[i0] = p;
+    });
+    for (const auto& p : partials) {
+      _perimetersum += p.second.perimeter;
+      _areasum += p.second.area;
+      _crossings += p.second.crossings;
+    }
+    _lat1 = lat[num - 1]; _lon1 = lon[num - 1];
+    _num += unsigned(num - 1);
+  }
+
   template<class GeodType>
   void PolygonAreaT<GeodType>::AddEdge(real azi, real s) {
     if (_num) {                 // Do nothing if _num is zero
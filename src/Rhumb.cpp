@@ -3,7 +3,7 @@
  * \brief Implementation for GeographicLib::Rhumb and GeographicLib::RhumbLine
  * classes
  *
- * Copyright (c) Charles Karney (2014-2023) <karney@alum.mit.edu> and licensed
+ * Copyright (c) Charles Karney (2014-2026) <karney@alum.mit.edu> and licensed
  * under the MIT/X11 License.  For more information, see
  * https://geographiclib.sourceforge.io/
  **********************************************************************/
@@ -32,6 +32,17 @@ namespace GeographicLib {
     , _pP(_lL)
   {
     AreaCoeffs();
+    // AuxLatitude computes the coefficients for the series conversions on
+    // first use.  Compute the ones needed here now so that the object is not
+    // modified later and can be used concurrently in several threads.
+    const int phi = AuxLatitude::PHI, chi = AuxLatitude::CHI,
+      mu = AuxLatitude::MU, beta = AuxLatitude::BETA;
+    const int conv[][2] = {
+      {phi, chi}, {chi, phi}, {phi, mu}, {mu, phi}, {phi, beta},
+      {chi, mu}, {chi, beta}
+    };
+    for (const auto& c : conv)
+      _aux.Convert(c[0], c[1], AuxAngle(), false);
   }
 
   const Rhumb& Rhumb::WGS84() {
@@ -242,6 +253,71 @@ namespace GeographicLib {
       S12 = _c2 * lon12 * MeanSinXi(chi1, chi2);
   }
 
+  void Rhumb::GenInverse(size_t num, const real lat1[], const real lon1[],
+                         const real lat2[], const real lon2[],
+                         unsigned outmask,
+                         real s12[], real azi12[], real S12[]) const {
+    // The same as the scalar version except that the latitudes for a block
+    // of lines are held in arrays (the y and x components of the AuxAngles)
+    // and the conversions and divided differences are computed with the
+    // array versions of the AuxLatitude and DAuxLatitude functions.
+    using std::isinf;           // Needed for Centos 7, ubuntu 14
+    real py1[blk_], px1[blk_], py2[blk_], px2[blk_],
+      cy1[blk_], cx1[blk_], cy2[blk_], cx2[blk_], t1[blk_], t2[blk_],
+      lon12[blk_], d1[blk_], d2[blk_];
+    for (size_t i0 = 0; i0 < num; i0 += blk_) {
+      size_t n = min(size_t(blk_), num - i0);
+      // phi = AuxAngle::degrees(lat)
+      Math::sincosd(n, lat1 + i0, py1, px1);
+      Math::sincosd(n, lat2 + i0, py2, px2);
+      Math::AngDiff(n, lon1 + i0, lon2 + i0, lon12);
+      _aux.Convert(n, AuxLatitude::PHI, AuxLatitude::CHI,
+                   py1, px1, cy1, cx1, _exact);
+      _aux.Convert(n, AuxLatitude::PHI, AuxLatitude::CHI,
+                   py2, px2, cy2, cx2, _exact);
+      for (size_t j = 0; j < n; ++j) {
+        t1[j] = cy1[j] / cx1[j]; t2[j] = cy2[j] / cx2[j];
+      }
+      if (outmask & DISTANCE) {
+        // dmu/dpsi = dmu/dchi / dpsi/dchi
+        if (_exact) {
+          _aux.DRectifying(n, py1, px1, py2, px2, d1);
+          _aux.DIsometric(n, py1, px1, py2, px2, d2);
+        } else {
+          _aux.DConvert(n, AuxLatitude::CHI, AuxLatitude::MU,
+                        cy1, cx1, cy2, cx2, d1);
+          DAuxLatitude::Dlam(n, t1, t2, d2);
+        }
+      }
+      for (size_t j = 0; j < n; ++j) {
+        size_t i = i0 + j;
+        real
+          lam12 = lon12[j] * Math::degree<real>(),
+          psi1 = AuxAngle(cy1[j], cx1[j]).lam(),
+          psi2 = AuxAngle(cy2[j], cx2[j]).lam(),
+          psi12 = psi2 - psi1;
+        if (outmask & AZIMUTH)
+          azi12[i] = Math::atan2d(lam12, psi12);
+        if (outmask & DISTANCE) {
+          if (isinf(psi1) || isinf(psi2))
+            s12[i] = fabs(_aux.Convert(AuxLatitude::PHI, AuxLatitude::MU,
+                                       AuxAngle(py2[j], px2[j]),
+                                       _exact).radians() -
+                          _aux.Convert(AuxLatitude::PHI, AuxLatitude::MU,
+                                       AuxAngle(py1[j], px1[j]),
+                                       _exact).radians()) * _rm;
+          else
+            s12[i] = hypot(lam12, psi12) * (d1[j] / d2[j]) * _rm;
+        }
+      }
+      if (outmask & AREA) {
+        MeanSinXi(n, cy1, cx1, cy2, cx2, d1);
+        for (size_t j = 0; j < n; ++j)
+          S12[i0 + j] = _c2 * lon12[j] * d1[j];
+      }
+    }
+  }
+
   RhumbLine Rhumb::Line(real lat1, real lon1, real azi12) const
   { return RhumbLine(*this, lat1, lon1, azi12); }
 
@@ -270,6 +346,46 @@ namespace GeographicLib {
     return DAuxLatitude::Dp0Dpsi(tx, ty) + DpbetaDbeta * DbetaDpsi;
   }
 
+  void Rhumb::MeanSinXi(size_t num,
+                        const real cy1[], const real cx1[],
+                        const real cy2[], const real cx2[],
+                        real msx[]) const {
+    // The same as the scalar version for num <= blk_ pairs of conformal
+    // latitudes given as the components of AuxAngles.
+    real py1[blk_], px1[blk_], py2[blk_], px2[blk_], t1[blk_], t2[blk_],
+      Dp0Dpsi[blk_], DbetaDpsi[blk_], DpbetaDbeta[blk_], d[blk_],
+      // (Initialize these to placate g++'s maybe-uninitialized check.)
+      Delta[blk_] = {}, sbx[blk_] = {}, cbx[blk_] = {},
+      sby[blk_] = {}, cby[blk_] = {};
+    _aux.Convert(num, AuxLatitude::CHI, AuxLatitude::PHI,
+                 cy1, cx1, py1, px1, _exact);
+    _aux.Convert(num, AuxLatitude::CHI, AuxLatitude::PHI,
+                 cy2, cx2, py2, px2, _exact);
+    _aux.Convert(num, AuxLatitude::PHI, AuxLatitude::BETA,
+                 py1, px1, sbx, cbx, _exact);
+    _aux.Convert(num, AuxLatitude::PHI, AuxLatitude::BETA,
+                 py2, px2, sby, cby, _exact);
+    AuxAngleArray::normalize(num, sbx, cbx, sbx, cbx);
+    AuxAngleArray::normalize(num, sby, cby, sby, cby);
+    for (size_t j = 0; j < num; ++j) {
+      Delta[j] = atan2(sby[j], cby[j]) - atan2(sbx[j], cbx[j]);
+      t1[j] = cy1[j] / cx1[j]; t2[j] = cy2[j] / cx2[j];
+    }
+    DAuxLatitude::DClenshaw(num, false, Delta, sbx, cbx, sby, cby,
+                            _pP.data(), _lL, DpbetaDbeta);
+    if (_exact) {
+      _aux.DParametric(num, py1, px1, py2, px2, DbetaDpsi);
+      _aux.DIsometric(num, py1, px1, py2, px2, d);
+    } else {
+      _aux.DConvert(num, AuxLatitude::CHI, AuxLatitude::BETA,
+                    cy1, cx1, cy2, cx2, DbetaDpsi);
+      DAuxLatitude::Dlam(num, t1, t2, d);
+    }
+    DAuxLatitude::Dp0Dpsi(num, t1, t2, Dp0Dpsi);
+    for (size_t j = 0; j < num; ++j)
+      msx[j] = Dp0Dpsi[j] + DpbetaDbeta[j] * (DbetaDpsi[j] / d[j]);
+  }
+
   RhumbLine::RhumbLine(const Rhumb& rh, real lat1, real lon1, real azi12)
     : _rh(rh)
     , _lat1(Math::LatFix(lat1))
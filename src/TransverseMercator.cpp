@@ -2,7 +2,7 @@
  * \file TransverseMercator.cpp
  * \brief Implementation for GeographicLib::TransverseMercator class
  *
- * Copyright (c) Charles Karney (2008-2023) <karney@alum.mit.edu> and licensed
+ * Copyright (c) Charles Karney (2008-2026) <karney@alum.mit.edu> and licensed
  * under the MIT/X11 License.  For more information, see
  * https://geographiclib.sourceforge.io/
  *
@@ -362,23 +362,43 @@ namespace GeographicLib {
                                    real& gamma, real& k) const {
     if (_exact)
       return _tmexact.Forward(lon0, lat, lon, x, y, gamma, k);
+    int latsign, lonsign; bool backside;
+    Reduce(lon0, lat, lon, latsign, lonsign, backside);
+    real sphi, cphi, slam, clam;
+    Math::sincosd(lat, sphi, cphi);
+    Math::sincosd(lon, slam, clam);
+    real
+      tau = lat != Math::qd ? sphi / cphi : 0,
+      taup = Math::taupf(tau, _es);
+    ForwardSeries(lat, lon, cphi, slam, clam, tau, taup,
+                  latsign, lonsign, backside, x, y, gamma, k);
+  }
+
+  void TransverseMercator::Reduce(real lon0, real& lat, real& lon,
+                                  int& latsign, int& lonsign,
+                                  bool& backside) {
     lat = Math::LatFix(lat);
     lon = Math::AngDiff(lon0, lon);
     // Explicitly enforce the parity
-    int
-      latsign = signbit(lat) ? -1 : 1,
-      lonsign = signbit(lon) ? -1 : 1;
+    latsign = signbit(lat) ? -1 : 1;
+    lonsign = signbit(lon) ? -1 : 1;
     lon *= lonsign;
     lat *= latsign;
-    bool backside = lon > Math::qd;
+    backside = lon > Math::qd;
     if (backside) {
       if (lat == 0)
         latsign = -1;
       lon = Math::hd - lon;
     }
-    real sphi, cphi, slam, clam;
-    Math::sincosd(lat, sphi, cphi);
-    Math::sincosd(lon, slam, clam);
+  }
+
+  void TransverseMercator::ForwardSeries(real lat, real lon, real cphi,
+                                         real slam, real clam,
+                                         real tau, real taup,
+                                         int latsign, int lonsign,
+                                         bool backside,
+                                         real& x, real& y,
+                                         real& gamma, real& k) const {
     // phi = latitude
     // phi' = conformal latitude
     // psi = isometric latitude
@@ -398,9 +418,6 @@ namespace GeographicLib {
     //   sinh(etap) = cos(phi')*sin(lam)/denom = sech(psi)*sin(lam)/denom
     real etap, xip;
     if (lat != Math::qd) {
-      real
-        tau = sphi / cphi,
-        taup = Math::taupf(tau, _es);
       xip = atan2(taup, clam);
       // Used to be
       //   etap = Math::atanh(sin(lam) / cosh(psi));
@@ -533,16 +550,34 @@ namespace GeographicLib {
     // This undoes the steps in Forward.  The wrinkles are: (1) Use of the
     // reverted series to express zeta' in terms of zeta. (2) Newton's method
     // to solve for phi in terms of tan(phi).
+    int xisign, etasign; bool backside;
+    real xip, etap;
+    ReverseSeries(x, y, xisign, etasign, backside, xip, etap, gamma, k);
+    real
+      s = sinh(etap),
+      c = fmax(real(0), cos(xip)), // cos(pi/2) might be negative
+      r = hypot(s, c),
+      sxip = sin(xip),
+      // Use Newton's method to solve for tau
+      tau = r != 0 ? Math::tauf(sxip/r, _es) : 0;
+    ReverseFinish(lon0, etap, s, c, r, sxip, tau,
+                  xisign, etasign, backside, lat, lon, gamma, k);
+  }
+
+  void TransverseMercator::ReverseSeries(real x, real y,
+                                         int& xisign, int& etasign,
+                                         bool& backside,
+                                         real& xip, real& etap,
+                                         real& gamma, real& k) const {
     real
       xi = y / (_a1 * _k0),
       eta = x / (_a1 * _k0);
     // Explicitly enforce the parity
-    int
-      xisign = signbit(xi) ? -1 : 1,
-      etasign = signbit(eta) ? -1 : 1;
+    xisign = signbit(xi) ? -1 : 1;
+    etasign = signbit(eta) ? -1 : 1;
     xi *= xisign;
     eta *= etasign;
-    bool backside = xi > Math::pi()/2;
+    backside = xi > Math::pi()/2;
     if (backside)
       xi = Math::pi() - xi;
     real
@@ -574,17 +609,18 @@ namespace GeographicLib {
     //   phi' = asin(sin(xi') / cosh(eta')) (Krueger p 17 (25))
     //   lam = asin(tanh(eta') / cos(phi')
     //   psi = asinh(tan(phi'))
-    real
-      xip = y1.real(), etap = y1.imag(),
-      s = sinh(etap),
-      c = fmax(real(0), cos(xip)), // cos(pi/2) might be negative
-      r = hypot(s, c);
+    xip = y1.real(); etap = y1.imag();
+  }
+
+  void TransverseMercator::ReverseFinish(real lon0, real etap,
+                                         real s, real c, real r, real sxip,
+                                         real tau,
+                                         int xisign, int etasign,
+                                         bool backside,
+                                         real& lat, real& lon,
+                                         real& gamma, real& k) const {
     if (r != 0) {
       lon = Math::atan2d(s, c); // Krueger p 17 (25)
-      // Use Newton's method to solve for tau
-      real
-        sxip = sin(xip),
-        tau = Math::tauf(sxip/r, _es);
       gamma += Math::atan2d(sxip * tanh(etap), c); // Krueger p 19 (31)
       lat = Math::atand(tau);
       // Note cos(phi') * cosh(eta') = r
@@ -607,4 +643,93 @@ namespace GeographicLib {
     k *= _k0;
   }
 
+  void TransverseMercator::Forward(size_t num, real lon0,
+                                   const real lat[], const real lon[],
+                                   real x[], real y[],
+                                   real gamma[], real k[]) const {
+    if (_exact) {
+      for (size_t i = 0; i < num; ++i) {
+        real gam, kk;
+        _tmexact.Forward(lon0, lat[i], lon[i], x[i], y[i], gam, kk);
+        if (gamma) gamma[i] = gam;
+        if (k) k[i] = kk;
+      }
+      return;
+    }
+    // Same as the scalar version except that sincosd and taupf are evaluated
+    // for a block of points at a time.
+    static const int nblk = 64;
+    real phi[nblk], lam[nblk], sphi[nblk], cphi[nblk], slam[nblk], clam[nblk],
+      tau[nblk], taup[nblk];
+    int latsign[nblk], lonsign[nblk];
+    bool backside[nblk];
+    for (size_t i0 = 0; i0 < num; i0 += nblk) {
+      int n = int(min(size_t(nblk), num - i0));
+      for (int i = 0; i < n; ++i) {
+        phi[i] = lat[i0 + i]; lam[i] = lon[i0 + i];
+        Reduce(lon0, phi[i], lam[i], latsign[i], lonsign[i], backside[i]);
+      }
+      Math::sincosd(n, phi, sphi, cphi);
+      Math::sincosd(n, lam, slam, clam);
+      for (int i = 0; i < n; ++i)
+        // Set tau = 0 at the pole; taup is then not used.
+        tau[i] = phi[i] != Math::qd ? sphi[i] / cphi[i] : 0;
+      Math::taupf(n, tau, taup, _es);
+      for (int i = 0; i < n; ++i) {
+        size_t j = i0 + i;
+        real gam, kk;
+        ForwardSeries(phi[i], lam[i], cphi[i], slam[i], clam[i],
+                      tau[i], taup[i], latsign[i], lonsign[i], backside[i],
+                      x[j], y[j], gam, kk);
+        if (gamma) gamma[j] = gam;
+        if (k) k[j] = kk;
+      }
+    }
+  }
+
+  void TransverseMercator::Reverse(size_t num, real lon0,
+                                   const real x[], const real y[],
+                                   real lat[], real lon[],
+                                   real gamma[], real k[]) const {
+    if (_exact) {
+      for (size_t i = 0; i < num; ++i) {
+        real gam, kk;
+        _tmexact.Reverse(lon0, x[i], y[i], lat[i], lon[i], gam, kk);
+        if (gamma) gamma[i] = gam;
+        if (k) k[i] = kk;
+      }
+      return;
+    }
+    // Same as the scalar version except that tauf is evaluated for a block of
+    // points at a time.  x and y are read before lat and lon are written so
+    // that the outputs may overwrite the inputs.
+    static const int nblk = 64;
+    real etap[nblk], s[nblk], c[nblk], r[nblk], sxip[nblk],
+      taup[nblk], tau[nblk], gam[nblk], kk[nblk];
+    int xisign[nblk], etasign[nblk];
+    bool backside[nblk];
+    for (size_t i0 = 0; i0 < num; i0 += nblk) {
+      int n = int(min(size_t(nblk), num - i0));
+      for (int i = 0; i < n; ++i) {
+        real xip;
+        ReverseSeries(x[i0 + i], y[i0 + i], xisign[i], etasign[i],
+                      backside[i], xip, etap[i], gam[i], kk[i]);
+        s[i] = sinh(etap[i]);
+        c[i] = fmax(real(0), cos(xip));
+        r[i] = hypot(s[i], c[i]);
+        sxip[i] = sin(xip);
+        taup[i] = r[i] != 0 ? sxip[i] / r[i] : 0;
+      }
+      Math::tauf(n, taup, tau, _es);
+      for (int i = 0; i < n; ++i) {
+        size_t j = i0 + i;
+        ReverseFinish(lon0, etap[i], s[i], c[i], r[i], sxip[i], tau[i],
+                      xisign[i], etasign[i], backside[i],
+                      lat[j], lon[j], gam[i], kk[i]);
+        if (gamma) gamma[j] = gam[i];
+        if (k) k[j] = kk[i];
+      }
+    }
+  }
+
 } // namespace GeographicLib
@@ -2,7 +2,7 @@
  * \file UTMUPS.cpp
  * \brief Implementation for GeographicLib::UTMUPS class
  *
- * Copyright (c) Charles Karney (2008-2022) <karney@alum.mit.edu> and licensed
+ * Copyright (c) Charles Karney (2008-2026) <karney@alum.mit.edu> and licensed
  * under the MIT/X11 License.  For more information, see
  * https://geographiclib.sourceforge.io/
  **********************************************************************/
@@ -121,6 +121,16 @@ namespace GeographicLib {
     k = k1;
   }
 
+  void UTMUPS::Forward(size_t num, const real lat[], const real lon[],
+                       int zone[], bool northp[], real x[], real y[],
+                       real gamma[], real k[],
+                       int setzone, bool mgrslimits) {
+    real t;
+    for (size_t i = 0; i < num; ++i)
+      Forward(lat[i], lon[i], zone[i], northp[i], x[i], y[i],
+              gamma ? gamma[i] : t, k ? k[i] : t, setzone, mgrslimits);
+  }
+
   void UTMUPS::Reverse(int zone, bool northp, real x, real y,
                        real& lat, real& lon, real& gamma, real& k,
                        bool mgrslimits) {
@@ -144,6 +154,16 @@ namespace GeographicLib {
       PolarStereographic::UPS().Reverse(northp, x, y, lat, lon, gamma, k);
   }
 
+  void UTMUPS::Reverse(size_t num, const int zone[], const bool northp[],
+                       const real x[], const real y[],
+                       real lat[], real lon[], real gamma[], real k[],
+                       bool mgrslimits) {
+    real t;
+    for (size_t i = 0; i < num; ++i)
+      Reverse(zone[i], northp[i], x[i], y[i], lat[i], lon[i],
+              gamma ? gamma[i] : t, k ? k[i] : t, mgrslimits);
+  }
+
   bool UTMUPS::CheckCoords(bool utmp, bool northp, real x, real y,
                            bool mgrslimits, bool throwp) {
     // Limits are all multiples of 100km and are all closed on the both ends.
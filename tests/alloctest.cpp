@@ -0,0 +1,101 @@
+/**
+ * \file alloctest.cpp
+ * \brief Test that GeodesicExact solutions don't allocate memory
+ *
+ * Copyright (c) Charles Karney (2026) <karney@alum.mit.edu> and licensed
+ * under the MIT/X11 License.  For more information, see
+ * https://geographiclib.sourceforge.io/
+ **********************************************************************/
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <thread>
+#include <GeographicLib/Math.hpp>
+#include <GeographicLib/Geodesic.hpp>
+#include <GeographicLib/GeodesicLine.hpp>
+#include <GeographicLib/GeodesicExact.hpp>
+#include <GeographicLib/GeodesicLineExact.hpp>
+
+// Count the calls to the global operator new.  (This doesn't catch
+// allocations within a Windows DLL; so on that platform the test passes
+// trivially.)
+static std::atomic<long> nalloc(0);
+
+void* operator new(std::size_t n) {
+  ++nalloc;
+  void* p = std::malloc(n ? n : 1);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+using namespace std;
+using namespace GeographicLib;
+
+typedef Math::real T;
+
+// Solve a set of direct and inverse problems with all the outputs (including
+// the area) and return the number of allocations.
+static long solve(const GeodesicExact& g, const Geodesic& ge) {
+  long n0 = nalloc;
+  T s = 0;
+  for (int i = 0; i < 100; ++i) {
+    T lat1 = T(i % 90), lat2 = T(i % 60) - 30, lon2 = T(i % 180),
+      azi1 = T(i % 360), s12 = 1000 * T(i + 1) * 100,
+      lat, lon, azi1a, azi2, m12, M12, M21, S12, ds12;
+    g.GenInverse(lat1, 0, lat2, lon2, GeodesicExact::ALL,
+                 ds12, azi1a, azi2, m12, M12, M21, S12);
+    s += S12;
+    g.GenDirect(lat1, 0, azi1, false, s12, GeodesicExact::ALL,
+                lat, lon, azi2, ds12, m12, M12, M21, S12);
+    s += S12;
+    ge.GenInverse(lat1, 0, lat2, lon2, Geodesic::ALL,
+                  ds12, azi1a, azi2, m12, M12, M21, S12);
+    s += S12;
+  }
+  // Creating the line allocates memory only if the number of area
+  // coefficients is large; this is not the case for WGS84.
+  GeodesicLineExact l = g.Line(10, 20, 30, GeodesicExact::ALL);
+  for (int i = 0; i < 100; ++i) {
+    T lat, lon, azi2, a12, s12, m12, M12, M21, S12;
+    a12 = l.GenPosition(false, 1000 * T(i), GeodesicLineExact::ALL,
+                        lat, lon, azi2, s12, m12, M12, M21, S12);
+    s += S12 + a12;
+  }
+  return isfinite(s) ? nalloc - n0 : -1;
+}
+
+int main() {
+#if GEOGRAPHICLIB_PRECISION == 5
+  // mpfr allocates memory for its numbers, so skip the test.
+  return 0;
+#else
+  int n = 0;
+  const GeodesicExact& g = GeodesicExact::WGS84();
+  Geodesic ge(Constants::WGS84_a(), Constants::WGS84_f(), true);
+  // The first call sets up the scratch space for the current thread
+  solve(g, ge);
+  long k = solve(g, ge);
+  if (k != 0) {
+    cout << "Solving in the main thread made " << k << " allocations\n";
+    ++n;
+  }
+  // Check that the scratch space for another thread works the same way.
+  // (Count only the allocations in the second call to solve.)
+  long kt = 0;
+  thread t([&g, &ge, &kt]() -> void { solve(g, ge); kt = solve(g, ge); });
+  t.join();
+  if (kt != 0) {
+    cout << "Solving in a second thread made " << kt << " allocations\n";
+    ++n;
+  }
+  if (n) {
+    cout << n << " failure" << (n > 1 ? "s" : "") << "\n";
+    return 1;
+  }
+  return 0;
+#endif
+}
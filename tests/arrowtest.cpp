@@ -0,0 +1,392 @@
+/**
+ * \file arrowtest.cpp
+ * \brief Test the Arrow C data interface
+ *
+ * The input arrays are supplied by a minimal in-memory producer so that no
+ * Arrow library is needed.
+ *
+ * Copyright (c) Charles Karney (2026) <karney@alum.mit.edu> and licensed
+ * under the MIT/X11 License.  For more information, see
+ * https://geographiclib.sourceforge.io/
+ **********************************************************************/
+
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+#include <GeographicLib/Math.hpp>
+#include <GeographicLib/Arrow.hpp>
+#include <GeographicLib/Geodesic.hpp>
+#include <GeographicLib/UTMUPS.hpp>
+#include <GeographicLib/PolygonArea.hpp>
+
+using namespace std;
+using namespace GeographicLib;
+
+typedef Math::real T;
+
+static int checkEquals(T x, T y, T d) {
+  if (fabs(x - y) <= d)
+    return 0;
+  cout << "checkEquals fails: " << x << " != " << y << " +/- " << d << "\n";
+  return 1;
+}
+
+static int checkNaN(T x) {
+  using std::isnan;             // Needed for Centos 7, ubuntu 14
+  if (isnan(x))
+    return 0;
+  cout << "checkNaN fails\n";
+  return 1;
+}
+
+static int check(bool c, const char* msg) {
+  if (c)
+    return 0;
+  cout << "check fails: " << msg << "\n";
+  return 1;
+}
+
+// A minimal producer: a column owns its buffers, a batch is a struct array
+// (or a list of structs) of columns.  The release callbacks are counted.
+static int released = 0;
+
+static void releasearray(ArrowArray* a) { a->release = nullptr; ++released; }
+static void releaseschema(ArrowSchema* s) { s->release = nullptr; }
+
+struct column {
+  string name, format;
+  vector<double> d;
+  vector<float> f;
+  vector<int32_t> i;
+  vector<uint8_t> b, valid;
+  const void* buffers[2];
+  ArrowArray array;
+  ArrowSchema schema;
+  column(const string& n, const string& fmt) : name(n), format(fmt) {}
+  void setnull(size_t k) {
+    if (valid.empty()) valid.assign(64, 0xff);
+    valid[k / 8] &= uint8_t(~(1 << (k % 8)));
+  }
+  void build(int64_t length, int64_t offset) {
+    buffers[0] = valid.empty() ? nullptr : valid.data();
+    buffers[1] = format == "g" ? (const void*)d.data() :
+      format == "f" ? (const void*)f.data() :
+      format == "i" ? (const void*)i.data() : (const void*)b.data();
+    array = ArrowArray{length, valid.empty() ? 0 : -1, offset, 2, 0,
+                       buffers, nullptr, nullptr, releasearray, nullptr};
+    schema = ArrowSchema{format.c_str(), name.c_str(), nullptr,
+                         ARROW_FLAG_NULLABLE, 0, nullptr, nullptr,
+                         releaseschema, nullptr};
+  }
+};
+
+struct batch {
+  vector<column> cols;
+  vector<ArrowArray*> arrays;
+  vector<ArrowSchema*> schemas;
+  vector<uint8_t> valid;
+  const void* buffers[1];
+  ArrowArray array;
+  ArrowSchema schema;
+  column& add(const string& name, const vector<double>& v,
+              const string& format = "g") {
+    cols.emplace_back(name, format);
+    column& c = cols.back();
+    for (double x : v) {
+      if (format == "g") c.d.push_back(x);
+      else if (format == "f") c.f.push_back(float(x));
+      else if (format == "i") c.i.push_back(int32_t(x));
+    }
+    if (format == "b") {
+      c.b.assign(64, 0);
+      for (size_t k = 0; k < v.size(); ++k)
+        if (v[k] != 0) c.b[k / 8] |= uint8_t(1 << (k % 8));
+    }
+    return c;
+  }
+  // The struct has the given offset; the columns may have additional offsets
+  void build(int64_t length, int64_t offset = 0,
+             const vector<int64_t>& coloffsets = vector<int64_t>()) {
+    arrays.clear(); schemas.clear();
+    for (size_t k = 0; k < cols.size(); ++k) {
+      int64_t o = k < coloffsets.size() ? coloffsets[k] : 0;
+      cols[k].build(offset + length + o, o);
+      arrays.push_back(&cols[k].array);
+      schemas.push_back(&cols[k].schema);
+    }
+    buffers[0] = valid.empty() ? nullptr : valid.data();
+    array = ArrowArray{length, valid.empty() ? 0 : -1, offset, 1,
+                       int64_t(cols.size()), buffers, arrays.data(), nullptr,
+                       releasearray, nullptr};
+    schema = ArrowSchema{"+s", "", nullptr, 0, int64_t(cols.size()),
+                         schemas.data(), nullptr, releaseschema, nullptr};
+  }
+};
+
+// Return field k of the output as T
+static T get(const ArrowArray& a, int k, size_t i) {
+  return T(static_cast<const double*>(a.children[k]->buffers[1])[i]);
+}
+
+static bool isvalid(const ArrowArray& a, size_t i) {
+  return !a.buffers[0] ||
+    (static_cast<const uint8_t*>(a.buffers[0])[i / 8] >> (i % 8)) & 1;
+}
+
+static int Inverse() {
+  const Geodesic& g = Geodesic::WGS84();
+  vector<double> lat1, lon1, lat2, lon2;
+  for (int i = 0; i < 20; ++i) {
+    lat1.push_back(-80 + 8 * i); lon1.push_back(3 * i);
+    lat2.push_back(70 - 7 * i); lon2.push_back(-170 + 11 * i);
+  }
+  int n = 0;
+  // lon2 is float32; the struct starts at 2 and lat1 has an extra offset of
+  // 1; row 5 of the struct is null.
+  batch b;
+  b.add("lat1", lat1);
+  b.add("extra", lat1);
+  b.add("lon1", lon1);
+  b.add("lat2", lat2);
+  b.add("lon2", lon2, "f");
+  b.valid.assign(8, 0xff); b.valid[(2 + 5) / 8] &= uint8_t(~(1 << 7));
+  b.build(16, 2, {1});
+  ArrowSchema os;
+  ArrowArray oa;
+  Arrow::Inverse(Executor(4, 3), g, &b.schema, &b.array, &os, &oa);
+  n += check(oa.length == 16 && oa.null_count == 1 && oa.n_children == 3,
+             "Inverse length");
+  n += check(string(os.format) == "+s" && os.n_children == 3 &&
+             string(os.children[0]->name) == "s12" &&
+             string(os.children[2]->format) == "g", "Inverse schema");
+  for (size_t i = 0; i < 16; ++i) {
+    if (i == 5) {
+      n += check(!isvalid(oa, i) && !isvalid(*oa.children[1], i),
+                 "Inverse null");
+      continue;
+    }
+    T s12, azi1, azi2;
+    g.Inverse(T(lat1[i + 3]), T(lon1[i + 2]), T(lat2[i + 2]),
+              T(float(lon2[i + 2])), s12, azi1, azi2);
+    n += checkEquals(get(oa, 0, i), s12, 0);
+    n += checkEquals(get(oa, 1, i), azi1, 0);
+    n += checkEquals(get(oa, 2, i), azi2, 0);
+  }
+  // Move a child out, release the rest, and then release the child
+  ArrowArray child = *oa.children[0];
+  oa.children[0]->release = nullptr;
+  oa.release(&oa);
+  n += check(oa.release == nullptr && child.release != nullptr,
+             "Inverse release");
+  child.release(&child);
+  os.release(&os);
+  n += check(os.release == nullptr, "Inverse release schema");
+  // The input is not released
+  n += check(released == 0 && b.array.release != nullptr, "Inverse input");
+  return n;
+}
+
+static int Direct() {
+  const Geodesic& g = Geodesic::WGS84();
+  vector<double> lat1{10, 20, 30}, lon1{0, 40, 80}, azi1{30, 60, 90},
+    s12{1e6, 2e6, 3e6};
+  batch b;
+  b.add("lat1", lat1); b.add("lon1", lon1);
+  b.add("azi1", azi1); b.add("s12", s12).setnull(1);
+  b.build(3);
+  ArrowSchema os;
+  ArrowArray oa;
+  Arrow::Direct(g, &b.schema, &b.array, &os, &oa);
+  int n = 0;
+  n += check(oa.null_count == 1 && !isvalid(oa, 1), "Direct null");
+  for (size_t i = 0; i < 3; i += 2) {
+    T lat2, lon2, azi2;
+    g.Direct(T(lat1[i]), T(lon1[i]), T(azi1[i]), T(s12[i]), lat2, lon2, azi2);
+    n += checkEquals(get(oa, 0, i), lat2, 0);
+    n += checkEquals(get(oa, 1, i), lon2, 0);
+    n += checkEquals(get(oa, 2, i), azi2, 0);
+  }
+  n += checkNaN(get(oa, 0, 1));
+  oa.release(&oa); os.release(&os);
+  // Missing field and wrong format
+  batch c;
+  c.add("lat1", lat1); c.add("lon1", lon1); c.add("azi1", azi1);
+  c.build(3);
+  try {
+    Arrow::Direct(g, &c.schema, &c.array, &os, &oa);
+    n += check(false, "Direct missing field");
+  }
+  catch (const GeographicErr&) {}
+  c.add("s12", s12, "i");
+  c.build(3);
+  try {
+    Arrow::Direct(g, &c.schema, &c.array, &os, &oa);
+    n += check(false, "Direct format");
+  }
+  catch (const GeographicErr&) {}
+  return n;
+}
+
+static int UTMUPS1() {
+  vector<double> lat{40, -30, 85, -88}, lon{-75, 150, 10, 0};
+  batch b;
+  b.add("lat", lat); b.add("lon", lon);
+  b.build(4);
+  ArrowSchema os;
+  ArrowArray oa;
+  Arrow::UTMUPSForward(&b.schema, &b.array, &os, &oa);
+  int n = 0;
+  n += check(string(os.children[0]->format) == "i" &&
+             string(os.children[1]->format) == "b", "UTMUPS formats");
+  const int32_t* zone = static_cast<const int32_t*>(oa.children[0]->buffers[1]);
+  const uint8_t* northp =
+    static_cast<const uint8_t*>(oa.children[1]->buffers[1]);
+  for (size_t i = 0; i < 4; ++i) {
+    int z; bool np; T x, y;
+    UTMUPS::Forward(T(lat[i]), T(lon[i]), z, np, x, y);
+    n += check(zone[i] == z && bool((northp[i / 8] >> (i % 8)) & 1) == np,
+               "UTMUPS zone");
+    n += checkEquals(get(oa, 2, i), x, 0);
+    n += checkEquals(get(oa, 3, i), y, 0);
+  }
+  // Feed the output (less gamma and k) back into the reverse projection
+  ArrowSchema is = os;
+  ArrowArray ia = oa;
+  is.n_children = ia.n_children = 4;
+  ArrowSchema rs;
+  ArrowArray ra;
+  Arrow::UTMUPSReverse(&is, &ia, &rs, &ra);
+  for (size_t i = 0; i < 4; ++i) {
+    n += checkEquals(get(ra, 0, i), T(lat[i]), T(1e-9));
+    n += checkEquals(get(ra, 1, i), T(lon[i]), T(1e-9));
+  }
+  ra.release(&ra); rs.release(&rs);
+  oa.release(&oa); os.release(&os);
+  return n;
+}
+
+static int Polygons() {
+  const Geodesic& g = Geodesic::WGS84();
+  // Three rings (the second is null) plus a leading ring skipped by the
+  // offset of the list array.
+  vector<double> lat{0, 0, 1, 0, 10, 0, 0, 1, 1, 5, 5},
+    lon{0, 1, 0, 0, 10, 0, 1, 1, 0, 5, 6};
+  batch v;
+  v.add("lat", lat); v.add("lon", lon);
+  v.build(int64_t(lat.size()));
+  vector<int32_t> offsets{0, 3, 5, 9, 11};
+  vector<uint8_t> valid{uint8_t(~(1 << 2))};
+  const void* buffers[2] = {valid.data(), offsets.data()};
+  ArrowArray* children[1] = {&v.array};
+  ArrowSchema* schildren[1] = {&v.schema};
+  ArrowArray la{3, 1, 1, 2, 1, buffers, children, nullptr,
+                releasearray, nullptr};
+  ArrowSchema ls{"+l", "", nullptr, 0, 1, schildren, nullptr,
+                 releaseschema, nullptr};
+  int n = 0;
+  for (int polyline = 0; polyline < 2; ++polyline) {
+    ArrowSchema os;
+    ArrowArray oa;
+    Arrow::PolygonAreas(Executor(4, 1), g, polyline != 0, &ls, &la, &os, &oa);
+    n += check(oa.length == 3 && oa.null_count == 1 && !isvalid(oa, 1),
+               "Polygons null");
+    const int32_t* num =
+      static_cast<const int32_t*>(oa.children[0]->buffers[1]);
+    for (size_t i = 0; i < 3; i += 2) {
+      PolygonArea p(g, polyline != 0);
+      size_t b = offsets[i + 1], e = offsets[i + 2];
+      for (size_t j = b; j < e; ++j) p.AddPoint(T(lat[j]), T(lon[j]));
+      T perim, area = Math::NaN();
+      unsigned m = p.Compute(false, true, perim, area);
+      n += check(num[i] == int32_t(m), "Polygons num");
+      n += checkEquals(get(oa, 1, i), perim, 0);
+      if (polyline)
+        n += checkNaN(get(oa, 2, i));
+      else
+        n += checkEquals(get(oa, 2, i), area, 0);
+    }
+    oa.release(&oa); os.release(&os);
+  }
+  // Decreasing offsets are rejected
+  offsets[2] = 1;
+  try {
+    ArrowSchema os;
+    ArrowArray oa;
+    Arrow::PolygonAreas(g, false, &ls, &la, &os, &oa);
+    n += check(false, "Polygons offsets");
+  }
+  catch (const GeographicErr&) {}
+  return n;
+}
+
+// Zero-length struct and list arrays may have null data and offsets buffers
+static int Empty() {
+  const Geodesic& g = Geodesic::WGS84();
+  vector<double> none;
+  int n = 0;
+  batch b;
+  b.add("lat1", none); b.add("lon1", none);
+  b.add("lat2", none); b.add("lon2", none, "f");
+  b.build(0);
+  for (auto& c : b.cols) c.buffers[1] = nullptr;
+  ArrowSchema os;
+  ArrowArray oa;
+  Arrow::Inverse(g, &b.schema, &b.array, &os, &oa);
+  n += check(oa.length == 0 && oa.null_count == 0 && oa.n_children == 3,
+             "Empty Inverse");
+  oa.release(&oa); os.release(&os);
+  batch u;
+  u.add("zone", none, "i"); u.add("northp", none, "b");
+  u.add("x", none); u.add("y", none);
+  u.build(0);
+  for (auto& c : u.cols) c.buffers[1] = nullptr;
+  Arrow::UTMUPSReverse(&u.schema, &u.array, &os, &oa);
+  n += check(oa.length == 0 && oa.null_count == 0, "Empty UTMUPS");
+  oa.release(&oa); os.release(&os);
+  batch v;
+  v.add("lat", none); v.add("lon", none);
+  v.build(0);
+  for (auto& c : v.cols) c.buffers[1] = nullptr;
+  const void* buffers[2] = {nullptr, nullptr};
+  ArrowArray* children[1] = {&v.array};
+  ArrowSchema* schildren[1] = {&v.schema};
+  ArrowArray la{0, 0, 0, 2, 1, buffers, children, nullptr,
+                releasearray, nullptr};
+  ArrowSchema ls{"+l", "", nullptr, 0, 1, schildren, nullptr,
+                 releaseschema, nullptr};
+  Arrow::PolygonAreas(g, false, &ls, &la, &os, &oa);
+  n += check(oa.length == 0 && oa.null_count == 0 && oa.n_children == 3,
+             "Empty Polygons");
+  oa.release(&oa); os.release(&os);
+  return n;
+}
+
+int main() {
+  int n = 0, i;
+
+  i = Inverse(); n += i;
+  if (i)
+    cout << "Inverse failure\n";
+
+  i = Direct(); n += i;
+  if (i)
+    cout << "Direct failure\n";
+
+  i = UTMUPS1(); n += i;
+  if (i)
+    cout << "UTMUPS failure\n";
+
+  i = Polygons(); n += i;
+  if (i)
+    cout << "Polygons failure\n";
+
+  i = Empty(); n += i;
+  if (i)
+    cout << "Empty failure\n";
+
+  if (n) {
+    cout << n << " failure" << (n > 1 ? "s" : "") << "\n";
+    return 1;
+  }
+}
@@ -0,0 +1,1513 @@
+/**
+ * \file difftest.cpp
+ * \brief Randomized differential test of the optimized code paths
+ *
+ * Usage: difftest [seed [num [gravity-model [gravity-path]]]]
+ *
+ * The batch, parallel, and compact versions of various routines are checked
+ * against the scalar routines and against accurate references
+ * (GeodesicExact and TransverseMercatorExact) using \e num (default 2000)
+ * random cases generated with the given \e seed (default 20260101), so
+ * that the test is reproducible.  For each check the maximum error and the
+ * time per point for the optimized path are reported.  The test fails if
+ * any error exceeds its tolerance.  The tolerances are the same for all
+ * precisions; building with GEOGRAPHICLIB_PRECISION = 3, 4, or 5 runs the
+ * same checks with higher precision arithmetic.  GravityTrack is only
+ * checked if the name of a gravity model (and optionally the directory
+ * holding it) is given.
+ *
+ * Copyright (c) Charles Karney (2026) <karney@alum.mit.edu> and licensed
+ * under the MIT/X11 License.  For more information, see
+ * https://geographiclib.sourceforge.io/
+ **********************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <vector>
+#include <GeographicLib/Math.hpp>
+#include <GeographicLib/Utility.hpp>
+#include <GeographicLib/Executor.hpp>
+#include <GeographicLib/DST.hpp>
+#include <GeographicLib/AuxAngleArray.hpp>
+#include <GeographicLib/DAuxLatitude.hpp>
+#include <GeographicLib/Geodesic.hpp>
+#include <GeographicLib/GeodesicLine.hpp>
+#include <GeographicLib/GeodesicExact.hpp>
+#include <GeographicLib/CompactGeodesicLine.hpp>
+#include <GeographicLib/CrossTrack.hpp>
+#include <GeographicLib/EqualAreaGrid.hpp>
+#include <GeographicLib/TransverseMercator.hpp>
+#include <GeographicLib/TransverseMercatorExact.hpp>
+#include <GeographicLib/PolarStereographic.hpp>
+#include <GeographicLib/OSGB.hpp>
+#include <GeographicLib/LocalCartesian.hpp>
+#include <GeographicLib/Helmert.hpp>
+#include <GeographicLib/Pipeline.hpp>
+#include <GeographicLib/GeoCoords.hpp>
+#include <GeographicLib/MGRS.hpp>
+#include <GeographicLib/Rhumb.hpp>
+#include <GeographicLib/UTMUPS.hpp>
+#include <GeographicLib/NearestNeighbor.hpp>
+#include <GeographicLib/JacobiConformal.hpp>
+#include <GeographicLib/PolygonArea.hpp>
+#include <GeographicLib/GravityModel.hpp>
+#include <GeographicLib/GravityCircle.hpp>
+#include <GeographicLib/GravityTrack.hpp>
+
+using namespace std;
+using namespace GeographicLib;
+
+typedef Math::real T;
+typedef chrono::steady_clock clk;
+
+static double seconds(clk::time_point t0) {
+  return chrono::duration<double>(clk::now() - t0).count();
+}
+
+// Print the result of a check and return 1 if it fails.  A NaN error
+// counts as a failure.
+static int report(const string& name, T err, T tol, double secs,
+                  size_t num) {
+  bool ok = err <= tol;
+  cout << left << setw(46) << name << right
+       << setw(12) << setprecision(3) << double(err)
+       << setw(12) << setprecision(3) << double(tol)
+       << setw(12) << setprecision(4) << secs * 1e9 / double(num)
+       << (ok ? "" : "  FAIL") << "\n";
+  return ok ? 0 : 1;
+}
+
+// The maximum absolute difference between two arrays.  A NaN in either
+// array gives a NaN result unless both entries are NaN.
+static T maxdiff(const vector<T>& a, const vector<T>& b) {
+  T e = 0;
+  for (size_t i = 0; i < a.size(); ++i) {
+    if (isnan(a[i]) && isnan(b[i])) continue;
+    T d = fabs(a[i] - b[i]);
+    if (!(d <= e)) e = d;
+  }
+  return e;
+}
+
+// The maximum distance (m) between two arrays of positions.  This uses a
+// sphere with the WGS84 equatorial radius which is sufficiently accurate
+// for small differences.
+static T posdiff(const vector<T>& lat1, const vector<T>& lon1,
+                 const vector<T>& lat2, const vector<T>& lon2) {
+  T m = Constants::WGS84_a() * Math::degree(), e = 0;
+  for (size_t i = 0; i < lat1.size(); ++i) {
+    T d = hypot(lat2[i] - lat1[i],
+                Math::AngDiff(lon1[i], lon2[i]) * Math::cosd(lat1[i])) * m;
+    if (!(d <= e)) e = d;
+  }
+  return e;
+}
+
+class Random {
+private:
+  mt19937_64 _r;
+  uniform_real_distribution<double> _u;
+public:
+  explicit Random(unsigned long long seed) : _r(seed) {}
+  // Uniform in [a, b)
+  T operator()(T a, T b) { return a + (b - a) * T(_u(_r)); }
+  // Latitude with uniform distribution on the sphere
+  T lat() { return asin((*this)(-1, 1)) / Math::degree(); }
+};
+
+// Geodesic vs GeodesicExact.  The errors are converted to distances.
+static int geodesic(Random& R, size_t num) {
+  const Geodesic& g = Geodesic::WGS84();
+  const GeodesicExact& ge = GeodesicExact::WGS84();
+  T a = g.EquatorialRadius(), m = a * Math::pi() / Math::hd;
+  vector<T> lat1(num), lon1(num), lat2(num), lon2(num), azi1(num), s12(num);
+  for (size_t i = 0; i < num; ++i) {
+    lat1[i] = R.lat(); lon1[i] = R(-Math::hd, Math::hd);
+    lat2[i] = R.lat(); lon2[i] = R(-Math::hd, Math::hd);
+    azi1[i] = R(-Math::hd, Math::hd); s12[i] = R(0, 2e7);
+  }
+  int n = 0;
+  {
+    vector<T> s(num), sx(num), az(num), azx(num), S(num), Sx(num);
+    clk::time_point t0 = clk::now();
+    for (size_t i = 0; i < num; ++i) {
+      T t;
+      g.GenInverse(lat1[i], lon1[i], lat2[i], lon2[i],
+                   Geodesic::DISTANCE | Geodesic::AZIMUTH | Geodesic::AREA,
+                   s[i], az[i], t, t, t, t, S[i]);
+    }
+    double secs = seconds(t0);
+    for (size_t i = 0; i < num; ++i) {
+      T t;
+      ge.GenInverse(lat1[i], lon1[i], lat2[i], lon2[i],
+                    GeodesicExact::DISTANCE | GeodesicExact::AZIMUTH |
+                    GeodesicExact::AREA,
+                    sx[i], azx[i], t, t, t, t, Sx[i]);
+    }
+    n += report("Geodesic::Inverse s12 (m)", maxdiff(s, sx), T(1e-7),
+                secs, num);
+    // Azimuth error times distance; skip nearly antipodal points, where
+    // the azimuth is ill-conditioned.
+    T e = 0;
+    for (size_t i = 0; i < num; ++i) {
+      if (sx[i] > T(1.99e7)) continue;
+      T d = fabs(Math::AngDiff(azx[i], az[i])) * m * sin(sx[i] / a);
+      if (!(d <= e)) e = d;
+    }
+    n += report("Geodesic::Inverse azi1 (m)", e, T(1e-7), secs, num);
+    n += report("Geodesic::Inverse S12 (m^2)", maxdiff(S, Sx), T(2),
+                secs, num);
+  }
+  {
+    vector<T> la(num), lo(num), lax(num), lox(num);
+    clk::time_point t0 = clk::now();
+    for (size_t i = 0; i < num; ++i)
+      g.Direct(lat1[i], lon1[i], azi1[i], s12[i], la[i], lo[i]);
+    double secs = seconds(t0);
+    for (size_t i = 0; i < num; ++i)
+      ge.Direct(lat1[i], lon1[i], azi1[i], s12[i], lax[i], lox[i]);
+    n += report("Geodesic::Direct position (m)", posdiff(lax, lox, la, lo),
+                T(1e-7), secs, num);
+  }
+  return n;
+}
+
+// A scheduler for Executor which runs each range in its own thread; this
+// stands in for an external thread pool.
+static void threadsched(size_t num, size_t grain, const Executor::work& f) {
+  size_t m = min(size_t(3), (num + grain - 1) / grain);
+  vector<thread> threads;
+  for (size_t k = 0; k < m; ++k)
+    threads.emplace_back(f, k * num / m, (k + 1) * num / m);
+  for (auto& t : threads) t.join();
+}
+
+// The batch versions of Geodesic, UTMUPS, and NearestNeighbor must give
+// the same results as the scalar versions, with and without threads.
+static int batches(Random& R, size_t num) {
+  const Geodesic& g = Geodesic::WGS84();
+  Executor exec(4, 64), execs(threadsched, 3, 64);
+  int n = 0;
+  vector<T> lat1(num), lon1(num), lat2(num), lon2(num), azi1(num), s12(num);
+  for (size_t i = 0; i < num; ++i) {
+    lat1[i] = R.lat(); lon1[i] = R(-Math::hd, Math::hd);
+    lat2[i] = R.lat(); lon2[i] = R(-Math::hd, Math::hd);
+    azi1[i] = R(-Math::hd, Math::hd); s12[i] = R(0, 2e7);
+  }
+  {
+    vector<T> s(num), a1(num), a2(num), S(num),
+      ss(num), a1s(num), a2s(num), Ss(num), sp(num), Sp(num);
+    clk::time_point t0 = clk::now();
+    g.Inverse(num, lat1.data(), lon1.data(), lat2.data(), lon2.data(),
+              s.data(), a1.data(), a2.data(),
+              nullptr, nullptr, nullptr, S.data());
+    double secs = seconds(t0);
+    for (size_t i = 0; i < num; ++i) {
+      T t;
+      g.GenInverse(lat1[i], lon1[i], lat2[i], lon2[i],
+                   Geodesic::DISTANCE | Geodesic::AZIMUTH | Geodesic::AREA,
+                   ss[i], a1s[i], a2s[i], t, t, t, Ss[i]);
+    }
+    n += report("Geodesic::Inverse batch vs scalar",
+                maxdiff(s, ss) + maxdiff(a1, a1s) + maxdiff(a2, a2s) +
+                maxdiff(S, Ss), T(0), secs, num);
+    g.Inverse(exec, num, lat1.data(), lon1.data(), lat2.data(), lon2.data(),
+              sp.data(), nullptr, nullptr,
+              nullptr, nullptr, nullptr, Sp.data());
+    n += report("Geodesic::Inverse parallel vs batch",
+                maxdiff(sp, s) + maxdiff(Sp, S), T(0), secs, num);
+    g.Inverse(execs, num, lat1.data(), lon1.data(), lat2.data(), lon2.data(),
+              sp.data());
+    n += report("Geodesic::Inverse scheduler vs batch", maxdiff(sp, s), T(0),
+                secs, num);
+  }
+  {
+    vector<T> la(num), lo(num), az(num), m12(num),
+      las(num), los(num), azs(num), m12s(num), lap(num), lop(num);
+    clk::time_point t0 = clk::now();
+    g.Direct(num, lat1.data(), lon1.data(), azi1.data(), s12.data(),
+             la.data(), lo.data(), az.data(), m12.data());
+    double secs = seconds(t0);
+    for (size_t i = 0; i < num; ++i)
+      g.Direct(lat1[i], lon1[i], azi1[i], s12[i],
+               las[i], los[i], azs[i], m12s[i]);
+    n += report("Geodesic::Direct batch vs scalar",
+                maxdiff(la, las) + maxdiff(lo, los) + maxdiff(az, azs) +
+                maxdiff(m12, m12s), T(0), secs, num);
+    g.Direct(exec, num, lat1.data(), lon1.data(), azi1.data(), s12.data(),
+             lap.data(), lop.data());
+    n += report("Geodesic::Direct parallel vs batch",
+                maxdiff(lap, la) + maxdiff(lop, lo), T(0), secs, num);
+  }
+  {
+    vector<T> x(num), y(num), gam(num), k(num), xs(num), ys(num),
+      lat(num), lon(num), lats(num), lons(num);
+    vector<int> zone(num), zones(num);
+    // vector<bool> doesn't provide an array of bool
+    unique_ptr<bool[]> northp(new bool[num]), northps(new bool[num]);
+    clk::time_point t0 = clk::now();
+    UTMUPS::Forward(exec, num, lat1.data(), lon1.data(), zone.data(),
+                    northp.get(), x.data(), y.data(), gam.data(), k.data());
+    double secs = seconds(t0);
+    T e = 0;
+    for (size_t i = 0; i < num; ++i) {
+      UTMUPS::Forward(lat1[i], lon1[i], zones[i], northps[i], xs[i], ys[i]);
+      if (zones[i] != zone[i] || northps[i] != northp[i]) e = 1;
+    }
+    n += report("UTMUPS::Forward parallel vs scalar",
+                e + maxdiff(x, xs) + maxdiff(y, ys), T(0), secs, num);
+    t0 = clk::now();
+    UTMUPS::Reverse(num, zone.data(), northp.get(), x.data(), y.data(),
+                    lat.data(), lon.data());
+    secs = seconds(t0);
+    for (size_t i = 0; i < num; ++i)
+      UTMUPS::Reverse(zone[i], northp[i], x[i], y[i], lats[i], lons[i]);
+    n += report("UTMUPS::Reverse batch vs scalar",
+                maxdiff(lat, lats) + maxdiff(lon, lons), T(0), secs, num);
+  }
+  {
+    struct pos { T lat, lon; };
+    struct distance {
+      const Geodesic& g;
+      explicit distance(const Geodesic& geod) : g(geod) {}
+      T operator()(const pos& a, const pos& b) const {
+        T d;
+        g.Inverse(a.lat, a.lon, b.lat, b.lon, d);
+        return d;
+      }
+    } dist(g);
+    size_t npts = num, nq = num / 4;
+    vector<pos> pts(npts), queries(nq);
+    for (auto& p : pts) { p.lat = R.lat(); p.lon = R(-Math::hd, Math::hd); }
+    for (auto& p : queries) {
+      p.lat = R.lat(); p.lon = R(-Math::hd, Math::hd);
+    }
+    NearestNeighbor<T, pos, distance> tree(pts, dist), treep(pts, dist);
+    vector< vector<int> > ind, indp;
+    vector<T> d, dp;
+    tree.Search(pts, dist, queries, ind, d, 3);
+    clk::time_point t0 = clk::now();
+    treep.Search(exec, pts, dist, queries, indp, dp, 3);
+    double secs = seconds(t0);
+    T e = ind == indp ? 0 : 1;
+    int c[5], cp[5];
+    double m[2], mp[2];
+    tree.Statistics(c[0], c[1], c[2], c[3], c[4], m[0], m[1]);
+    treep.Statistics(cp[0], cp[1], cp[2], cp[3], cp[4], mp[0], mp[1]);
+    if (!(c[1] == cp[1] && c[2] == cp[2] && m[0] == mp[0])) e += 1;
+    n += report("NearestNeighbor::Search parallel vs serial",
+                e + maxdiff(d, dp), T(0), secs, nq);
+  }
+  {
+    // Executor::For called from a work function (including the one run by
+    // the calling thread) must run inline.  An exception thrown by the
+    // nested loop must propagate and leave the pool usable.
+    Executor nest(4, 1);
+    vector<T> s(num), sp(num);
+    g.Inverse(num, lat1.data(), lon1.data(), lat2.data(), lon2.data(),
+              s.data());
+    size_t m = (num + 3) / 4;
+    clk::time_point t0 = clk::now();
+    nest.For(4, [&](size_t k0, size_t k1) -> void {
+      for (size_t k = k0; k < k1; ++k) {
+        size_t i0 = min(num, k * m), i1 = min(num, i0 + m);
+        g.Inverse(nest, i1 - i0, lat1.data() + i0, lon1.data() + i0,
+                  lat2.data() + i0, lon2.data() + i0, sp.data() + i0);
+      }
+    });
+    double secs = seconds(t0);
+    T e = 0;
+    try {
+      nest.For(4, [&nest, num](size_t, size_t) -> void {
+        nest.For(num, [](size_t, size_t) -> void {
+          throw GeographicErr("nested");
+        });
+      });
+      e = 1;
+    }
+    catch (const GeographicErr&) {}
+    size_t count = 0;
+    mutex lock;
+    nest.For(num, [&count, &lock](size_t i0, size_t i1) -> void {
+      lock_guard<mutex> guard(lock);
+      count += i1 - i0;
+    });
+    if (count != num) e += 1;
+    n += report("Executor::For nested vs serial",
+                e + maxdiff(s, sp), T(0), secs, num);
+  }
+  return n;
+}
+
+// Geodesic::Inverse with a warm start must agree with the cold start.  Each
+// track is a fixed observer and a target moving in 1 km steps along a
+// geodesic; some of the tracks pass close to the antipode of the observer.
+// The ratio of the Newton iterations with and without warm starts is
+// checked to be less than 1.
+static int warmstart(Random& R, size_t num) {
+  const Geodesic& g = Geodesic::WGS84();
+  size_t ntracks = 10, len = max(size_t(1), num / ntracks);
+  vector<T> lat1(num), lon1(num), lat2(num), lon2(num),
+    s(num), a1(num), a2(num), sw(num), a1w(num), a2w(num);
+  for (size_t j = 0; j < ntracks; ++j) {
+    T la1 = R.lat(), lo1 = R(-Math::hd, Math::hd), la2, lo2, azi;
+    if (j % 2) {
+      // Start 200 km from the antipode
+      la2 = -la1; lo2 = lo1 + Math::hd;
+      T t;
+      g.Direct(la2, lo2, R(-Math::hd, Math::hd), T(2e5), la2, lo2, t);
+    } else {
+      la2 = R.lat(); lo2 = R(-Math::hd, Math::hd);
+    }
+    azi = R(-Math::hd, Math::hd);
+    GeodesicLine l = g.Line(la2, lo2, azi);
+    for (size_t k = 0; k < len && j * len + k < num; ++k) {
+      size_t i = j * len + k;
+      lat1[i] = la1; lon1[i] = lo1;
+      l.Position(T(1e3) * k, lat2[i], lon2[i]);
+    }
+  }
+  unsigned long long coldit = 0;
+  for (size_t i = 0; i < num; ++i) {
+    Geodesic::InverseHint h;
+    g.Inverse(lat1[i], lon1[i], lat2[i], lon2[i], s[i], a1[i], a2[i], h);
+    coldit += h.TotalIterations();
+  }
+  Geodesic::InverseHint hint;
+  clk::time_point t0 = clk::now();
+  for (size_t i = 0; i < num; ++i) {
+    if (i % len == 0) hint.Reset();
+    g.Inverse(lat1[i], lon1[i], lat2[i], lon2[i], sw[i], a1w[i], a2w[i],
+              hint);
+  }
+  double secs = seconds(t0);
+  unsigned long long warmit = 0;
+  for (size_t i = 0; i < num; ++i) {
+    if (i % len == 0) hint.Reset();
+    g.Inverse(lat1[i], lon1[i], lat2[i], lon2[i], sw[i], a1w[i], a2w[i],
+              hint);
+    warmit += hint.Iterations();
+  }
+  int n = 0;
+  n += report("Geodesic::Inverse warm start s12 (m)", maxdiff(s, sw),
+              T(1e-7), secs, num);
+  n += report("Geodesic::Inverse warm start azi (deg)",
+              max(maxdiff(a1, a1w), maxdiff(a2, a2w)), T(1e-10), secs, num);
+  n += report("Geodesic::Inverse warm/cold iterations",
+              T(warmit) / T(max(coldit, 1ULL)), T(1), secs, num);
+  return n;
+}
+
+// Geodesic::Within vs Geodesic::Inverse.  Thresholds just above and below
+// s12 stress the bounds; the undecided fraction is checked for a typical
+// geofence.
+static int within(Random& R, size_t num) {
+  int n = 0;
+  for (int exact = 0; exact < 2; ++exact) {
+    Geodesic g(Constants::WGS84_a(), Constants::WGS84_f(), exact != 0);
+    vector<T> lat1(num), lon1(num), lat2(num), lon2(num), s12(num);
+    for (size_t i = 0; i < num; ++i) {
+      lat1[i] = R.lat(); lon1[i] = R(-Math::hd, Math::hd);
+      T d = i % 3 == 0 ? T(1e-3) : i % 3 == 1 ? T(1) : T(Math::hd);
+      lat2[i] = Math::LatFix(lat1[i] + R(-d, d));
+      if (isnan(lat2[i])) lat2[i] = lat1[i];
+      lon2[i] = lon1[i] + R(-d, d);
+    }
+    g.Inverse(num, lat1.data(), lon1.data(), lat2.data(), lon2.data(),
+              s12.data());
+    unique_ptr<bool[]> w(new bool[num]);
+    size_t bad = 0;
+    for (T d : {T(1e-2), T(1e-5), T(1e-8)})
+      for (int sign = -1; sign <= 1; sign += 2) {
+        for (size_t i = 0; i < num; ++i) {
+          T r = s12[i] * (1 + sign * d);
+          bad += g.Within(lat1[i], lon1[i], lat2[i], lon2[i], r) !=
+            (s12[i] < r);
+          bad += g.Within(1, &lat1[i], &lon1[i], &lat2[i], &lon2[i], r,
+                          &w[i]) > 1 || w[i] != (s12[i] < r);
+        }
+      }
+    n += report(string("Geodesic::Within vs Inverse") +
+                (exact ? " (exact)" : ""), T(bad), T(0), 0, num);
+    T r = 5e6;
+    clk::time_point t0 = clk::now();
+    size_t fast = g.Within(Executor(4, 16), num, lat1.data(), lon1.data(),
+                           lat2.data(), lon2.data(), r, w.get());
+    double secs = seconds(t0);
+    bad = 0;
+    for (size_t i = 0; i < num; ++i)
+      bad += w[i] != (s12[i] < r);
+    n += report(string("Geodesic::Within undecided fraction") +
+                (exact ? " (exact)" : ""),
+                T(num - fast) / T(num) + T(bad), T(0.01), secs, num);
+  }
+  return n;
+}
+
+// CrossTrack::Distance is checked by verifying that the geodesic from the
+// foot to the point is perpendicular to the segment and by sampling the
+// segment.  CrossTrack::Nearest with threads must agree with a brute force
+// search.
+static int crosstrack(Random& R, size_t num) {
+  int n = 0;
+  const Geodesic& g = Geodesic::WGS84();
+  CrossTrack ct(g);
+  {
+    T errx = 0, errd = 0;
+    const int nsamp = 100;
+    clk::time_point t0 = clk::now();
+    double secs = 0;
+    for (size_t i = 0; i < num; ++i) {
+      T latA = R.lat(), lonA = R(-Math::hd, Math::hd),
+        latB = Math::LatFix(latA + R(-30, 30)), lonB = lonA + R(-30, 30);
+      if (isnan(latB)) latB = latA;
+      T lat = Math::LatFix(latA + R(-40, 40)), lon = lonA + R(-40, 40);
+      if (isnan(lat)) lat = latA;
+      GeodesicLine l = g.InverseLine(latA, lonA, latB, lonB);
+      t0 = clk::now();
+      T along, xtrack, d = ct.Distance(latA, lonA, latB, lonB, lat, lon,
+                                       along, xtrack);
+      secs += seconds(t0);
+      // The geodesic from the foot to P must be perpendicular to the line
+      // and have length |xtrack|.
+      T latF, lonF, aziF, z, aziP, t;
+      l.Position(along, latF, lonF, aziF);
+      g.Inverse(latF, lonF, lat, lon, z, aziP, t);
+      T sa, ca;
+      Math::sincosd(Math::AngDiff(aziF, aziP), sa, ca);
+      errx = fmax(errx, fmax(fabs(z - fabs(xtrack)), fabs(z * ca)));
+      if (z > 1 && sa * xtrack < 0) errx = Math::NaN();
+      // d can't exceed the distance to any point on the segment and can be
+      // only slightly less than the closest sampled point.
+      T dmin = Math::infinity();
+      for (int k = 0; k <= nsamp; ++k) {
+        T lat1, lon1;
+        l.Position(l.Distance() * k / nsamp, lat1, lon1);
+        g.Inverse(lat1, lon1, lat, lon, z);
+        dmin = fmin(dmin, z);
+      }
+      errd = fmax(errd, d - dmin);
+      if (!(d > dmin - l.Distance() / nsamp)) errd = Math::NaN();
+    }
+    n += report("CrossTrack::Distance perpendicularity", errx, T(1e-6),
+                secs, num);
+    n += report("CrossTrack::Distance vs sampled segment", errd, T(1e-6),
+                0, num);
+  }
+  {
+    // Segments forming a few random walks over a region and points
+    // scattered over a larger region.
+    size_t nseg = 200, nq = num / 4;
+    vector<T> latA(nseg), lonA(nseg), latB(nseg), lonB(nseg);
+    for (size_t j = 0; j < nseg; ++j) {
+      if (j % 50 == 0) {
+        latA[j] = R(-60, 60); lonA[j] = R(-40, 40);
+      } else {
+        latA[j] = latB[j-1]; lonA[j] = lonB[j-1];
+      }
+      latB[j] = Math::LatFix(latA[j] + R(-5, 5)); lonB[j] = lonA[j] + R(-5, 5);
+      if (isnan(latB[j])) latB[j] = latA[j];
+    }
+    vector<T> lat(nq), lon(nq), dist(nq), along(nq), xtrack(nq);
+    vector<int> seg(nq);
+    for (size_t i = 0; i < nq; ++i) {
+      lat[i] = R(-80, 80); lon[i] = R(-60, 60);
+    }
+    ct.Reset(nseg, latA.data(), lonA.data(), latB.data(), lonB.data());
+    clk::time_point t0 = clk::now();
+    ct.Nearest(Executor(4, 16), nq, lat.data(), lon.data(), seg.data(),
+               dist.data(), along.data(), xtrack.data());
+    double secs = seconds(t0);
+    size_t bad = 0;
+    for (size_t i = 0; i < nq; ++i) {
+      int best = -1;
+      T bestd = Math::infinity(), bal = 0, bxt = 0;
+      for (size_t j = 0; j < nseg; ++j) {
+        T al, xt, d = ct.Distance(latA[j], lonA[j], latB[j], lonB[j],
+                                  lat[i], lon[i], al, xt);
+        if (d < bestd) { best = int(j); bestd = d; bal = al; bxt = xt; }
+      }
+      bad += seg[i] != best || dist[i] != bestd ||
+        along[i] != bal || xtrack[i] != bxt;
+    }
+    n += report("CrossTrack::Nearest vs brute force", T(bad), T(0),
+                secs, nq);
+  }
+  return n;
+}
+
+// CrossTrack::Simplify and SimplifyArea on a random track with and without
+// threads.  No discarded vertex may be further than the tolerance from the
+// simplified track.  SimplifyArea is checked against a naive version of
+// the Visvalingam-Whyatt algorithm on part of the track and the triangle
+// areas are checked against PolygonArea.
+static int simplify(Random& R, size_t num) {
+  int n = 0;
+  const Geodesic& g = Geodesic::WGS84();
+  CrossTrack ct(g);
+  size_t np = 5 * num;
+  vector<T> lat(np), lon(np);
+  {
+    T azi = R(-Math::hd, Math::hd);
+    lat[0] = R(-80, 80); lon[0] = R(-Math::hd, Math::hd);
+    for (size_t i = 1; i < np; ++i) {
+      azi += R(-20, 20);
+      T t;
+      g.Direct(lat[i-1], lon[i-1], azi, R(0, 200), lat[i], lon[i], t);
+    }
+  }
+  {
+    T tol = 50;
+    unique_ptr<bool[]> keep(new bool[np]), keept(new bool[np]);
+    size_t k = ct.Simplify(np, lat.data(), lon.data(), tol, keep.get());
+    clk::time_point t0 = clk::now();
+    size_t kt = ct.Simplify(Executor(4, 16), np, lat.data(), lon.data(),
+                            tol, keept.get());
+    double secs = seconds(t0);
+    size_t bad = k != kt, cnt = 0;
+    T dmax = 0;
+    for (size_t i0 = 0, i1 = 1; i1 < np; ++i1) {
+      bad += keep[i1] != keept[i1];
+      if (!keep[i1]) continue;
+      for (size_t i = i0 + 1; i < i1; ++i) {
+        T al, xt;
+        dmax = fmax(dmax, ct.Distance(lat[i0], lon[i0], lat[i1], lon[i1],
+                                      lat[i], lon[i], al, xt));
+      }
+      i0 = i1; ++cnt;
+    }
+    bad += cnt + 1 != k || !(dmax <= tol) || !(k < np / 4);
+    n += report("CrossTrack::Simplify", T(bad), T(0), secs, np);
+  }
+  {
+    T area = 2000;
+    unique_ptr<bool[]> keep(new bool[np]), keept(new bool[np]);
+    size_t k = ct.SimplifyArea(np, lat.data(), lon.data(), area,
+                               keep.get());
+    clk::time_point t0 = clk::now();
+    size_t kt = ct.SimplifyArea(Executor(4, 16), np, lat.data(), lon.data(),
+                                area, keept.get());
+    double secs = seconds(t0);
+    size_t bad = k != kt || !(k < np / 2);
+    for (size_t i = 0; i < np; ++i)
+      bad += keep[i] != keept[i];
+    // Naive version on the first m vertices
+    size_t m = min(np, size_t(300));
+    ct.SimplifyArea(m, lat.data(), lon.data(), area, keep.get());
+    vector<size_t> v(m);
+    vector<T> a(m, Math::infinity());
+    PolygonArea poly(g);
+    auto tri = [&](size_t i, size_t j, size_t l) -> T {
+      T p, S;
+      poly.Clear();
+      poly.AddPoint(lat[i], lon[i]); poly.AddPoint(lat[j], lon[j]);
+      poly.AddPoint(lat[l], lon[l]);
+      poly.Compute(false, true, p, S);
+      return fabs(S);
+    };
+    for (size_t i = 0; i < m; ++i) v[i] = i;
+    for (size_t i = 1; i + 1 < m; ++i) a[i] = tri(i - 1, i, i + 1);
+    while (v.size() > 2) {
+      size_t j = 1;
+      for (size_t i = 2; i + 1 < v.size(); ++i)
+        if (a[v[i]] < a[v[j]]) j = i;
+      T amin = a[v[j]];
+      if (!(amin < area)) break;
+      v.erase(v.begin() + j);
+      if (j > 1) a[v[j-1]] = fmax(amin, tri(v[j-2], v[j-1], v[j]));
+      if (j + 1 < v.size()) a[v[j]] = fmax(amin, tri(v[j-1], v[j], v[j+1]));
+    }
+    for (size_t i = 0, j = 0; i < m; ++i) {
+      bool inv = j < v.size() && v[j] == i;
+      if (inv) ++j;
+      bad += keep[i] != inv;
+    }
+    for (size_t i = 1; i + 1 < m; ++i) {
+      T t = tri(i - 1, i, i + 1);
+      bool w[3];
+      // An isolated vertex between its neighbors
+      T la[3] = {lat[i-1], lat[i], lat[i+1]}, lo[3] = {lon[i-1], lon[i],
+                                                        lon[i+1]};
+      ct.SimplifyArea(3, la, lo, t * (1 + T(1e-6)) + T(1e-3), w);
+      bad += w[1];
+      ct.SimplifyArea(3, la, lo, t * (1 - T(1e-6)) - T(1e-3), w);
+      bad += !w[1];
+    }
+    n += report("CrossTrack::SimplifyArea", T(bad), T(0), secs, np);
+  }
+  return n;
+}
+
+// EqualAreaGrid: the batch and threaded cell assignments and histograms vs
+// the scalar version, points lie within the bounds of their cells (the
+// corners belonging to the cell to the northeast), and the cell areas vs
+// the area of the ellipsoid and PolygonArea applied to the cell boundaries.
+static int equalareagrid(Random& R, size_t num) {
+  int n = 0;
+  const Geodesic& g = Geodesic::WGS84();
+  EqualAreaGrid grid(g.EquatorialRadius(), g.Flattening(), 180);
+  int ncells = grid.NumCells();
+  size_t np = 10 * num;
+  vector<T> lat(np), lon(np);
+  for (size_t i = 0; i < np; ++i) {
+    if (i % 10 == 0) {
+      // A corner of a random cell
+      T lat1, lon1;
+      grid.Bounds(int(R(0, T(ncells))) % ncells, lat[i], lat1, lon[i], lon1);
+      if (i % 20 == 0) lon[i] += Math::td;
+    } else {
+      lat[i] = R.lat(); lon[i] = R(-540, 540);
+    }
+  }
+  lat[1] = Math::qd; lat[2] = -Math::qd; lat[3] = Math::NaN();
+  lon[4] = Math::infinity();
+  vector<int> cell(np), cellt(np);
+  grid.Cell(np, lat.data(), lon.data(), cell.data());
+  clk::time_point t0 = clk::now();
+  grid.Cell(Executor(4, 16), np, lat.data(), lon.data(), cellt.data());
+  double secs = seconds(t0);
+  size_t bad = 0;
+  for (size_t i = 0; i < np; ++i) {
+    int c = grid.Cell(lat[i], lon[i]);
+    bad += c != cell[i] || c != cellt[i];
+    if (c < 0) {
+      bad += i != 3 && i != 4;
+      continue;
+    }
+    T lat0, lat1, lon0, lon1, x = Math::AngNormalize(lon[i]);
+    grid.Bounds(c, lat0, lat1, lon0, lon1);
+    if (x == Math::hd && lon0 == -Math::hd) x = -Math::hd;
+    bad += !(lat0 <= lat[i] && (lat[i] < lat1 || lat1 == Math::qd) &&
+             lon0 <= x && x < lon1);
+  }
+  n += report("EqualAreaGrid::Cell", T(bad), T(0), secs, np);
+  {
+    vector<unsigned long long> counts, countst, check(ncells, 0);
+    size_t k = 0;
+    for (size_t i = 0; i < np; ++i)
+      if (cell[i] >= 0) { ++check[cell[i]]; ++k; }
+    size_t k1 = grid.Histogram(np, lat.data(), lon.data(), counts);
+    t0 = clk::now();
+    // In two batches
+    size_t k2 = grid.Histogram(Executor(4, 16), np / 3,
+                               lat.data(), lon.data(), countst) +
+      grid.Histogram(Executor(4, 16), np - np / 3,
+                     lat.data() + np / 3, lon.data() + np / 3, countst);
+    secs = seconds(t0);
+    bad = (k1 != k) + (k2 != k) + (counts != check) + (countst != check);
+    n += report("EqualAreaGrid::Histogram", T(bad), T(0), secs, np);
+  }
+  {
+    T sum = 0;
+    for (int c = 0; c < ncells; ++c) sum += grid.Area(c);
+    T err = fabs(sum / g.EllipsoidArea() - 1);
+    PolygonArea poly(g);
+    vector<T> plat, plon;
+    for (int k = 0; k < 200; ++k) {
+      int c = k < 6 ? (k < 3 ? k : ncells - 1 - (k - 3)) :
+        int(R(0, T(ncells))) % ncells;
+      grid.Boundary(c, 512, plat, plon);
+      poly.Clear();
+      for (size_t i = 0; i < plat.size(); ++i)
+        poly.AddPoint(plat[i], plon[i]);
+      T p, S;
+      poly.Compute(false, true, p, S);
+      err = fmax(err, fabs(S / grid.Area(c) - 1));
+    }
+    n += report("EqualAreaGrid::Area (relative)", err, T(1e-5), 0, 200);
+  }
+  return n;
+}
+
+// CompactGeodesicLine must give the same results as GeodesicLine.
+static int compactline(Random& R, size_t num) {
+  int n = 0;
+  for (int exact = 0; exact < 2; ++exact) {
+    Geodesic g(Constants::WGS84_a(), Constants::WGS84_f(), exact != 0);
+    // A few lines, each queried many times, interleaved so that the cache
+    // is exercised.
+    size_t nlines = 20;
+    vector<GeodesicLine> lines;
+    vector<CompactGeodesicLine> clines;
+    for (size_t j = 0; j < nlines; ++j) {
+      T lat = j % 5 == 0 ? 0 : R.lat(), azi = j % 7 == 0 ? 0 :
+        R(-Math::hd, Math::hd);
+      lines.push_back(g.Line(lat, R(-Math::hd, Math::hd), azi));
+      clines.push_back(CompactGeodesicLine(g, lines.back()));
+    }
+    vector<size_t> ind(num);
+    vector<T> s12(num), lat(num), lon(num), azi(num), S12(num),
+      latc(num), lonc(num), azic(num), S12c(num);
+    for (size_t i = 0; i < num; ++i) {
+      ind[i] = size_t(R(0, T(nlines))) % nlines;
+      s12[i] = R(-3e7, 3e7);
+    }
+    unsigned mask = GeodesicLine::LATITUDE | GeodesicLine::LONGITUDE |
+      GeodesicLine::AZIMUTH | GeodesicLine::AREA;
+    for (size_t i = 0; i < num; ++i) {
+      T t;
+      lines[ind[i]].GenPosition(false, s12[i], mask,
+                                lat[i], lon[i], azi[i], t, t, t, t, S12[i]);
+    }
+    clk::time_point t0 = clk::now();
+    for (size_t i = 0; i < num; ++i) {
+      T t;
+      clines[ind[i]].GenPosition(false, s12[i], mask, latc[i], lonc[i],
+                                 azic[i], t, t, t, t, S12c[i]);
+    }
+    double secs = seconds(t0);
+    T e = max(max(maxdiff(lat, latc), maxdiff(lon, lonc)),
+              max(maxdiff(azi, azic), maxdiff(S12, S12c)));
+    n += report(string("CompactGeodesicLine vs GeodesicLine") +
+                (exact ? " (exact)" : ""), e, T(0), secs, num);
+  }
+  return n;
+}
+
+// Batch TransverseMercator vs scalar TransverseMercator (identical) and vs
+// TransverseMercatorExact (accuracy of the series).
+static int transversemercator(Random& R, size_t num) {
+  const TransverseMercator& tm = TransverseMercator::UTM();
+  const TransverseMercatorExact& tmx = TransverseMercatorExact::UTM();
+  Executor exec(4, 64);
+  int n = 0;
+  T lon0 = 3;
+  vector<T> lat(num), lon(num), x(num), y(num), gam(num), k(num),
+    xs(num), ys(num), gams(num), ks(num), xp(num), yp(num),
+    xx(num), yx(num), lat2(num), lon2(num), lat2s(num), lon2s(num);
+  // Within 35 degrees of the central meridian, where the series are
+  // accurate to about 5 nm.
+  for (size_t i = 0; i < num; ++i) {
+    lat[i] = R(-85, 85); lon[i] = lon0 + R(-35, 35);
+  }
+  clk::time_point t0 = clk::now();
+  tm.Forward(num, lon0, lat.data(), lon.data(), x.data(), y.data(),
+             gam.data(), k.data());
+  double secs = seconds(t0);
+  for (size_t i = 0; i < num; ++i) {
+    tm.Forward(lon0, lat[i], lon[i], xs[i], ys[i], gams[i], ks[i]);
+    tmx.Forward(lon0, lat[i], lon[i], xx[i], yx[i]);
+  }
+  tm.Forward(exec, num, lon0, lat.data(), lon.data(), xp.data(), yp.data());
+  n += report("TransverseMercator::Forward batch vs scalar",
+              max(max(maxdiff(x, xs), maxdiff(y, ys)),
+                  max(maxdiff(gam, gams), maxdiff(k, ks))), T(0), secs, num);
+  n += report("TransverseMercator::Forward parallel vs batch",
+              max(maxdiff(x, xp), maxdiff(y, yp)), T(0), secs, num);
+  n += report("TransverseMercator::Forward vs exact (m)",
+              max(maxdiff(x, xx), maxdiff(y, yx)), T(2e-8), secs, num);
+  t0 = clk::now();
+  tm.Reverse(num, lon0, x.data(), y.data(), lat2.data(), lon2.data());
+  secs = seconds(t0);
+  for (size_t i = 0; i < num; ++i)
+    tm.Reverse(lon0, x[i], y[i], lat2s[i], lon2s[i]);
+  n += report("TransverseMercator::Reverse batch vs scalar",
+              max(maxdiff(lat2, lat2s), maxdiff(lon2, lon2s)), T(0),
+              secs, num);
+  n += report("TransverseMercator round trip (m)",
+              posdiff(lat, lon, lat2, lon2), T(1e-8), secs, num);
+  {
+    // The poles, the equator on the back side, the full range of
+    // longitudes, and NaNs must be handled the same way by the blocks.
+    vector<T> la{90, -90, 0, -0.0, 0, 45, -30, 89, Math::NaN(), 10},
+      lo{lon0, lon0 + 120, lon0 + 180, lon0 - 150, lon0 + 90, lon0 - 90,
+         lon0 + 179, lon0 + 135, 0, Math::NaN()};
+    size_t m = la.size();
+    vector<T> xb(m), yb(m), gb(m), kb(m), xq(m), yq(m), gq(m), kq(m),
+      lab(m), lob(m), gbr(m), kbr(m), laq(m), loq(m), gqr(m), kqr(m);
+    tm.Forward(m, lon0, la.data(), lo.data(), xb.data(), yb.data(),
+               gb.data(), kb.data());
+    tm.Reverse(m, lon0, xb.data(), yb.data(), lab.data(), lob.data(),
+               gbr.data(), kbr.data());
+    for (size_t i = 0; i < m; ++i) {
+      tm.Forward(lon0, la[i], lo[i], xq[i], yq[i], gq[i], kq[i]);
+      tm.Reverse(lon0, xq[i], yq[i], laq[i], loq[i], gqr[i], kqr[i]);
+    }
+    n += report("TransverseMercator special points batch vs scalar",
+                max(max(max(maxdiff(xb, xq), maxdiff(yb, yq)),
+                        max(maxdiff(gb, gq), maxdiff(kb, kq))),
+                    max(max(maxdiff(lab, laq), maxdiff(lob, loq)),
+                        max(maxdiff(gbr, gqr), maxdiff(kbr, kqr)))),
+                T(0), 0, m);
+  }
+  return n;
+}
+
+// Batch PolarStereographic vs scalar.
+static int polarstereographic(Random& R, size_t num) {
+  const PolarStereographic& ps = PolarStereographic::UPS();
+  Executor exec(4, 64);
+  int n = 0;
+  vector<T> lat(num), lon(num), x(num), y(num), gam(num), k(num),
+    xs(num), ys(num), gams(num), ks(num), lat2(num), lon2(num),
+    lat2s(num), lon2s(num), lat2p(num), lon2p(num);
+  for (size_t i = 0; i < num; ++i) {
+    lat[i] = R(60, 90); lon[i] = R(-Math::hd, Math::hd);
+  }
+  clk::time_point t0 = clk::now();
+  ps.Forward(num, true, lat.data(), lon.data(), x.data(), y.data(),
+             gam.data(), k.data());
+  double secs = seconds(t0);
+  for (size_t i = 0; i < num; ++i)
+    ps.Forward(true, lat[i], lon[i], xs[i], ys[i], gams[i], ks[i]);
+  n += report("PolarStereographic::Forward batch vs scalar",
+              max(max(maxdiff(x, xs), maxdiff(y, ys)),
+                  max(maxdiff(gam, gams), maxdiff(k, ks))), T(0), secs, num);
+  t0 = clk::now();
+  ps.Reverse(num, true, x.data(), y.data(), lat2.data(), lon2.data());
+  secs = seconds(t0);
+  for (size_t i = 0; i < num; ++i)
+    ps.Reverse(true, x[i], y[i], lat2s[i], lon2s[i]);
+  ps.Reverse(exec, num, true, x.data(), y.data(), lat2p.data(), lon2p.data());
+  n += report("PolarStereographic::Reverse batch vs scalar",
+              max(maxdiff(lat2, lat2s), maxdiff(lon2, lon2s)), T(0),
+              secs, num);
+  n += report("PolarStereographic::Reverse parallel vs batch",
+              max(maxdiff(lat2, lat2p), maxdiff(lon2, lon2p)), T(0),
+              secs, num);
+  n += report("PolarStereographic round trip (m)",
+              posdiff(lat, lon, lat2, lon2), T(1e-8), secs, num);
+  return n;
+}
+
+// Batch OSGB vs scalar.
+static int osgb(Random& R, size_t num) {
+  int n = 0;
+  vector<T> lat(num), lon(num), x(num), y(num), xs(num), ys(num),
+    lat2(num), lon2(num), lat2s(num), lon2s(num);
+  for (size_t i = 0; i < num; ++i) {
+    lat[i] = R(49, 61); lon[i] = R(-9, 2);
+  }
+  clk::time_point t0 = clk::now();
+  OSGB::Forward(num, lat.data(), lon.data(), x.data(), y.data());
+  double secs = seconds(t0);
+  for (size_t i = 0; i < num; ++i) {
+    T gam, k;
+    OSGB::Forward(lat[i], lon[i], xs[i], ys[i], gam, k);
+  }
+  n += report("OSGB::Forward batch vs scalar",
+              max(maxdiff(x, xs), maxdiff(y, ys)), T(0), secs, num);
+  t0 = clk::now();
+  OSGB::Reverse(num, x.data(), y.data(), lat2.data(), lon2.data());
+  secs = seconds(t0);
+  for (size_t i = 0; i < num; ++i) {
+    T gam, k;
+    OSGB::Reverse(x[i], y[i], lat2s[i], lon2s[i], gam, k);
+  }
+  n += report("OSGB::Reverse batch vs scalar",
+              max(maxdiff(lat2, lat2s), maxdiff(lon2, lon2s)), T(0),
+              secs, num);
+  return n;
+}
+
+// Batch LocalCartesian::Forward and Reverse (with the rotation matrices)
+// vs scalar and the conversion between two local systems vs the conversion
+// via geodetic coordinates.
+static int localcartesian(Random& R, size_t num) {
+  int n = 0;
+  LocalCartesian lc(R(-90, 90), R(-180, 180), R(-100, 1000)),
+    lc2(lc.LatitudeOrigin() + R(-0.01, 0.01),
+        lc.LongitudeOrigin() + R(-0.01, 0.01), lc.HeightOrigin() + R(-10, 10));
+  vector<T> lat(num), lon(num), h(num), x(num), y(num), z(num),
+    xs(num), ys(num), zs(num), lat2(num), lon2(num), h2(num),
+    lat2s(num), lon2s(num), h2s(num), M(9 * num), Ms(9 * num);
+  for (size_t i = 0; i < num; ++i) {
+    lat[i] = lc.LatitudeOrigin() + R(-1, 1);
+    lat[i] = fmin(T(90), fmax(T(-90), lat[i]));
+    lon[i] = lc.LongitudeOrigin() + R(-1, 1); h[i] = R(-100, 10000);
+  }
+  clk::time_point t0 = clk::now();
+  lc.Forward(num, lat.data(), lon.data(), h.data(),
+             x.data(), y.data(), z.data(), M.data());
+  double secs = seconds(t0);
+  vector<T> m(9);
+  for (size_t i = 0; i < num; ++i) {
+    lc.Forward(lat[i], lon[i], h[i], xs[i], ys[i], zs[i], m);
+    copy(m.begin(), m.end(), Ms.begin() + 9 * i);
+  }
+  n += report("LocalCartesian::Forward batch vs scalar",
+              fmax(fmax(maxdiff(x, xs), maxdiff(y, ys)),
+                   fmax(maxdiff(z, zs), maxdiff(M, Ms))), T(0), secs, num);
+  t0 = clk::now();
+  lc.Reverse(num, x.data(), y.data(), z.data(),
+             lat2.data(), lon2.data(), h2.data(), M.data());
+  secs = seconds(t0);
+  for (size_t i = 0; i < num; ++i) {
+    lc.Reverse(x[i], y[i], z[i], lat2s[i], lon2s[i], h2s[i], m);
+    copy(m.begin(), m.end(), Ms.begin() + 9 * i);
+  }
+  n += report("LocalCartesian::Reverse batch vs scalar",
+              fmax(fmax(maxdiff(lat2, lat2s), maxdiff(lon2, lon2s)),
+                   fmax(maxdiff(h2, h2s), maxdiff(M, Ms))), T(0), secs, num);
+  t0 = clk::now();
+  lc2.FromLocal(lc, num, x.data(), y.data(), z.data(),
+                xs.data(), ys.data(), zs.data());
+  secs = seconds(t0);
+  lc2.Forward(num, lat.data(), lon.data(), h.data(),
+              x.data(), y.data(), z.data());
+  T e = 0;
+  for (size_t i = 0; i < num; ++i)
+    e = fmax(e, hypot(hypot(x[i] - xs[i], y[i] - ys[i]), z[i] - zs[i]));
+  n += report("LocalCartesian::FromLocal (m)", e, T(1e-8), secs, num);
+  return n;
+}
+
+// Pipeline vs the scalar conversions applied in turn (identical), with and
+// without threads, and Helmert::Reverse vs Helmert::Forward.
+static int pipeline(Random& R, size_t num) {
+  int n = 0;
+  Geocentric wgs72(6378135, 1/T(298.26)), wgs84(Geocentric::WGS84());
+  Helmert h72(0, 0, T(4.5), 0, 0, T(0.554), T(0.219)),
+    h72c(0, 0, T(4.5), 0, 0, -T(0.554), T(0.219), true),
+    h(R(-100, 100), R(-100, 100), R(-100, 100), R(-5, 5), R(-5, 5), R(-5, 5),
+      R(-20, 20));
+  LocalCartesian lc(R.lat(), R(-Math::hd, Math::hd), R(0, 1000));
+  const TransverseMercator& tm = TransverseMercator::UTM();
+  T lon0 = R(-Math::hd, Math::hd);
+  vector<T> lat(num), lon(num), hh(num);
+  for (size_t i = 0; i < num; ++i) {
+    lat[i] = R.lat(); lon[i] = R(-Math::hd, Math::hd); hh[i] = R(-100, 9000);
+  }
+  {
+    Pipeline p;
+    p.ToGeocentric(wgs72).Shift(h72).ToGeodetic(wgs84).ToUTMUPS();
+    vector<T> x(num), y(num), z(num), xc(num), yc(num), zc(num),
+      xt(num), yt(num), zt(num);
+    vector<int> zone(num), zonec(num), zonet(num);
+    unique_ptr<bool[]> northp(new bool[num]), northpc(new bool[num]),
+      northpt(new bool[num]);
+    for (size_t i = 0; i < num; ++i) {
+      T X, Y, Z, t;
+      wgs72.Forward(lat[i], lon[i], hh[i], X, Y, Z);
+      h72c.Forward(X, Y, Z, X, Y, Z);
+      wgs84.Reverse(X, Y, Z, t, zc[i], z[i]);
+      UTMUPS::Forward(t, zc[i], zonec[i], northpc[i], xc[i], yc[i]);
+      zc[i] = z[i];
+    }
+    p.Run(num, lat.data(), lon.data(), hh.data(), x.data(), y.data(),
+          z.data(), zone.data(), northp.get());
+    clk::time_point t0 = clk::now();
+    p.Run(Executor(4, 16), num, lat.data(), lon.data(), hh.data(),
+          xt.data(), yt.data(), zt.data(), zonet.data(), northpt.get());
+    double secs = seconds(t0);
+    size_t bad = 0;
+    for (size_t i = 0; i < num; ++i)
+      bad += zone[i] != zonec[i] || zonet[i] != zonec[i] ||
+        northp[i] != northpc[i] || northpt[i] != northpc[i];
+    T err = fmax(fmax(maxdiff(x, xc), maxdiff(y, yc)), maxdiff(z, zc));
+    err = fmax(err, fmax(fmax(maxdiff(xt, xc), maxdiff(yt, yc)),
+                         maxdiff(zt, zc)));
+    n += report("Pipeline geodetic to UTM with datum shift",
+                err + T(bad), T(0), secs, num);
+  }
+  {
+    // Geocentric input via a local system to transverse Mercator
+    Pipeline p(Pipeline::GEOCENTRIC);
+    p.ToLocalCartesian(lc).FromLocalCartesian(lc).Shift(h, true)
+      .ToGeodetic(wgs84).ToTransverseMercator(tm, lon0);
+    vector<T> X(num), Y(num), Z(num), x(num), y(num), z(num),
+      xc(num), yc(num), zc(num);
+    wgs84.Forward(num, lat.data(), lon.data(), hh.data(),
+                  X.data(), Y.data(), Z.data());
+    for (size_t i = 0; i < num; ++i) {
+      T a, b, c, la, lo;
+      lc.FromGeocentric(1, &X[i], &Y[i], &Z[i], &a, &b, &c);
+      lc.ToGeocentric(1, &a, &b, &c, &a, &b, &c);
+      h.Reverse(a, b, c, a, b, c);
+      wgs84.Reverse(a, b, c, la, lo, zc[i]);
+      tm.Forward(lon0, la, lo, xc[i], yc[i]);
+    }
+    clk::time_point t0 = clk::now();
+    p.Run(Executor(4, 16), num, X.data(), Y.data(), Z.data(),
+          x.data(), y.data(), z.data());
+    double secs = seconds(t0);
+    T err = fmax(fmax(maxdiff(x, xc), maxdiff(y, yc)), maxdiff(z, zc));
+    n += report("Pipeline geocentric to transverse Mercator", err, T(0),
+                secs, num);
+    // Helmert round trip (m)
+    vector<T> Xr(num), Yr(num), Zr(num);
+    h.Forward(num, X.data(), Y.data(), Z.data(),
+              Xr.data(), Yr.data(), Zr.data());
+    h.Reverse(Executor(4, 16), num, Xr.data(), Yr.data(), Zr.data(),
+              Xr.data(), Yr.data(), Zr.data());
+    err = fmax(fmax(maxdiff(X, Xr), maxdiff(Y, Yr)), maxdiff(Z, Zr));
+    size_t bad = 0;
+    try {
+      Pipeline q; q.ToUTMUPS().ToGeodetic(wgs84);
+      ++bad;
+    }
+    catch (const GeographicErr&) {}
+    n += report("Helmert::Reverse round trip (m)", err + T(bad), T(1e-8),
+                0, num);
+  }
+  return n;
+}
+
+// The coordinates computed on demand by GeoCoords vs UTMUPS.  The GeoCoords
+// objects for MGRS input are completed concurrently by 4 threads.
+static int geocoords(Random& R, size_t num) {
+  int n = 0;
+  vector<T> lat(num), lon(num), x(num), y(num), gam(num), k(num),
+    xs(num), ys(num), gams(num), ks(num), lat2(4 * num), lon2(4 * num),
+    lat2s(num), lon2s(num);
+  vector<GeoCoords> p(num);
+  vector<string> mgrs(num);
+  for (size_t i = 0; i < num; ++i) {
+    lat[i] = R.lat(); lon[i] = R(-180, 180);
+    int zone; bool northp;
+    UTMUPS::Forward(lat[i], lon[i], zone, northp, xs[i], ys[i],
+                    gams[i], ks[i]);
+    MGRS::Forward(zone, northp, xs[i], ys[i], 5, mgrs[i]);
+  }
+  clk::time_point t0 = clk::now();
+  for (size_t i = 0; i < num; ++i) {
+    p[i].Reset(lat[i], lon[i]);
+    x[i] = p[i].Easting(); y[i] = p[i].Northing();
+    gam[i] = p[i].Convergence(); k[i] = p[i].Scale();
+  }
+  double secs = seconds(t0);
+  n += report("GeoCoords geographic input vs UTMUPS",
+              fmax(fmax(maxdiff(x, xs), maxdiff(y, ys)),
+                   fmax(maxdiff(gam, gams), maxdiff(k, ks))),
+              T(0), secs, num);
+  for (size_t i = 0; i < num; ++i) {
+    p[i].Reset(mgrs[i]);
+    int zone, prec; bool northp;
+    MGRS::Reverse(mgrs[i], zone, northp, x[i], y[i], prec);
+    UTMUPS::Reverse(zone, northp, x[i], y[i], lat2s[i], lon2s[i],
+                    gams[i], ks[i]);
+  }
+  Executor exec(4, num);
+  t0 = clk::now();
+  exec.For(4 * num, [&p, &lat2, &lon2, num](size_t i0, size_t i1) -> void {
+    for (size_t i = i0; i < i1; ++i) {
+      lat2[i] = p[i % num].Latitude(); lon2[i] = p[i % num].Longitude();
+    }
+  });
+  secs = seconds(t0);
+  T e = 0;
+  for (size_t j = 0; j < 4; ++j)
+    for (size_t i = 0; i < num; ++i)
+      e = fmax(e, fmax(fabs(lat2[j * num + i] - lat2s[i]),
+                       fabs(lon2[j * num + i] - lon2s[i])));
+  n += report("GeoCoords MGRS input, concurrent access", e, T(0),
+              secs, 4 * num);
+  return n;
+}
+
+// Batch Rhumb::GenInverse vs scalar and PolygonAreaRhumb::AddPoints vs
+// AddPoint.
+static int rhumb(Random& R, size_t num) {
+  const Rhumb& rh = Rhumb::WGS84();
+  Executor exec(4, 64);
+  int n = 0;
+  vector<T> lat(num + 1), lon(num + 1), s12(num), azi12(num), S12(num),
+    s12s(num), azi12s(num), S12s(num);
+  // A random walk, so that the points define a reasonable polygon
+  lat[0] = 0; lon[0] = 0;
+  for (size_t i = 1; i <= num; ++i) {
+    lat[i] = fmin(T(80), fmax(T(-80), lat[i-1] + R(-1, 1)));
+    lon[i] = lon[i-1] + R(-1, 1.5);
+  }
+  clk::time_point t0 = clk::now();
+  rh.GenInverse(num, lat.data(), lon.data(), lat.data() + 1, lon.data() + 1,
+                Rhumb::ALL, s12.data(), azi12.data(), S12.data());
+  double secs = seconds(t0);
+  for (size_t i = 0; i < num; ++i)
+    rh.GenInverse(lat[i], lon[i], lat[i+1], lon[i+1], Rhumb::ALL,
+                  s12s[i], azi12s[i], S12s[i]);
+  n += report("Rhumb::GenInverse batch vs scalar",
+              max(max(maxdiff(s12, s12s), maxdiff(azi12, azi12s)),
+                  maxdiff(S12, S12s)), T(0), secs, num);
+  PolygonAreaRhumb p(rh), pb(rh), pp(rh);
+  for (size_t i = 0; i <= num; ++i) p.AddPoint(lat[i], lon[i]);
+  t0 = clk::now();
+  pb.AddPoints(num + 1, lat.data(), lon.data());
+  secs = seconds(t0);
+  pp.AddPoints(exec, num + 1, lat.data(), lon.data());
+  T perim, area, perimb, areab, perimp, areap;
+  p.Compute(false, true, perim, area);
+  pb.Compute(false, true, perimb, areab);
+  pp.Compute(false, true, perimp, areap);
+  n += report("PolygonAreaRhumb::AddPoints vs AddPoint",
+              max(fabs(perimb - perim), fabs(areab - area)), T(0),
+              secs, num);
+  n += report("PolygonAreaRhumb::AddPoints parallel (m^2)",
+              fabs(areap - area), 8 * numeric_limits<T>::epsilon() *
+              fabs(area), secs, num);
+  return n;
+}
+
+// JacobiConformal array (Fourier series) vs scalar (direct evaluation) for
+// a nearly spherical triaxial Earth, the asteroid Vesta, and a flat
+// ellipsoid for which the y series doesn't converge (so the array version
+// falls back to direct evaluation).
+static int jacobi(Random& R, size_t num) {
+  int n = 0;
+  const T axes[][3] = {{6378137+35, 6378137-35, 6356752},
+                       {286.3, 278.6, 223.2}, {10, T(9.999), 1}};
+  T err = 0, errp = 0;
+  double secs = 0;
+  vector<T> omg(num), bet(num), x(num), y(num), xs(num), ys(num),
+    xp(num), yp(num);
+  for (const auto& ax : axes) {
+    JacobiConformal jc(ax[0], ax[1], ax[2]);
+    for (size_t i = 0; i < num; ++i) {
+      omg[i] = R(-180, 180); bet[i] = R(-180, 180);
+      xs[i] = jc.x(omg[i]); ys[i] = jc.y(bet[i]);
+    }
+    clk::time_point t0 = clk::now();
+    jc.x(num, omg.data(), x.data());
+    jc.y(num, bet.data(), y.data());
+    secs += seconds(t0);
+    Executor exec(4, 64);
+    jc.x(exec, num, omg.data(), xp.data());
+    jc.y(exec, num, bet.data(), yp.data());
+    err = fmax(err, fmax(maxdiff(x, xs), maxdiff(y, ys)));
+    errp = fmax(errp, fmax(maxdiff(x, xp), maxdiff(y, yp)));
+  }
+  n += report("JacobiConformal array vs scalar (deg)", err, T(1e-11),
+              secs, 2 * 3 * num);
+  n += report("JacobiConformal parallel vs array", errp, T(0), secs,
+              2 * 3 * num);
+  return n;
+}
+
+// AuxAngleArray and the array versions of AuxLatitude::Convert vs the
+// scalar versions.
+static int auxangles(Random& R, size_t num) {
+  int n = 0;
+  const T inf = Math::infinity(), nan = Math::NaN(),
+    big = numeric_limits<T>::max();
+  // Include the special cases handled by AuxAngle::normalized
+  const T special[][2] = {{0, 0}, {inf, inf}, {nan, 1}, {1, nan},
+                          {big, big}, {inf, 1}, {-1, -inf}, {-0.0, -1}};
+  const size_t nspecial = sizeof(special) / sizeof(special[0]);
+  AuxAngleArray zeta(num), p(num);
+  for (size_t i = 0; i < num; ++i) {
+    if (i < nspecial)
+      zeta.set(i, AuxAngle(special[i][0], special[i][1]));
+    else
+      zeta.set(i, AuxAngle(R(-10, 10), R(-10, 10)));
+    p.set(i, AuxAngle::degrees(R(-180, 180)));
+  }
+  vector<T> y(num), ys(num), x(num), xs(num);
+  clk::time_point t0 = clk::now();
+  AuxAngleArray zetan(zeta.normalized());
+  double secs = seconds(t0);
+  for (size_t i = 0; i < num; ++i) {
+    AuxAngle z(zeta[i].normalized());
+    y[i] = zetan.y()[i]; x[i] = zetan.x()[i]; ys[i] = z.y(); xs[i] = z.x();
+  }
+  n += report("AuxAngleArray::normalized vs scalar",
+              fmax(maxdiff(y, ys), maxdiff(x, xs)), T(0), secs, num);
+  AuxAngleArray q(zetan);
+  t0 = clk::now();
+  q += p;
+  secs = seconds(t0);
+  AuxAngleArray r(q.copyquadrant(p));
+  for (size_t i = 0; i < num; ++i) {
+    AuxAngle z(zetan[i]);
+    z += p[i];
+    y[i] = q.y()[i]; x[i] = q.x()[i]; ys[i] = z.y(); xs[i] = z.x();
+  }
+  n += report("AuxAngleArray::operator+= vs scalar",
+              fmax(maxdiff(y, ys), maxdiff(x, xs)), T(0), secs, num);
+  for (size_t i = 0; i < num; ++i) {
+    AuxAngle z(q[i].copyquadrant(p[i]));
+    y[i] = r.y()[i]; x[i] = r.x()[i]; ys[i] = z.y(); xs[i] = z.x();
+  }
+  n += report("AuxAngleArray::copyquadrant vs scalar",
+              fmax(maxdiff(y, ys), maxdiff(x, xs)), T(0), secs, num);
+  t0 = clk::now();
+  zetan.degrees(y.data());
+  secs = seconds(t0);
+  zetan.tan(x.data());
+  for (size_t i = 0; i < num; ++i) {
+    ys[i] = zetan[i].degrees(); xs[i] = zetan[i].tan();
+  }
+  n += report("AuxAngleArray::degrees and tan vs scalar",
+              fmax(maxdiff(y, ys), maxdiff(x, xs)), T(0), secs, num);
+
+  // Convert between all pairs of auxiliary latitudes
+  AuxLatitude aux(Constants::WGS84_a(), Constants::WGS84_f());
+  T err[2] = {0, 0};
+  double secsc[2] = {0, 0};
+  AuxAngleArray eta;
+  for (int exact = 0; exact < 2; ++exact) {
+    for (int auxin = 0; auxin < AuxLatitude::AUXNUMBER; ++auxin) {
+      for (int auxout = 0; auxout < AuxLatitude::AUXNUMBER; ++auxout) {
+        t0 = clk::now();
+        aux.Convert(auxin, auxout, p, eta, exact != 0);
+        secsc[exact] += seconds(t0);
+        for (size_t i = 0; i < num; ++i) {
+          AuxAngle e(aux.Convert(auxin, auxout, p[i], exact != 0));
+          y[i] = eta.y()[i]; x[i] = eta.x()[i]; ys[i] = e.y(); xs[i] = e.x();
+        }
+        err[exact] = fmax(err[exact], fmax(maxdiff(y, ys), maxdiff(x, xs)));
+      }
+    }
+  }
+  const int npairs = AuxLatitude::AUXNUMBER * AuxLatitude::AUXNUMBER;
+  n += report("AuxLatitude::Convert array vs scalar", err[0], T(0),
+              secsc[0], num * npairs);
+  n += report("AuxLatitude::Convert array vs scalar (exact)", err[1], T(0),
+              secsc[1], num * npairs);
+  return n;
+}
+
+// The number of entries in two arrays which differ, counting zeros of
+// opposite sign as different and NaNs as equal.
+static T mismatches(const vector<T>& a, const vector<T>& b) {
+  size_t k = 0;
+  for (size_t i = 0; i < a.size(); ++i)
+    if (!(isnan(a[i]) && isnan(b[i])) &&
+        !(a[i] == b[i] && signbit(a[i]) == signbit(b[i])))
+      ++k;
+  return T(k);
+}
+
+static int angles(Random& R, size_t num) {
+  // Random angles, including multiples of 15 deg, signed zeros, ties for the
+  // reduction, and large values which use the scalar fallback.
+  int n = 0;
+  const T special[] = {0, -T(0), 90, -90, 180, -180, 270, -270, 360, -360,
+                       540, -540, numeric_limits<T>::min(), T(1 << 22),
+                       T(-1e10),
+                       numeric_limits<T>::infinity(),
+                       numeric_limits<T>::quiet_NaN()};
+  const size_t nspecial = sizeof(special) / sizeof(special[0]);
+  vector<T> x(num), y(num), a(num), b(num), as(num), bs(num);
+  for (size_t i = 0; i < num; ++i) {
+    if (i % 10 == 0) {
+      x[i] = special[i / 10 % nspecial]; y[i] = special[i / 7 % nspecial];
+    } else if (i % 10 == 1) {
+      x[i] = 15 * floor(R(-100, 100)); y[i] = R(-1, 1) < 0 ? -T(0) : T(0);
+    } else {
+      x[i] = R(-1000, 1000); y[i] = R(-1000, 1000);
+    }
+  }
+  clk::time_point t0 = clk::now();
+  Math::sincosd(num, x.data(), a.data(), b.data());
+  double secs = seconds(t0);
+  for (size_t i = 0; i < num; ++i)
+    Math::sincosd(x[i], as[i], bs[i]);
+  n += report("Math::sincosd array vs scalar",
+              mismatches(a, as) + mismatches(b, bs), T(0), secs, num);
+  t0 = clk::now();
+  Math::atan2d(num, y.data(), x.data(), a.data());
+  secs = seconds(t0);
+  for (size_t i = 0; i < num; ++i)
+    as[i] = Math::atan2d(y[i], x[i]);
+  n += report("Math::atan2d array vs scalar", mismatches(a, as), T(0),
+              secs, num);
+  t0 = clk::now();
+  Math::AngNormalize(num, x.data(), a.data());
+  secs = seconds(t0);
+  for (size_t i = 0; i < num; ++i)
+    as[i] = Math::AngNormalize(x[i]);
+  n += report("Math::AngNormalize array vs scalar", mismatches(a, as), T(0),
+              secs, num);
+  t0 = clk::now();
+  Math::AngDiff(num, x.data(), y.data(), a.data(), b.data());
+  secs = seconds(t0);
+  for (size_t i = 0; i < num; ++i)
+    as[i] = Math::AngDiff(x[i], y[i], bs[i]);
+  n += report("Math::AngDiff array vs scalar",
+              mismatches(a, as) + mismatches(b, bs), T(0), secs, num);
+  return n;
+}
+
+// Array versions of DST::eval and DST::integral, of some of the
+// DAuxLatitude functions, and of Math::taupf and Math::tauf vs the scalar
+// versions.
+static int kernels(Random& R, size_t num) {
+  int n = 0;
+  const int N = 100;
+  vector<T> F(N), s(num), c(num), y(num), ys(num), I(num), Is(num);
+  for (int l = 0; l < N; ++l) F[l] = R(-1, 1) / ((2*l+1) * (2*l+1));
+  for (size_t i = 0; i < num; ++i) {
+    T t = R(-Math::hd, Math::hd);
+    Math::sincosd(t, s[i], c[i]);
+  }
+  clk::time_point t0 = clk::now();
+  DST::eval(num, s.data(), c.data(), F.data(), N, y.data());
+  double secs = seconds(t0);
+  for (size_t i = 0; i < num; ++i)
+    ys[i] = DST::eval(s[i], c[i], F.data(), N);
+  n += report("DST::eval array vs scalar", maxdiff(y, ys), T(0), secs, num);
+  t0 = clk::now();
+  DST::integral(num, s.data(), c.data(), F.data(), N, I.data());
+  secs = seconds(t0);
+  for (size_t i = 0; i < num; ++i)
+    Is[i] = DST::integral(s[i], c[i], F.data(), N);
+  n += report("DST::integral array vs scalar", maxdiff(I, Is), T(0),
+              secs, num);
+
+  DAuxLatitude aux(Constants::WGS84_a(), Constants::WGS84_f());
+  vector<T> y1(num), x1(num), y2(num), x2(num), D(num), Ds(num);
+  for (size_t i = 0; i < num; ++i) {
+    AuxAngle phi1(AuxAngle::degrees(R(-90, 90))),
+      phi2(AuxAngle::degrees(i % 10 == 0 ? phi1.degrees() : R(-90, 90)));
+    y1[i] = phi1.y(); x1[i] = phi1.x(); y2[i] = phi2.y(); x2[i] = phi2.x();
+  }
+  t0 = clk::now();
+  aux.DConvert(num, AuxLatitude::PHI, AuxLatitude::MU,
+               y1.data(), x1.data(), y2.data(), x2.data(), D.data());
+  secs = seconds(t0);
+  for (size_t i = 0; i < num; ++i)
+    Ds[i] = aux.DConvert(AuxLatitude::PHI, AuxLatitude::MU,
+                         AuxAngle(y1[i], x1[i]), AuxAngle(y2[i], x2[i]));
+  n += report("DAuxLatitude::DConvert array vs scalar", maxdiff(D, Ds), T(0),
+              secs, num);
+  t0 = clk::now();
+  aux.DIsometric(num, y1.data(), x1.data(), y2.data(), x2.data(), D.data());
+  secs = seconds(t0);
+  for (size_t i = 0; i < num; ++i)
+    Ds[i] = aux.DIsometric(AuxAngle(y1[i], x1[i]), AuxAngle(y2[i], x2[i]));
+  n += report("DAuxLatitude::DIsometric array vs scalar", maxdiff(D, Ds),
+              T(0), secs, num);
+
+  T es = sqrt(Constants::WGS84_f() * (2 - Constants::WGS84_f()));
+  vector<T> tau(num), taup(num), taups(num), tau2(num), tau2s(num);
+  for (size_t i = 0; i < num; ++i)
+    tau[i] = Math::tand(R(-89.9, 89.9));
+  t0 = clk::now();
+  Math::taupf(num, tau.data(), taup.data(), es);
+  secs = seconds(t0);
+  for (size_t i = 0; i < num; ++i)
+    taups[i] = Math::taupf(tau[i], es);
+  n += report("Math::taupf array vs scalar", maxdiff(taup, taups), T(0),
+              secs, num);
+  t0 = clk::now();
+  Math::tauf(num, taup.data(), tau2.data(), es);
+  secs = seconds(t0);
+  for (size_t i = 0; i < num; ++i)
+    tau2s[i] = Math::tauf(taup[i], es);
+  n += report("Math::tauf array vs scalar", maxdiff(tau2, tau2s), T(0),
+              secs, num);
+  T e = 0;
+  for (size_t i = 0; i < num; ++i) {
+    T d = fabs(tau2[i] - tau[i]) / fmax(T(1), fabs(tau[i]));
+    if (!(d <= e)) e = d;
+  }
+  n += report("Math::tauf round trip (relative)", e,
+              T(8) * numeric_limits<T>::epsilon(), secs, num);
+  return n;
+}
+
+// GravityTrack vs GravityCircle.  This needs a gravity model and so it is
+// only run if the name of the model is given.  The reference values are
+// given by a GravityCircle at the latitude of each point, so that only the
+// interpolation error is measured; this must be less than eps times the
+// largest magnitude of each quantity.  Half the points are within 3 circle
+// spacings of the poles, where the stencils are one-sided.
+static int gravitytrack(Random& R, size_t num, const string& name,
+                        const string& path) {
+  // Truncate the model so that the reference values are cheap to compute
+  GravityModel grav(name, path, 360, 360);
+  const T eps = T(1e-6), h = 0;
+  const unsigned caps = GravityModel::GRAVITY | GravityModel::DISTURBANCE |
+    GravityModel::GEOID_HEIGHT;
+  GravityTrack track(grav, h, eps, caps);
+  size_t m = min(num, size_t(200));
+  T d = 3 * track.LatitudeSpacing();
+  vector<T> lat(m), lon(m);
+  for (size_t i = 0; i < m; ++i) {
+    lat[i] = i % 2 ? R.lat() : (i % 4 ? 1 : -1) * (Math::qd - R(0, d));
+    lon[i] = R(-Math::hd, Math::hd);
+  }
+  // Sort by latitude so that consecutive points share circles
+  vector<size_t> ind(m);
+  for (size_t i = 0; i < m; ++i) ind[i] = i;
+  sort(ind.begin(), ind.end(),
+       [&lat](size_t a, size_t b) -> bool { return lat[a] < lat[b]; });
+  {
+    vector<T> la(m), lo(m);
+    for (size_t i = 0; i < m; ++i) {
+      la[i] = lat[ind[i]]; lo[i] = lon[ind[i]];
+    }
+    lat.swap(la); lon.swap(lo);
+  }
+  // The 9 quantities: gx, gy, gz, W, deltax, deltay, deltaz, T, N
+  const int nq = 9;
+  vector< vector<T> > v(nq, vector<T>(m)), vs(nq, vector<T>(m));
+  clk::time_point t0 = clk::now();
+  track.Gravity(m, lat.data(), lon.data(),
+                v[0].data(), v[1].data(), v[2].data(), v[3].data());
+  track.Disturbance(m, lat.data(), lon.data(),
+                    v[4].data(), v[5].data(), v[6].data(), v[7].data());
+  track.GeoidHeight(m, lat.data(), lon.data(), v[8].data());
+  double secs = seconds(t0);
+  for (size_t i = 0; i < m; ++i) {
+    GravityCircle c(grav.Circle(lat[i], h, caps));
+    vs[3][i] = c.Gravity(lon[i], vs[0][i], vs[1][i], vs[2][i]);
+    vs[7][i] = c.Disturbance(lon[i], vs[4][i], vs[5][i], vs[6][i]);
+    vs[8][i] = c.GeoidHeight(lon[i]);
+  }
+  T e = 0;
+  for (int q = 0; q < nq; ++q) {
+    T big = 0;
+    for (size_t i = 0; i < m; ++i) big = fmax(big, fabs(vs[q][i]));
+    e = fmax(e, maxdiff(v[q], vs[q]) / big);
+  }
+  return report("GravityTrack vs GravityCircle (relative)", e, eps, secs, m);
+}
+
+int main(int argc, const char* const argv[]) {
+  try {
+    unsigned long long seed = argc > 1 ?
+      Utility::val<unsigned long long>(string(argv[1])) : 20260101ULL;
+    size_t num = argc > 2 ? Utility::val<size_t>(string(argv[2])) :
+#if GEOGRAPHICLIB_PRECISION == 5
+      // mpfr is slow
+      200
+#else
+      2000
+#endif
+      ;
+    Random R(seed);
+    cout << "difftest seed " << seed << " num " << num << "\n"
+         << left << setw(46) << "check" << right << setw(12) << "error"
+         << setw(12) << "tolerance" << setw(12) << "ns/point" << "\n";
+    int n = 0;
+    n += geodesic(R, num);
+    n += batches(R, num);
+    n += warmstart(R, num);
+    n += within(R, num);
+    n += crosstrack(R, num);
+    n += simplify(R, num);
+    n += equalareagrid(R, num);
+    n += compactline(R, num);
+    n += transversemercator(R, num);
+    n += polarstereographic(R, num);
+    n += osgb(R, num);
+    n += localcartesian(R, num);
+    n += pipeline(R, num);
+    n += geocoords(R, num);
+    n += rhumb(R, num);
+    n += jacobi(R, num);
+    n += auxangles(R, num);
+    n += angles(R, num);
+    n += kernels(R, num);
+    if (argc > 3)
+      n += gravitytrack(R, num, string(argv[3]),
+                        argc > 4 ? string(argv[4]) : string());
+    if (n) {
+      cout << n << " failure" << (n > 1 ? "s" : "") << "\n";
+      return 1;
+    }
+  }
+  catch (const exception& e) {
+    cerr << "Caught exception: " << e.what() << "\n";
+    return 1;
+  }
+  return 0;
+}
@@ -2,7 +2,7 @@
  * \file CartConvert.cpp
  * \brief Command line utility for geodetic to cartesian coordinate conversions
  *
- * Copyright (c) Charles Karney (2009-2017) <karney@alum.mit.edu> and licensed
+ * Copyright (c) Charles Karney (2009-2026) <karney@alum.mit.edu> and licensed
  * under the MIT/X11 License.  For more information, see
  * https://geographiclib.sourceforge.io/
  *
@@ -13,10 +13,18 @@
 #include <string>
 #include <sstream>
 #include <fstream>
+#include <vector>
 #include <GeographicLib/Geocentric.hpp>
 #include <GeographicLib/LocalCartesian.hpp>
 #include <GeographicLib/DMS.hpp>
 #include <GeographicLib/Utility.hpp>
+#include <GeographicLib/Executor.hpp>
+
+#if defined(_WIN32)
+// For _setmode to put standard input and output into binary mode
+#  include <io.h>
+#  include <fcntl.h>
+#endif
 
 #if defined(_MSC_VER)
 // Squelch warnings about constant conditional expressions and potentially
@@ -26,16 +34,148 @@
 
 #include "CartConvert.usage"
 
+namespace {
+
+  using namespace GeographicLib;
+
+  // The conversion.  This is fixed once the command line has been parsed, so
+  // the member functions can be called concurrently from several threads.
+  class Converter {
+  private:
+    typedef Math::real real;
+    const Geocentric& _ec;
+    const LocalCartesian& _lc;
+    bool _localcartesian, _reverse, _longfirst;
+    int _prec;
+    std::string _cdelim;
+  public:
+    Converter(const Geocentric& ec, const LocalCartesian& lc,
+              bool localcartesian, bool reverse, bool longfirst,
+              int prec, const std::string& cdelim)
+      : _ec(ec)
+      , _lc(lc)
+      , _localcartesian(localcartesian)
+      , _reverse(reverse)
+      , _longfirst(longfirst)
+      , _prec(prec)
+      , _cdelim(cdelim)
+    {}
+    // Parse the input line s setting the coordinates a, b, c (lat, lon, h or
+    // x, y, z with -r) and the end of line eol.  Throw on error.
+    void Parse(std::string s, real& a, real& b, real& c, std::string& eol)
+      const {
+      eol = "\n";
+      if (!_cdelim.empty()) {
+        std::string::size_type m = s.find(_cdelim);
+        if (m != std::string::npos) {
+          eol = " " + s.substr(m) + "\n";
+          s = s.substr(0, m);
+        }
+      }
+      std::istringstream str(s);
+      std::string stra, strb, strc, strd;
+      if (!(str >> stra >> strb >> strc))
+        throw GeographicErr("Incomplete input: " + s);
+      if (_reverse) {
+        a = Utility::val<real>(stra);
+        b = Utility::val<real>(strb);
+      } else
+        DMS::DecodeLatLon(stra, strb, a, b, _longfirst);
+      c = Utility::val<real>(strc);
+      if (str >> strd)
+        throw GeographicErr("Extraneous input: " + strd);
+    }
+    // Convert num points (a, b, c) to (a1, b1, c1) using the batch routines.
+    void Convert(size_t num, const real a[], const real b[], const real c[],
+                 real a1[], real b1[], real c1[]) const {
+      if (_reverse) {
+        if (_localcartesian)
+          _lc.Reverse(num, a, b, c, a1, b1, c1);
+        else
+          _ec.Reverse(num, a, b, c, a1, b1, c1);
+      } else {
+        if (_localcartesian)
+          _lc.Forward(num, a, b, c, a1, b1, c1);
+        else
+          _ec.Forward(num, a, b, c, a1, b1, c1);
+      }
+    }
+    // Format the result of a conversion.
+    std::string Format(real a1, real b1, real c1, const std::string& eol)
+      const {
+      return _reverse ?
+        Utility::str(_longfirst ? b1 : a1, _prec + 5) + " " +
+        Utility::str(_longfirst ? a1 : b1, _prec + 5) + " " +
+        Utility::str(c1, _prec) + eol :
+        Utility::str(a1, _prec) + " " +
+        Utility::str(b1, _prec) + " " +
+        Utility::str(c1, _prec) + eol;
+    }
+    // Convert lines [i0, i1) of lines setting outs and ok (false on error).
+    void Lines(const std::vector<std::string>& lines,
+               std::vector<std::string>& outs, std::vector<char>& ok,
+               size_t i0, size_t i1) const {
+      size_t n = i1 - i0, k = 0;
+      std::vector<real> v(6 * n);
+      std::vector<size_t> ind(n);
+      std::vector<std::string> eols(n);
+      real *a = v.data(), *b = a + n, *c = b + n,
+        *a1 = c + n, *b1 = a1 + n, *c1 = b1 + n;
+      for (size_t i = i0; i < i1; ++i) {
+        try {
+          Parse(lines[i], a[k], b[k], c[k], eols[k]);
+          ind[k++] = i;
+          ok[i] = true;
+        }
+        catch (const std::exception& e) {
+          // Write error message to output so output lines match input lines
+          outs[i] = std::string("ERROR: ") + e.what() + "\n";
+          ok[i] = false;
+        }
+      }
+      Convert(k, a, b, c, a1, b1, c1);
+      for (size_t j = 0; j < k; ++j)
+        outs[ind[j]] = Format(a1[j], b1[j], c1[j], eols[j]);
+    }
+    // Convert num binary records in place.  Each record is 3 doubles
+    // (lat, lon, h or x, y, z; with -w, lon precedes lat).
+    void Records(size_t num, double rec[]) const {
+      const size_t blk = 1024;
+      real v[6 * blk];
+      real *a = v, *b = a + blk, *c = b + blk,
+        *a1 = c + blk, *b1 = a1 + blk, *c1 = b1 + blk;
+      bool swapin = _longfirst && !_reverse, swapout = _longfirst && _reverse;
+      for (size_t i0 = 0; i0 < num; i0 += blk) {
+        size_t n = std::min(blk, num - i0);
+        double* r = rec + 3 * i0;
+        for (size_t j = 0; j < n; ++j) {
+          a[j] = real(r[3*j + (swapin ? 1 : 0)]);
+          b[j] = real(r[3*j + (swapin ? 0 : 1)]);
+          c[j] = real(r[3*j + 2]);
+        }
+        Convert(n, a, b, c, a1, b1, c1);
+        for (size_t j = 0; j < n; ++j) {
+          r[3*j + (swapout ? 1 : 0)] = double(a1[j]);
+          r[3*j + (swapout ? 0 : 1)] = double(b1[j]);
+          r[3*j + 2] = double(c1[j]);
+        }
+      }
+    }
+  };
+
+} // namespace
+
 int main(int argc, const char* const argv[]) {
   try {
     using namespace GeographicLib;
     typedef Math::real real;
     Utility::set_digits();
-    bool localcartesian = false, reverse = false, longfirst = false;
+    bool localcartesian = false, reverse = false, longfirst = false,
+      binary = false;
     real
       a = Constants::WGS84_a(),
       f = Constants::WGS84_f();
-    int prec = 6;
+    int prec = 6, nthreads = 1;
     real lat0 = 0, lon0 = 0, h0 = 0;
     std::string istring, ifile, ofile, cdelim;
     char lsep = ';';
@@ -79,7 +219,22 @@ int main(int argc, const char* const argv[]) {
           std::cerr << "Precision " << argv[m] << " is not a number\n";
           return 1;
         }
-      }  else if (arg == "--input-string") {
+      } else if (arg == "--threads") {
+        if (++m == argc) return usage(1, true);
+        try {
+          nthreads = Utility::val<int>(std::string(argv[m]));
+        }
+        catch (const std::exception&) {
+          std::cerr << "Number of threads " << argv[m] << " is not a number\n";
+          return 1;
+        }
+        if (nthreads < 0) {
+          std::cerr << "Number of threads " << nthreads << " is negative\n";
+          return 1;
+        }
+      } else if (arg == "--binary")
+        binary = true;
+      else if (arg == "--input-string") {
         if (++m == argc) return usage(1, true);
         istring = argv[m];
       } else if (arg == "--input-file") {
@@ -98,7 +253,7 @@ int main(int argc, const char* const argv[]) {
       } else if (arg == "--comment-delimiter") {
         if (++m == argc) return usage(1, true);
         cdelim = argv[m];
-     } else if (arg == "--version") {
+      } else if (arg == "--version") {
         std::cout << argv[0] << ": GeographicLib version "
                   << GEOGRAPHICLIB_VERSION_STRING << "\n";
         return 0;
@@ -110,11 +265,16 @@ int main(int argc, const char* const argv[]) {
       std::cerr << "Cannot specify --input-string and --input-file together\n";
       return 1;
     }
+    if (binary && !istring.empty()) {
+      std::cerr << "Cannot specify --input-string and --binary together\n";
+      return 1;
+    }
     if (ifile == "-") ifile.clear();
     std::ifstream infile;
     std::istringstream instring;
     if (!ifile.empty()) {
-      infile.open(ifile.c_str());
+      infile.open(ifile.c_str(), binary ? std::ios::in | std::ios::binary :
+                  std::ios::in);
       if (!infile.is_open()) {
         std::cerr << "Cannot open " << ifile << " for reading\n";
         return 1;
@@ -135,13 +295,20 @@ int main(int argc, const char* const argv[]) {
     std::ofstream outfile;
     if (ofile == "-") ofile.clear();
     if (!ofile.empty()) {
-      outfile.open(ofile.c_str());
+      outfile.open(ofile.c_str(), binary ? std::ios::out | std::ios::binary :
+                   std::ios::out);
       if (!outfile.is_open()) {
         std::cerr << "Cannot open " << ofile << " for writing\n";
         return 1;
       }
     }
     std::ostream* output = !ofile.empty() ? &outfile : &std::cout;
+#if defined(_WIN32)
+    if (binary) {
+      if (ifile.empty()) _setmode(_fileno(stdin), _O_BINARY);
+      if (ofile.empty()) _setmode(_fileno(stdout), _O_BINARY);
+    }
+#endif
 
     const Geocentric ec(a, f);
     const LocalCartesian lc(lat0, lon0, h0, ec);
@@ -149,55 +316,70 @@ int main(int argc, const char* const argv[]) {
     // Max precision = 10: 0.1 nm in distance, 10^-15 deg (= 0.11 nm),
     // 10^-11 sec (= 0.3 nm).
     prec = std::min(10 + Math::extra_digits(), std::max(0, prec));
-    std::string s, eol, stra, strb, strc, strd;
-    std::istringstream str;
+    const Converter conv(ec, lc, localcartesian, reverse, longfirst,
+                         prec, cdelim);
     int retval = 0;
-    while (std::getline(*input, s)) {
-      try {
-        eol = "\n";
-        if (!cdelim.empty()) {
-          std::string::size_type m = s.find(cdelim);
-          if (m != std::string::npos) {
-            eol = " " + s.substr(m) + "\n";
-            s = s.substr(0, m);
-          }
-        }
-        str.clear(); str.str(s);
-        // initial values to suppress warnings
-        real lat, lon, h, x = 0, y = 0, z = 0;
-        if (!(str >> stra >> strb >> strc))
-          throw GeographicErr("Incomplete input: " + s);
-        if (reverse) {
-          x = Utility::val<real>(stra);
-          y = Utility::val<real>(strb);
-          z = Utility::val<real>(strc);
-        } else {
-          DMS::DecodeLatLon(stra, strb, lat, lon, longfirst);
-          h = Utility::val<real>(strc);
-        }
-        if (str >> strd)
-          throw GeographicErr("Extraneous input: " + strd);
-        if (reverse) {
-          if (localcartesian)
-            lc.Reverse(x, y, z, lat, lon, h);
-          else
-            ec.Reverse(x, y, z, lat, lon, h);
-          *output << Utility::str(longfirst ? lon : lat, prec + 5) << " "
-                  << Utility::str(longfirst ? lat : lon, prec + 5) << " "
-                  << Utility::str(h, prec) << eol;
-        } else {
-          if (localcartesian)
-            lc.Forward(lat, lon, h, x, y, z);
-          else
-            ec.Forward(lat, lon, h, x, y, z);
-          *output << Utility::str(x, prec) << " "
-                  << Utility::str(y, prec) << " "
-                  << Utility::str(z, prec) << eol;
+
+    if (binary) {
+      // Read the input in blocks of records; convert the records in a block
+      // concurrently and write the results in order.
+      const size_t nblock = 65536, recsize = 3 * sizeof(double);
+      Executor exec(nthreads, 4096);
+      std::vector<double> rec(3 * nblock);
+      while (true) {
+        input->read(reinterpret_cast<char*>(rec.data()), nblock * recsize);
+        std::streamsize nread = input->gcount();
+        size_t n = size_t(nread) / recsize;
+        double* r = rec.data();
+        exec.For(n, [&conv, r](size_t i1, size_t i2) -> void {
+          conv.Records(i2 - i1, r + 3 * i1);
+        });
+        output->write(reinterpret_cast<const char*>(r),
+                      std::streamsize(n * recsize));
+        if (size_t(nread) % recsize != 0) {
+          std::cerr << "Incomplete binary record at end of input\n";
+          retval = 1;
         }
+        if (n < nblock) break;
       }
-      catch (const std::exception& e) {
-        *output << "ERROR: " << e.what() << "\n";
-        retval = 1;
+    } else if (nthreads == 1) {
+      std::string s, eol;
+      while (std::getline(*input, s)) {
+        try {
+          real a1, b1, c1, a2, b2, c2;
+          conv.Parse(s, a1, b1, c1, eol);
+          conv.Convert(1, &a1, &b1, &c1, &a2, &b2, &c2);
+          *output << conv.Format(a2, b2, c2, eol);
+        }
+        catch (const std::exception& e) {
+          *output << "ERROR: " << e.what() << "\n";
+          retval = 1;
+        }
+      }
+    } else {
+      // Read the input in blocks of lines; convert the lines in a block
+      // concurrently and write the results in order.
+      const size_t nblock = 65536;
+      Executor exec(nthreads, 256);
+      std::string s;
+      std::vector<std::string> lines, outs;
+      std::vector<char> ok;
+      lines.reserve(nblock);
+      bool more = true;
+      while (more) {
+        lines.clear();
+        while (lines.size() < nblock && (more = bool(std::getline(*input, s))))
+          lines.push_back(s);
+        size_t n = lines.size();
+        outs.resize(n); ok.resize(n);
+        exec.For(n, [&conv, &lines, &outs, &ok]
+                 (size_t i1, size_t i2) -> void {
+          conv.Lines(lines, outs, ok, i1, i2);
+        });
+        for (size_t i = 0; i < n; ++i) {
+          if (!ok[i]) retval = 1;
+          *output << outs[i];
+        }
       }
     }
     return retval;
@@ -13,10 +13,12 @@
 #include <string>
 #include <sstream>
 #include <fstream>
+#include <vector>
 #include <GeographicLib/GeoCoords.hpp>
 #include <GeographicLib/DMS.hpp>
 #include <GeographicLib/Utility.hpp>
 #include <GeographicLib/MGRS.hpp>
+#include <GeographicLib/Executor.hpp>
 
 #if defined(_MSC_VER)
 // Squelch warnings about constant conditional expressions
@@ -25,14 +27,110 @@
 
 #include "GeoConvert.usage"
 
+namespace {
+
+  using namespace GeographicLib;
+
+  // The output format.  This is fixed once the command line has been parsed
+  // (so Convert can be called concurrently from several threads) except that
+  // Latch updates the zone after the first legal conversion with -S or -T.
+  class Format {
+  public:
+    enum { GEOGRAPHIC, DMS, UTMUPS, MGRS, CONVERGENCE };
+  private:
+    typedef Math::real real;
+    int _outputmode, _prec, _prec1, _zone;
+    bool _centerp, _longfirst, _sethemisphere, _northp, _abbrev, _latch;
+    char _dmssep;
+    std::string _cdelim;
+  public:
+    Format(int outputmode, int prec, int zone,
+           bool centerp, bool longfirst, bool sethemisphere, bool northp,
+           bool abbrev, bool latch, char dmssep, const std::string& cdelim)
+      : _outputmode(outputmode)
+      , _prec(prec)
+        // The precision for the convergence and scale
+      , _prec1(std::max(-5, std::min(Math::extra_digits() + 8, prec)))
+      , _zone(zone)
+      , _centerp(centerp)
+      , _longfirst(longfirst)
+      , _sethemisphere(sethemisphere)
+      , _northp(northp)
+      , _abbrev(abbrev)
+      , _latch(latch)
+      , _dmssep(dmssep)
+      , _cdelim(cdelim)
+    {}
+    // Convert the input line s using p (which is modified) and set out to the
+    // output line including the end of line.  Return false on error.
+    bool Convert(GeoCoords& p, std::string s, std::string& out) const {
+      std::string eol("\n"), os;
+      bool ok = true;
+      try {
+        if (!_cdelim.empty()) {
+          std::string::size_type m = s.find(_cdelim);
+          if (m != std::string::npos) {
+            eol = " " + s.substr(m) + "\n";
+            s = s.substr(0, m);
+          }
+        }
+        p.Reset(s, _centerp, _longfirst);
+        p.SetAltZone(_zone);
+        switch (_outputmode) {
+        case GEOGRAPHIC:
+          os = p.GeoRepresentation(_prec, _longfirst);
+          break;
+        case DMS:
+          os = p.DMSRepresentation(_prec, _longfirst, _dmssep);
+          break;
+        case UTMUPS:
+          os = (_sethemisphere
+                ? p.AltUTMUPSRepresentation(_northp, _prec, _abbrev)
+                : p.AltUTMUPSRepresentation(_prec, _abbrev));
+          break;
+        case MGRS:
+          os = p.AltMGRSRepresentation(_prec);
+          break;
+        case CONVERGENCE:
+          {
+            real
+              gamma = p.AltConvergence(),
+              k = p.AltScale();
+            os = Utility::str(gamma, _prec1 + 5) + " "
+              + Utility::str(k, _prec1 + 7);
+          }
+        }
+      }
+      catch (const std::exception& e) {
+        // Write error message to cout so output lines match input lines
+        os = std::string("ERROR: ") + e.what();
+        ok = false;
+      }
+      out = os + eol;
+      return ok;
+    }
+    // Is the zone still to be latched?
+    bool Latching() const { return _latch; }
+    // Latch the zone given the result p of a legal conversion.
+    void Latch(const GeoCoords& p) {
+      if (_latch &&
+          _zone < UTMUPS::MINZONE && p.AltZone() >= UTMUPS::MINZONE) {
+        _zone = p.AltZone();
+        _northp = p.Northp();
+        _sethemisphere = true;
+        _latch = false;
+      }
+    }
+  };
+
+} // namespace
+
 int main(int argc, const char* const argv[]) {
   try {
     using namespace GeographicLib;
-    typedef Math::real real;
     Utility::set_digits();
-    enum { GEOGRAPHIC, DMS, UTMUPS, MGRS, CONVERGENCE };
-    int outputmode = GEOGRAPHIC;
-    int prec = 0;
+    int outputmode = Format::GEOGRAPHIC;
+    int prec = 0, nthreads = 1;
     int zone = UTMUPS::MATCH;
     bool centerp = true, longfirst = false;
     std::string istring, ifile, ofile, cdelim;
@@ -42,19 +140,19 @@ int main(int argc, const char* const argv[]) {
     for (int m = 1; m < argc; ++m) {
       std::string arg(argv[m]);
       if (arg == "-g")
-        outputmode = GEOGRAPHIC;
+        outputmode = Format::GEOGRAPHIC;
       else if (arg == "-d") {
-        outputmode = DMS;
+        outputmode = Format::DMS;
         dmssep = '\0';
       } else if (arg == "-:") {
-        outputmode = DMS;
+        outputmode = Format::DMS;
         dmssep = ':';
       } else if (arg == "-u")
-        outputmode = UTMUPS;
+        outputmode = Format::UTMUPS;
       else if (arg == "-m")
-        outputmode = MGRS;
+        outputmode = Format::MGRS;
       else if (arg == "-c")
-        outputmode = CONVERGENCE;
+        outputmode = Format::CONVERGENCE;
       else if (arg == "-n")
         centerp = false;
       else if (arg == "-z") {
@@ -106,6 +204,19 @@ int main(int argc, const char* const argv[]) {
           std::cerr << "Precision " << argv[m] << " is not a number\n";
           return 1;
         }
+      } else if (arg == "--threads") {
+        if (++m == argc) return usage(1, true);
+        try {
+          nthreads = Utility::val<int>(std::string(argv[m]));
+        }
+        catch (const std::exception&) {
+          std::cerr << "Number of threads " << argv[m] << " is not a number\n";
+          return 1;
+        }
+        if (nthreads < 0) {
+          std::cerr << "Number of threads " << nthreads << " is negative\n";
+          return 1;
+        }
       } else if (arg == "-l")
         abbrev = false;
       else if (arg == "-a")
@@ -175,62 +286,52 @@ int main(int argc, const char* const argv[]) {
     }
     std::ostream* output = !ofile.empty() ? &outfile : &std::cout;
 
+    Format fmt(outputmode, prec, zone, centerp, longfirst,
+               sethemisphere, northp, abbrev, latch, dmssep, cdelim);
     GeoCoords p;
-    std::string s, eol;
-    std::string os;
+    std::string s, os;
     int retval = 0;
 
-    while (std::getline(*input, s)) {
-      eol = "\n";
-      try {
-        if (!cdelim.empty()) {
-          std::string::size_type m = s.find(cdelim);
-          if (m != std::string::npos) {
-            eol = " " + s.substr(m) + "\n";
-            s = s.substr(0, m);
-          }
-        }
-        p.Reset(s, centerp, longfirst);
-        p.SetAltZone(zone);
-        switch (outputmode) {
-        case GEOGRAPHIC:
-          os = p.GeoRepresentation(prec, longfirst);
-          break;
-        case DMS:
-          os = p.DMSRepresentation(prec, longfirst, dmssep);
-          break;
-        case UTMUPS:
-          os = (sethemisphere
-                ? p.AltUTMUPSRepresentation(northp, prec, abbrev)
-                : p.AltUTMUPSRepresentation(prec, abbrev));
-          break;
-        case MGRS:
-          os = p.AltMGRSRepresentation(prec);
-          break;
-        case CONVERGENCE:
-          {
-            real
-              gamma = p.AltConvergence(),
-              k = p.AltScale();
-            int prec1 = std::max(-5, std::min(Math::extra_digits() + 8, prec));
-            os = Utility::str(gamma, prec1 + 5) + " "
-              + Utility::str(k, prec1 + 7);
-          }
-        }
-        if (latch &&
-            zone < UTMUPS::MINZONE && p.AltZone() >= UTMUPS::MINZONE) {
-          zone = p.AltZone();
-          northp = p.Northp();
-          sethemisphere = true;
-          latch = false;
-        }
+    if (nthreads == 1) {
+      while (std::getline(*input, s)) {
+        if (fmt.Convert(p, s, os))
+          fmt.Latch(p);
+        else
+          retval = 1;
+        *output << os;
       }
-      catch (const std::exception& e) {
-        // Write error message to cout so output lines match input lines
-        os = std::string("ERROR: ") + e.what();
-        retval = 1;
+    } else {
+      // Read the input in blocks of lines; convert the lines in a block
+      // concurrently (each thread uses its own GeoCoords object) and write
+      // the results in order.  This is a threaded version of the serial
+      // loop; each line is still converted by itself with Convert.  While the zone is being latched (-S or -T),
+      // the lines are converted serially.
+      const size_t nblock = 65536;
+      Executor exec(nthreads, 256);
+      std::vector<std::string> lines, outs;
+      std::vector<char> ok;
+      lines.reserve(nblock);
+      bool more = true;
+      while (more) {
+        lines.clear();
+        while (lines.size() < nblock && (more = bool(std::getline(*input, s))))
+          lines.push_back(s);
+        size_t n = lines.size(), i0 = 0;
+        outs.resize(n); ok.resize(n);
+        for (; i0 < n && fmt.Latching(); ++i0)
+          if ((ok[i0] = fmt.Convert(p, lines[i0], outs[i0])))
+            fmt.Latch(p);
+        exec.For(n - i0, [&fmt, &lines, &outs, &ok, i0]
+                 (size_t i1, size_t i2) -> void {
+          GeoCoords q;
+          for (size_t i = i0 + i1; i < i0 + i2; ++i)
+            ok[i] = fmt.Convert(q, lines[i], outs[i]);
+        });
+        for (size_t i = 0; i < n; ++i) {
+          if (!ok[i]) retval = 1;
+          *output << outs[i];
+        }
       }
-      *output << os << eol;
     }
     return retval;
   }